@@ -65,6 +65,7 @@ mepa_rc meba_phy_macsec_control_frame_match_conf_get(meba_inst_t inst, const mep
 mepa_rc meba_phy_macsec_pattern_set(meba_inst_t inst, mepa_port_no_t port_no, const mepa_macsec_port_t port, const mepa_macsec_direction_t direction, const mepa_macsec_match_action_t action, const mepa_macsec_match_pattern_t *const pattern);
 mepa_rc meba_phy_macsec_pattern_del(meba_inst_t inst, mepa_port_no_t port_no, const mepa_macsec_port_t port, const mepa_macsec_direction_t direction, const mepa_macsec_match_action_t action);
 mepa_rc meba_phy_macsec_pattern_get(meba_inst_t inst, mepa_port_no_t port_no, const mepa_macsec_port_t port, const mepa_macsec_direction_t direction, const mepa_macsec_match_action_t action, mepa_macsec_match_pattern_t *const pattern);
+mepa_rc meba_phy_macsec_txn_commit(meba_inst_t inst, mepa_port_no_t port_no, const uint32_t cnt, const mepa_macsec_txn_secy_t *const secy, uint32_t *const failed);
 mepa_rc meba_phy_macsec_default_action_set(meba_inst_t inst, const mepa_port_no_t port_no, const mepa_macsec_default_action_policy_t *const policy);
 mepa_rc meba_phy_macsec_default_action_get(meba_inst_t inst, const mepa_port_no_t port_no, mepa_macsec_default_action_policy_t *const policy);
 mepa_rc meba_phy_macsec_bypass_mode_set(meba_inst_t inst, const mepa_port_no_t port_no, const mepa_macsec_bypass_mode_t *const bypass);
@@ -75,12 +76,14 @@ mepa_rc meba_phy_macsec_mtu_set(meba_inst_t inst, const mepa_port_no_t port_no,
 mepa_rc meba_phy_macsec_mtu_get(meba_inst_t inst, const mepa_port_no_t port_no, mepa_macsec_mtu_t *mtu_conf);
 mepa_rc meba_phy_macsec_frame_capture_set(meba_inst_t inst, const mepa_port_no_t port_no, const mepa_macsec_frame_capture_t capture);
 mepa_rc meba_phy_macsec_frame_get(meba_inst_t inst, const mepa_port_no_t port_no, const uint32_t buf_length, uint32_t *const return_length, uint8_t *const frame);
+mepa_rc meba_phy_macsec_frame_ring_get(meba_inst_t inst, const mepa_port_no_t port_no, mepa_macsec_capture_ring_t *const ring, uint32_t *const cnt);
 mepa_rc meba_phy_macsec_event_enable_set(meba_inst_t inst, const mepa_port_no_t port_no, const mepa_macsec_event_t ev_mask, const mepa_bool_t enable);
 mepa_rc meba_phy_macsec_event_enable_get(meba_inst_t inst, const mepa_port_no_t port_no, mepa_macsec_event_t *const ev_mask);
 mepa_rc meba_phy_macsec_event_poll(meba_inst_t inst, const mepa_port_no_t port_no, mepa_macsec_event_t *const ev_mask);
 mepa_rc meba_phy_macsec_event_seq_threshold_set(meba_inst_t inst, const mepa_port_no_t port_no, const uint32_t threshold);
 mepa_rc meba_phy_macsec_event_seq_threshold_get(meba_inst_t inst, const mepa_port_no_t port_no, uint32_t *const threshold);
 mepa_rc meba_phy_macsec_egr_intr_sa_get(meba_inst_t inst, const mepa_port_no_t port_no, mepa_macsec_port_t *const port, uint16_t *const an);
+mepa_rc meba_phy_macsec_sa_event_poll(meba_inst_t inst, const mepa_port_no_t port_no, const uint32_t max_cnt, mepa_macsec_sa_event_t *const events, uint32_t *const cnt);
 mepa_rc meba_phy_macsec_csr_read(meba_inst_t inst, const mepa_port_no_t port_no, const uint16_t mmd, const uint32_t addr, uint32_t *const value);
 mepa_rc meba_phy_macsec_csr_write(meba_inst_t inst, const mepa_port_no_t port_no, const uint32_t mmd, const uint32_t addr, const uint32_t value);
 mepa_rc meba_phy_macsec_dbg_counter_get(meba_inst_t inst, const mepa_port_no_t port_no, mepa_macsec_rc_dbg_counters_t *const counters);
@@ -500,6 +500,7 @@ typedef struct {
     mepa_spi_write_t mepa_spi_slot1_reg_write;
     mepa_spi_read_t  mepa_spi_slot2_reg_read;
     mepa_spi_write_t mepa_spi_slot2_reg_write;
+    mepa_spi_batch_t mepa_spi_reg_batch;    // Optional, several SPI register accesses in one go
     mesa_i2c_read_t  i2c_read;
     mesa_i2c_write_t i2c_write;
     meba_conf_get_t  conf_get;
@@ -581,6 +582,8 @@ typedef struct mepa_callout_ctx {
     mesa_miim_controller_t  miim_controller;
     uint8_t                 miim_addr;
     mesa_chip_no_t          chip_no;
+    meba_port_cap_t         cap;       // Cached port capabilities, used by meba_phy_conf_set()
+    mepa_bool_t             cap_valid; // The cap field is valid
 } mepa_callout_ctx_t;
 
 typedef struct {
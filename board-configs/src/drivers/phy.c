@@ -17,6 +17,9 @@ mepa_rc meba_phy_reset(meba_inst_t inst, mepa_port_no_t port_no,
         return MESA_RC_ERR_INV_PORT_BOARD;
     }
 
+    if (inst->phy_device_ctx) {
+        inst->phy_device_ctx[port_no].cap_valid = FALSE;
+    }
     return mepa_reset(inst->phy_devices[port_no], rst_conf);
 }
 
@@ -39,16 +42,27 @@ mepa_rc meba_phy_conf_set(meba_inst_t inst, mepa_port_no_t port_no,
 {
     meba_port_cap_t cap;
     meba_port_entry_t entry;
+    mepa_callout_ctx_t *ctx;
     mepa_conf_t cf = *conf;
 
     T_D(inst, "Called");
-    inst->api.meba_port_entry_get(inst, port_no, &entry);
-    cap = entry.cap;
-
     if ((port_no < 0) || (port_no >= inst->phy_device_cnt))  {
         return MESA_RC_ERR_INV_PORT_BOARD;
     }
 
+    // The board capabilities are static, avoid the port entry lookup on every call
+    ctx = (inst->phy_device_ctx ? &inst->phy_device_ctx[port_no] : NULL);
+    if (ctx && ctx->cap_valid) {
+        cap = ctx->cap;
+    } else {
+        inst->api.meba_port_entry_get(inst, port_no, &entry);
+        cap = entry.cap;
+        if (ctx) {
+            ctx->cap = cap;
+            ctx->cap_valid = TRUE;
+        }
+    }
+
     if (cf.admin.enable) {
         if (cf.speed == MESA_SPEED_AUTO || cf.speed == MESA_SPEED_1G) {
             memset(&cf.aneg, 0, sizeof(cf.aneg));
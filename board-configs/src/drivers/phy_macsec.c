@@ -637,6 +637,17 @@ mepa_rc meba_phy_macsec_pattern_get(meba_inst_t inst, mepa_port_no_t port_no, co
     return mepa_macsec_pattern_get(inst->phy_devices[port_no], port, direction, action, pattern);
 }
 
+mepa_rc meba_phy_macsec_txn_commit(meba_inst_t inst, mepa_port_no_t port_no, const uint32_t cnt, const mepa_macsec_txn_secy_t *const secy, uint32_t *const failed)
+{
+    mesa_rc rc = MESA_RC_ERROR;
+
+    if ((rc = meba_dev_chk(inst, port_no)) != MESA_RC_OK) {
+        return rc;
+    }
+
+    return mepa_macsec_txn_commit(inst->phy_devices[port_no], cnt, secy, failed);
+}
+
 mepa_rc meba_phy_macsec_default_action_set(meba_inst_t inst, const mepa_port_no_t port_no, const mepa_macsec_default_action_policy_t *const policy)
 {
     mesa_rc rc = MESA_RC_ERROR;
@@ -748,6 +759,17 @@ mepa_rc meba_phy_macsec_frame_get(meba_inst_t inst, const mepa_port_no_t port_no
     return mepa_macsec_frame_get(inst->phy_devices[port_no], port_no, buf_length, return_length, frame);
 }
 
+mepa_rc meba_phy_macsec_frame_ring_get(meba_inst_t inst, const mepa_port_no_t port_no, mepa_macsec_capture_ring_t *const ring, uint32_t *const cnt)
+{
+    mesa_rc rc = MESA_RC_ERROR;
+
+    if ((rc = meba_dev_chk(inst, port_no)) != MESA_RC_OK) {
+        return rc;
+    }
+
+    return mepa_macsec_frame_ring_get(inst->phy_devices[port_no], port_no, ring, cnt);
+}
+
 mepa_rc meba_phy_macsec_event_enable_set(meba_inst_t inst, const mepa_port_no_t port_no, const mepa_macsec_event_t ev_mask, const mepa_bool_t enable)
 {
     mesa_rc rc = MESA_RC_ERROR;
@@ -814,6 +836,17 @@ mepa_rc meba_phy_macsec_egr_intr_sa_get(meba_inst_t inst, const mepa_port_no_t p
     return mepa_macsec_egr_intr_sa_get(inst->phy_devices[port_no], port_no, port, an);
 }
 
+mepa_rc meba_phy_macsec_sa_event_poll(meba_inst_t inst, const mepa_port_no_t port_no, const uint32_t max_cnt, mepa_macsec_sa_event_t *const events, uint32_t *const cnt)
+{
+    mesa_rc rc = MESA_RC_ERROR;
+
+    if ((rc = meba_dev_chk(inst, port_no)) != MESA_RC_OK) {
+        return rc;
+    }
+
+    return mepa_macsec_sa_event_poll(inst->phy_devices[port_no], max_cnt, events, cnt);
+}
+
 mepa_rc meba_phy_macsec_csr_read(meba_inst_t inst, const mepa_port_no_t port_no, const uint16_t mmd, const uint32_t addr, uint32_t *const value)
 {
     mesa_rc rc = MESA_RC_ERROR;
@@ -188,6 +188,7 @@ void meba_phy_driver_init(meba_inst_t inst)
     inst->mepa_callout.miim_write = meba_miim_write;
     inst->mepa_callout.spi_read = inst->iface.mepa_spi_slot1_reg_read;
     inst->mepa_callout.spi_write = inst->iface.mepa_spi_slot1_reg_write;
+    inst->mepa_callout.spi_batch = inst->iface.mepa_spi_reg_batch;
     inst->mepa_callout.lock_enter = inst->iface.lock_enter;
     inst->mepa_callout.lock_exit = inst->iface.lock_exit;
     inst->mepa_callout.mem_alloc = mem_alloc;
@@ -740,9 +740,54 @@ static const board_func_t board_funcs[] = {
     },
 };
 
+// Poll 10G PHY events for ports first..last. The interrupt summary is read once per
+// PHY chip and only the channels with a pending interrupt are polled. PHYs without
+// an interrupt summary are polled port by port.
+static void phy_10g_events_get(meba_inst_t inst,
+                               mesa_port_no_t first,
+                               mesa_port_no_t last,
+                               vtss_phy_10g_event_t *events)
+{
+    meba_board_state_t           *board = INST2BOARD(inst);
+    vtss_phy_10g_event_summary_t summary;
+    mesa_bool_t                  done[board->port_cnt];
+    mesa_port_no_t               port_no, p;
+    uint32_t                     chan;
+
+    memset(done, 0, sizeof(done));
+    for (port_no = first; port_no <= last && port_no < board->port_cnt; port_no++) {
+        events[port_no] = 0;
+    }
+    for (port_no = first; port_no <= last && port_no < board->port_cnt; port_no++) {
+        if (done[port_no] || !is_sfp_port(board->port[port_no].map.cap)) {
+            continue;
+        }
+        if (vtss_phy_10g_event_summary_get(NULL, port_no, &summary) != MESA_RC_OK) {
+            done[port_no] = true;
+            if (vtss_phy_10g_event_poll(NULL, port_no, &events[port_no]) != MESA_RC_OK) {
+                events[port_no] = 0;
+            }
+            continue;
+        }
+        for (chan = 0; chan < 4; chan++) {
+            p = summary.port_no[chan];
+            if (p < first || p > last || p >= board->port_cnt) {
+                continue;
+            }
+            done[p] = true;
+            if (((summary.chan_pending & (1 << chan)) || summary.gpio_pending) &&
+                vtss_phy_10g_event_poll(NULL, p, &events[p]) != MESA_RC_OK) {
+                events[p] = 0;
+            }
+            T_N(inst, "port %d chan %u events 0x%x", p, chan, events[p]);
+        }
+    }
+}
+
 static mesa_bool_t get_sfp_status(meba_inst_t inst,
                                   mesa_port_no_t port_no,
                                   mesa_sgpio_port_data_t *data,
+                                  vtss_phy_10g_event_t events,
                                   sfp_signal_t sfp)
 {
     meba_board_state_t *board = INST2BOARD(inst);
@@ -752,7 +797,6 @@ static mesa_bool_t get_sfp_status(meba_inst_t inst,
         T_E(inst, "Invalid port %d, sgpio_port %d", port_no, sgpio_port);
         return false;
     }
-    vtss_phy_10g_event_t events;
     // SW_WA_PCB134
     // Due to a hardware bug in PCB134, all SGPIOs in group 2
     // are shifted to the left by 1 bit, so p31b0 is p31b1,
@@ -762,11 +806,9 @@ static mesa_bool_t get_sfp_status(meba_inst_t inst,
     // to the right and p32b0 is now accessible at p31b0.
     if (sfp == SFP_DETECT) { 
         //printf("Checking event for 10G phy %d\n", port_no);
-        if (vtss_phy_10g_event_poll(NULL, port_no, &events) == MESA_RC_OK) {
-            if(events & VTSS_PHY_10G_MODULE_STAT_EV) {
-               printf("Module detected \n");
-               return 0;
-            }
+        if(events & VTSS_PHY_10G_MODULE_STAT_EV) {
+           printf("Module detected \n");
+           return 0;
         }
 /*
         if (board->type == BOARD_TYPE_SPARX5_PCB134) {
@@ -782,10 +824,8 @@ static mesa_bool_t get_sfp_status(meba_inst_t inst,
         }
     } else if (sfp == SFP_LOS) {
 
-        if (vtss_phy_10g_event_poll(NULL, port_no, &events) == MESA_RC_OK) {
-            if(events & VTSS_PHY_10G_LINK_LOS_EV) {
-              return 1;
-            }
+        if(events & VTSS_PHY_10G_LINK_LOS_EV) {
+          return 1;
         }
 /*
         if (board->type == BOARD_TYPE_SPARX5_PCB134) {
@@ -1090,16 +1130,18 @@ static mesa_rc fa_sfp_insertion_status_get(meba_inst_t inst, mesa_port_list_t *p
     mesa_rc                rc = MESA_RC_OK;
     meba_board_state_t     *board = INST2BOARD(inst);
     mesa_sgpio_port_data_t data[MESA_SGPIO_PORTS];
+    vtss_phy_10g_event_t   events[board->port_cnt];
 
     T_N(inst, "Called");
     mesa_port_list_clear(present);
 
     if ((rc = mesa_sgpio_read(NULL, 0, 2, data)) == MESA_RC_OK) {
         mesa_port_no_t port_no;
+        phy_10g_events_get(inst, 0, board->port_cnt - 1, events);
         /* The 'Module Detect' is inverted i.e. '0' means detected */
         for (port_no = 0; port_no < board->port_cnt; port_no++) {
             if (is_sfp_port(board->port[port_no].map.cap)) {
-                mesa_bool_t detect = get_sfp_status(inst, port_no, data, SFP_DETECT);
+                mesa_bool_t detect = get_sfp_status(inst, port_no, data, events[port_no], SFP_DETECT);
                 mesa_port_list_set(present, port_no, detect);
                 T_N(inst, "port:%d, status:%d", port_no, detect);
             }
@@ -1123,11 +1165,13 @@ static mesa_rc fa_sfp_status_get(meba_inst_t inst,
             status->tx_fault = false;
             if (is_sfp_port(board->port[port_no].map.cap)) {
                 mesa_sgpio_port_data_t data[MESA_SGPIO_PORTS];
+                vtss_phy_10g_event_t   events[board->port_cnt];
                 rc = mesa_sgpio_read(NULL, 0, 2, data); // SGPIO group 2
                 if (rc == MESA_RC_OK) {
-                    status->present  = get_sfp_status(inst, port_no, data, SFP_DETECT);
-                    status->tx_fault = get_sfp_status(inst, port_no, data, SFP_FAULT);
-                    status->los      = get_sfp_status(inst, port_no, data, SFP_LOS);
+                    phy_10g_events_get(inst, port_no, port_no, events);
+                    status->present  = get_sfp_status(inst, port_no, data, events[port_no], SFP_DETECT);
+                    status->tx_fault = get_sfp_status(inst, port_no, data, events[port_no], SFP_FAULT);
+                    status->los      = get_sfp_status(inst, port_no, data, events[port_no], SFP_LOS);
                 }
                 T_N(inst, "port(%d): rc %d, present:%d los:%d tx_fault:%d", port_no, rc,
                     status->present, status->los, status->tx_fault);
@@ -34,6 +34,7 @@
 #include "AQ_PhyInterface.h"
 #include "AQ_Firmware.h"
 #include "AQ_User.h"
+#include "phy_driver.h"
 
 #define T_D(format, ...) MEPA_trace(MEPA_TRACE_GRP_GEN, MEPA_TRACE_LVL_DEBUG, __FUNCTION__, __LINE__, format, ##__VA_ARGS__);
 #define T_I(format, ...) MEPA_trace(MEPA_TRACE_GRP_GEN, MEPA_TRACE_LVL_INFO, __FUNCTION__, __LINE__, format, ##__VA_ARGS__);
@@ -43,7 +44,6 @@
 #define TRUE 1
 #define FALSE 0
 
-#define VTSS_FREE(_p_)                          free(_p_)
 #define MSLEEP(sec)                             usleep(sec*1000)
 
 #define AQR_2_MESA_RC(aq_rc)                    ((aq_rc == AQ_RET_OK) ? MESA_RC_OK : MESA_RC_ERROR)
@@ -54,18 +54,86 @@
 
 #define AQ_PORT(dev) (&(((AQR_priv_data_t *)dev->data)->aq_port))
 
+// The variable 'dev' is only used to get the lock functions, the lock is common for all devices.
+#define MEPA_ENTER(dev) {                            \
+    mepa_lock_t lock;                                \
+    lock.function = __FUNCTION__;                    \
+    lock.file = __FILE__;                            \
+    lock.line = __LINE__;                            \
+    if (dev->callout->lock_enter) {                  \
+        dev->callout->lock_enter(&lock);             \
+    }                                                \
+}
+
+#define MEPA_EXIT(dev) {                             \
+    mepa_lock_t lock;                                \
+    lock.function = __FUNCTION__;                    \
+    lock.file = __FILE__;                            \
+    lock.line = __LINE__;                            \
+    if (dev->callout->lock_exit) {                   \
+        dev->callout->lock_exit(&lock);              \
+    }                                                \
+}
+
+// Gang-load set of one MDIO bus loaded from the reset path, see mepa_aqr_fw_load_reg().
+// The set is allocated through the callout of conf.gang_dev, which owns it.
+typedef struct {
+    mepa_aqr_fw_load_conf_t conf;
+    mepa_aqr_fw_load_port_t ports[MEPA_AQR_FW_LOAD_PORT_MAX];
+    uint32_t                cnt;
+    mepa_bool_t             loaded;
+    uint32_t                load_ms;
+} aqr_fw_gang_t;
+
 typedef struct {
     AQ_Port          aq_port;
     int              phy_diag_done;
     int              phy_shutdown;
+    aqr_fw_gang_t    *fw_gang;     // Gang-load set this PHY is in
+    aqr_fw_gang_t    *fw_gang_own; // Gang-load set owned by this PHY as gang_dev
 } AQR_priv_data_t;
 
+#define AQR_PRIV(dev) ((AQR_priv_data_t *)(dev)->data)
+
+// Unregister a gang-load set and free it
+static void aqr_fw_gang_free(aqr_fw_gang_t *gang)
+{
+    mepa_device_t *gang_dev = gang->conf.gang_dev;
+    uint32_t      i;
+
+    for (i = 0; i < gang->cnt; i++) {
+        AQR_PRIV(gang->ports[i].dev)->fw_gang = NULL;
+    }
+    AQR_PRIV(gang_dev)->fw_gang_own = NULL;
+    mepa_mem_free_int(gang_dev->callout, gang_dev->callout_ctx, gang);
+}
+
+// Remove a PHY from its gang-load set
+static void aqr_fw_gang_remove(mepa_device_t *dev)
+{
+    aqr_fw_gang_t *gang = AQR_PRIV(dev)->fw_gang;
+    uint32_t      i;
+
+    for (i = 0; i < gang->cnt; i++) {
+        if (gang->ports[i].dev == dev) {
+            gang->cnt--;
+            memmove(&gang->ports[i], &gang->ports[i + 1], (gang->cnt - i) * sizeof(gang->ports[0]));
+            break;
+        }
+    }
+    AQR_PRIV(dev)->fw_gang = NULL;
+}
+
 static mesa_rc aqr_delete(mepa_device_t *dev)
 {
-    AQR_priv_data_t *data = (AQR_priv_data_t *)dev->data;
-    VTSS_FREE(data);
-    VTSS_FREE(dev);
-    return MESA_RC_OK;
+    // The registered gang-load sets must not refer to a deleted device
+    if (AQR_PRIV(dev)->fw_gang_own) {
+        aqr_fw_gang_free(AQR_PRIV(dev)->fw_gang_own);
+    }
+    if (AQR_PRIV(dev)->fw_gang) {
+        aqr_fw_gang_remove(dev);
+    }
+    return mepa_delete_int(dev);
 }
 
 static void aqr_port_id_init(AQ_Port              *data,
@@ -211,6 +279,30 @@ static mesa_rc aqr_conf_set(mepa_device_t *dev,
     return aqr_conf_set_private(dev, config, false);
 }
 
+// Only the speed, flow control, advertisement and admin state are used by the AQR PHYs, so a
+// change of any other field must not restart aneg.
+#define AQR_CONF_CHG_USED (MEPA_CONF_CHG_SPEED | MEPA_CONF_CHG_FLOW_CONTROL | MEPA_CONF_CHG_ADV | MEPA_CONF_CHG_ADMIN)
+
+static mesa_rc aqr_409_conf_update(mepa_device_t *dev,
+                                   const mepa_conf_t *config,
+                                   mepa_conf_change_t chg)
+{
+    if (!(chg & AQR_CONF_CHG_USED)) {
+        return MESA_RC_OK;
+    }
+    return aqr_conf_set_private(dev, config, true);
+}
+
+static mesa_rc aqr_conf_update(mepa_device_t *dev,
+                               const mepa_conf_t *config,
+                               mepa_conf_change_t chg)
+{
+    if (!(chg & AQR_CONF_CHG_USED)) {
+        return MESA_RC_OK;
+    }
+    return aqr_conf_set_private(dev, config, false);
+}
+
 static mesa_rc aqr_poll(mepa_device_t *dev, mepa_status_t *status)
 {
     AQ_Port *data = AQ_PORT(dev);
@@ -419,27 +511,45 @@ static mesa_rc aqr_veriphy_get(mepa_device_t         *dev,
     return AQR_2_MESA_RC(aq_rc);
 }
 
-static mesa_rc aqr_fw_check(AQ_Port  *data,
-                            uint8_t  major_id,
-                            uint8_t  minor_id,
-                            uint8_t  build_id)
+// Check the firmware version of a PHY. If match is non-NULL, it is set to whether the PHY runs
+// exactly major_id.minor_id.build_id, and no error is given for other versions.
+static mesa_rc aqr_fw_check(AQ_Port     *data,
+                            uint8_t     major_id,
+                            uint8_t     minor_id,
+                            uint8_t     build_id,
+                            mesa_bool_t *match)
 {
     AQ_API_StaticConfiguration aq_config;
     AQ_Retcode                 aq_ret;
     int rom;
 
+    if (match) {
+        *match = FALSE;
+    }
     aq_ret = aqr_phy_conf_get(data, &aq_config);
     if (aq_ret) {
-        T_E("aqr_fw_check/aqr_phy_conf_get failed. Port: %d, RC: %d", data->dev->numeric_handle, aq_ret);
+        if (match) {
+            // A PHY is allowed to have no running firmware before it is loaded
+            T_I("aqr_phy_conf_get failed. Port: %d, RC: %d", data->dev->numeric_handle, aq_ret);
+        } else {
+            T_E("aqr_fw_check/aqr_phy_conf_get failed. Port: %d, RC: %d", data->dev->numeric_handle, aq_ret);
+        }
         return MEPA_RC_ERROR;
     }
 
+    rom = (aq_config.firmwareROM_ID_Number & 0xf0) >> 4;
+    if (match) {
+        *match = (aq_config.firmwareMajorRevisionNumber == major_id &&
+                  aq_config.firmwareMinorRevisionNumber == minor_id &&
+                  rom == build_id);
+        return MEPA_RC_OK;
+    }
+
     // In earlier version of SW check was only performed if major number match
     if (aq_config.firmwareMajorRevisionNumber != major_id) {
         return MEPA_RC_OK;
     }
 
-    rom = (aq_config.firmwareROM_ID_Number & 0xf0) >> 4;
     if (aq_config.firmwareMajorRevisionNumber != major_id &&
         (aq_config.firmwareMinorRevisionNumber != minor_id || rom != build_id)) {
         T_E("Unexpected firmware version. Port: %d, Major: %d/%d && (Minor %d/%d || ROM: %d/%d) (actual/expect)",
@@ -453,6 +563,190 @@ static mesa_rc aqr_fw_check(AQ_Port  *data,
     return MEPA_RC_OK;
 }
 
+static uint32_t aqr_time_ms(void)
+{
+    return (uint32_t)(MEPA_UPTIME_NSEC() / 1000000);
+}
+
+// Daisy-chain reset of one PHY. Refer to AN-N2101_FirmwareOverview_v1.0.pdf, the daisy-chain reset must follow
+// the chip port order, otherwise the provisioning is incorrect and MDIO can't be accessed. The hop-count is
+// therefore overridden with the provisioning address, so the PHY ends up at prov_addr regardless of the order.
+static void aqr_daisy_chain_reset(mepa_device_t *dev, uint32_t prov_addr)
+{
+    uint16_t reg_value;
+
+    T_D("daisy chain reset port_no: %u, prov_addr: %u", dev->numeric_handle, prov_addr);
+
+    // Override the hop-count via 1E.C471.6:0
+    dev->callout->mmd_read(dev->callout_ctx, 0x1e, 0xc471, &reg_value);
+    reg_value = (reg_value & ~0x7f) | (prov_addr & 0x3f) | (1 << 6);
+    dev->callout->mmd_write(dev->callout_ctx, 0x1e, 0xc471, reg_value);
+    // Reset daisy chain via toggling 1E.C442.0
+    dev->callout->mmd_read(dev->callout_ctx, 0x1e, 0xc442, &reg_value);
+    reg_value ^= 0x1;
+    dev->callout->mmd_write(dev->callout_ctx, 0x1e, 0xc442, reg_value);
+}
+
+// Gang-load, the caller holds the lock
+static mepa_rc aqr_fw_load_private(const mepa_aqr_fw_load_conf_t *conf,
+                                   mepa_aqr_fw_load_port_t       *ports,
+                                   uint32_t                      cnt,
+                                   uint32_t                      *load_ms)
+{
+    AQ_API_Port      aq_port[MEPA_AQR_FW_LOAD_PORT_MAX];
+    AQ_API_Port      *aq_ports[MEPA_AQR_FW_LOAD_PORT_MAX];
+    AQ_API_Port      gang_port;
+    unsigned int     prov_addr[MEPA_AQR_FW_LOAD_PORT_MAX];
+    AQ_Retcode       result[MEPA_AQR_FW_LOAD_PORT_MAX];
+    uint32_t         idx[MEPA_AQR_FW_LOAD_PORT_MAX];
+    uint32_t         i, n = 0, start;
+    mesa_bool_t      match;
+    AQ_Retcode       aq_rc;
+    mepa_rc          rc = MEPA_RC_OK;
+
+    *load_ms = 0;
+
+    // Read back the running version once per PHY and leave up-to-date PHYs alone
+    for (i = 0; i < cnt; i++) {
+        ports[i].rc = MEPA_RC_OK;
+        ports[i].skipped = FALSE;
+        start = aqr_time_ms();
+        if (aqr_fw_check(AQ_PORT(ports[i].dev), conf->major, conf->minor, conf->build, &match) == MEPA_RC_OK && match) {
+            ports[i].skipped = TRUE;
+        } else {
+            aqr_port_id_init(AQ_PORT(ports[i].dev), &aq_port[n]);
+            aq_ports[n] = &aq_port[n];
+            prov_addr[n] = ports[i].prov_addr;
+            result[n] = AQ_RET_OK;
+            idx[n++] = i;
+        }
+        ports[i].check_ms = aqr_time_ms() - start;
+        T_D("port_no: %u, skipped: %u, check_ms: %u", ports[i].dev->numeric_handle, ports[i].skipped, ports[i].check_ms);
+    }
+
+    if (n == 0) {
+        T_I("all %u PHYs run %u.%u.%u, nothing to load", cnt, conf->major, conf->minor, conf->build);
+        return MEPA_RC_OK;
+    }
+
+    // Restart the PHYs to load from their boot loader at the provisioning address
+    for (i = 0; i < n; i++) {
+        aqr_daisy_chain_reset(ports[idx[i]].dev, prov_addr[i]);
+    }
+
+    // All remaining PHYs are moved to the gang-load address and receive the image in one pass
+    aqr_port_id_init(AQ_PORT(conf->gang_dev), &gang_port);
+    start = aqr_time_ms();
+    aq_rc = AQ_API_WriteBootLoadImage(aq_ports, n, prov_addr, result, &conf->image_size,
+                                      conf->image, conf->gang_addr, &gang_port);
+    *load_ms = aqr_time_ms() - start;
+    T_I("loaded %u of %u PHYs in %u ms, aq_rc: %u", n, cnt, *load_ms, aq_rc);
+
+    for (i = 0; i < n; i++) {
+        if (result[i] != AQ_RET_OK) {
+            T_E("firmware load failed. Port: %u, aq_rc: %u", ports[idx[i]].dev->numeric_handle, result[i]);
+            ports[idx[i]].rc = MEPA_RC_ERROR;
+            rc = MEPA_RC_ERROR;
+        }
+    }
+
+    return rc;
+}
+
+static mepa_bool_t aqr_fw_load_conf_ok(const mepa_aqr_fw_load_conf_t *conf,
+                                       const mepa_aqr_fw_load_port_t *ports,
+                                       uint32_t                      cnt)
+{
+    return (conf && conf->image && conf->gang_dev && ports && cnt <= MEPA_AQR_FW_LOAD_PORT_MAX);
+}
+
+mepa_rc mepa_aqr_fw_load(const mepa_aqr_fw_load_conf_t *conf,
+                         mepa_aqr_fw_load_port_t       *ports,
+                         uint32_t                      cnt,
+                         uint32_t                      *const load_ms)
+{
+    mepa_rc rc;
+
+    if (!aqr_fw_load_conf_ok(conf, ports, cnt) || !load_ms) {
+        return MEPA_RC_ERROR;
+    }
+
+    MEPA_ENTER(conf->gang_dev);
+    rc = aqr_fw_load_private(conf, ports, cnt, load_ms);
+    MEPA_EXIT(conf->gang_dev);
+    return rc;
+}
+
+mepa_rc mepa_aqr_fw_load_reg(const mepa_aqr_fw_load_conf_t *conf,
+                             const mepa_aqr_fw_load_port_t *ports,
+                             uint32_t                      cnt)
+{
+    mepa_device_t *gang_dev;
+    aqr_fw_gang_t *gang;
+    mepa_rc       rc = MEPA_RC_OK;
+    uint32_t      i;
+
+    if (!aqr_fw_load_conf_ok(conf, ports, cnt)) {
+        return MEPA_RC_ERROR;
+    }
+
+    gang_dev = conf->gang_dev;
+    MEPA_ENTER(gang_dev);
+    if (AQR_PRIV(gang_dev)->fw_gang_own) {
+        aqr_fw_gang_free(AQR_PRIV(gang_dev)->fw_gang_own);
+    }
+    for (i = 0; i < cnt; i++) {
+        if (AQR_PRIV(ports[i].dev)->fw_gang) {
+            T_E("port_no: %u is already in the gang-load set of another bus", ports[i].dev->numeric_handle);
+            rc = MEPA_RC_ERROR;
+        }
+    }
+    if (rc == MEPA_RC_OK) {
+        if ((gang = mepa_mem_alloc_int(gang_dev->callout, gang_dev->callout_ctx, sizeof(*gang))) == NULL) {
+            rc = MEPA_RC_ERROR;
+        } else {
+            gang->conf = *conf;
+            memcpy(gang->ports, ports, cnt * sizeof(*ports));
+            gang->cnt = cnt;
+            for (i = 0; i < cnt; i++) {
+                AQR_PRIV(ports[i].dev)->fw_gang = gang;
+            }
+            AQR_PRIV(gang_dev)->fw_gang_own = gang;
+        }
+    }
+    MEPA_EXIT(gang_dev);
+    return rc;
+}
+
+// The first reset of a PHY in the registered gang-load set loads all PHYs of the set.
+// Each reset returns the load result of its own PHY.
+static mepa_rc aqr_reset(mepa_device_t *dev, const mepa_reset_param_t *rst_conf)
+{
+    aqr_fw_gang_t *gang;
+    mepa_rc       rc = MEPA_RC_OK;
+    uint32_t      i;
+
+    if (rst_conf->reset_point != MEPA_RESET_POINT_DEFAULT && rst_conf->reset_point != MEPA_RESET_POINT_PRE) {
+        return MEPA_RC_OK;
+    }
+
+    MEPA_ENTER(dev);
+    gang = AQR_PRIV(dev)->fw_gang;
+    for (i = 0; gang != NULL && i < gang->cnt; i++) {
+        if (gang->ports[i].dev != dev) {
+            continue;
+        }
+        if (!gang->loaded) {
+            (void)aqr_fw_load_private(&gang->conf, gang->ports, gang->cnt, &gang->load_ms);
+            gang->loaded = TRUE;
+        }
+        rc = gang->ports[i].rc;
+        break;
+    }
+    MEPA_EXIT(dev);
+    return rc;
+}
+
 static mesa_rc aqr_407_if_set(mepa_device_t *dev,
                               mesa_port_interface_t mac_if)
 {
@@ -465,13 +759,13 @@ static mesa_rc aqr_407_if_set(mepa_device_t *dev,
         return aqr_fw_check(data,
                             BUILT_IN_AQR_24_FW_MAJOR_REV_NUM,
                             BUILT_IN_AQR_24_FW_MINOR_REV_NUM,
-                            BUILT_IN_AQR_24_FW_BUILD_ID_NUM);
+                            BUILT_IN_AQR_24_FW_BUILD_ID_NUM, NULL);
     } else {
         // Board JAGUAR2_REF side board or other platform
         return aqr_fw_check(data,
                             BUILT_IN_AQR_4_FW_MAJOR_REV_NUM,
                             BUILT_IN_AQR_4_FW_MINOR_REV_NUM,
-                            BUILT_IN_AQR_4_FW_BUILD_ID_NUM);
+                            BUILT_IN_AQR_4_FW_BUILD_ID_NUM, NULL);
     }
 }
 
@@ -486,7 +780,7 @@ static mesa_rc aqr_gen3a_if_set(mepa_device_t *dev,
     return aqr_fw_check(data,
                         BUILT_IN_AQR_4_G3A_FW_MAJOR_REV_NUM,
                         BUILT_IN_AQR_4_G3A_FW_MINOR_REV_NUM,
-                        BUILT_IN_AQR_4_G3A_FW_BUILD_ID_NUM);
+                        BUILT_IN_AQR_4_G3A_FW_BUILD_ID_NUM, NULL);
 }
 
 static mesa_rc aqr_gen3b_if_set(mepa_device_t *dev,
@@ -500,65 +794,8 @@ static mesa_rc aqr_gen3b_if_set(mepa_device_t *dev,
     return aqr_fw_check(data,
                         BUILT_IN_AQR_4_G3B_FW_MAJOR_REV_NUM,
                         BUILT_IN_AQR_4_G3B_FW_MINOR_REV_NUM,
-                        BUILT_IN_AQR_4_G3B_FW_BUILD_ID_NUM);
-}
-
-#if 0
-static void aqr_daisy_chain_reset(const mesa_inst_t     inst,
-                                  const mesa_port_no_t  dc_master_port,
-                                  const meba_inst_t     board_inst,
-                                  AQ_Port               *data)
-{
-    mesa_port_map_t   port_map;
-    mesa_port_no_t    dc_master_chip_port;
-    mesa_port_no_t    port_no;
-    mesa_port_no_t    port_start_no;
-    mesa_port_no_t    port_end_no = 0;
-    meba_port_entry_t entry;
-
-    T_D("enter, aqr_daisy_chain_reset");
-
-    board_inst->api.meba_port_entry_get(board_inst, dc_master_port, &entry);
-    port_map = entry.map;
-    dc_master_chip_port = port_map.chip_port;
-
-    if (board_inst->props.board_type == VTSS_BOARD_JAGUAR2_REF) {
-        port_start_no = 24;
-        port_end_no = 28;
-    } else if (board_inst->props.board_type == VTSS_BOARD_JAGUAR2_AQR_REF) {
-        port_start_no = 0;
-        port_end_no = 24;
-    } else {
-        T_E("board_type is wrong!");
-        return;
-    }
-
-    for (port_no = port_start_no; port_no < port_end_no; port_no++) {
-        board_inst->api.meba_port_entry_get(board_inst, port_no, &entry);
-        port_map = entry.map;
-        if (port_no == dc_master_port) {
-            continue;
-        }
-
-        T_D("daisy chain reset port_no: %d", port_no);
-
-        uint16_t reg_value;
-        uint16_t hop_count;
-        // Refer to AN-N2101_FirmwareOverview_v1.0.pdf, the daisy-chain reset must follwoing chip port order,
-        // otherwise the firmware provisioning will be incorrect and make MDIO can't be accessed.
-        // An alternative method to ensure correct provisioning is to override the hop-count value to specifc port.
-        hop_count = port_map.chip_port - dc_master_chip_port;
-        data->mmd_read(inst, port_no, 0x1e, 0xc471, &reg_value);
-        // override the hop-count via writing 1E.C471.6:0
-        reg_value |= (hop_count | 1 << 6);
-        data->mmd_write(inst, port_no, 0x1e, 0xc471, reg_value);
-        // Reset daisy chain via toggling 1E.C442.0
-        data->mmd_read(inst, port_no, 0x1e, 0xc442, &reg_value);
-        reg_value ^= 0x1;
-        data->mmd_write(inst, port_no, 0x1e, 0xc442, reg_value);
-    }
+                        BUILT_IN_AQR_4_G3B_FW_BUILD_ID_NUM, NULL);
 }
-#endif
 
 static mepa_device_t *aqr_probe(mepa_driver_t *drv,
                                 const mepa_callout_t    MEPA_SHARED_PTR *callout,
@@ -648,11 +885,13 @@ mepa_drivers_t mepa_aqr_driver_init()
     aqr_drivers[0].mepa_driver_delete = aqr_delete;
     aqr_drivers[0].mepa_driver_poll = aqr_poll;
     aqr_drivers[0].mepa_driver_conf_set = aqr_conf_set;
+    aqr_drivers[0].mepa_driver_conf_update = aqr_conf_update;
     aqr_drivers[0].mepa_driver_if_set = aqr_407_if_set;
     aqr_drivers[0].mepa_driver_if_get = aqr_if_get;
     aqr_drivers[0].mepa_driver_cable_diag_start = aqr_veriphy_start;
     aqr_drivers[0].mepa_driver_cable_diag_get = aqr_veriphy_get;
     aqr_drivers[0].mepa_driver_probe = aqr_probe;
+    aqr_drivers[0].mepa_driver_reset = aqr_reset;
     aqr_drivers[0].mepa_driver_aneg_status_get = aqr_status_1g_get;
     aqr_drivers[0].mepa_driver_phy_info_get = aqr_info_get;
     aqr_drivers[0].mepa_driver_clause45_read  = aqr_mmd_read;
@@ -663,11 +902,13 @@ mepa_drivers_t mepa_aqr_driver_init()
     aqr_drivers[1].mepa_driver_delete = aqr_delete;
     aqr_drivers[1].mepa_driver_poll = aqr_poll;
     aqr_drivers[1].mepa_driver_conf_set = aqr_conf_set;
+    aqr_drivers[1].mepa_driver_conf_update = aqr_conf_update;
     aqr_drivers[1].mepa_driver_if_set = aqr_407_if_set;
     aqr_drivers[1].mepa_driver_if_get = aqr_if_get;
     aqr_drivers[1].mepa_driver_cable_diag_start = aqr_veriphy_start;
     aqr_drivers[1].mepa_driver_cable_diag_get = aqr_veriphy_get;
     aqr_drivers[1].mepa_driver_probe = aqr_probe;
+    aqr_drivers[1].mepa_driver_reset = aqr_reset;
     aqr_drivers[1].mepa_driver_aneg_status_get = aqr_status_1g_get;
     aqr_drivers[1].mepa_driver_phy_info_get = aqr_info_get,
 
@@ -676,11 +917,13 @@ mepa_drivers_t mepa_aqr_driver_init()
     aqr_drivers[2].mepa_driver_delete = aqr_delete;
     aqr_drivers[2].mepa_driver_poll = aqr_poll;
     aqr_drivers[2].mepa_driver_conf_set = aqr_conf_set;
+    aqr_drivers[2].mepa_driver_conf_update = aqr_conf_update;
     aqr_drivers[2].mepa_driver_if_set = aqr_407_if_set;
     aqr_drivers[2].mepa_driver_if_get = aqr_if_get;
     aqr_drivers[2].mepa_driver_cable_diag_start = aqr_veriphy_start;
     aqr_drivers[2].mepa_driver_cable_diag_get = aqr_veriphy_get;
     aqr_drivers[2].mepa_driver_probe = aqr_probe;
+    aqr_drivers[2].mepa_driver_reset = aqr_reset;
     aqr_drivers[2].mepa_driver_aneg_status_get = aqr_status_1g_get;
     aqr_drivers[2].mepa_driver_phy_info_get = aqr_info_get,
 
@@ -690,11 +933,13 @@ mepa_drivers_t mepa_aqr_driver_init()
     aqr_drivers[3].mepa_driver_delete = aqr_delete;
     aqr_drivers[3].mepa_driver_poll = aqr_poll;
     aqr_drivers[3].mepa_driver_conf_set = aqr_409_conf_set;
+    aqr_drivers[3].mepa_driver_conf_update = aqr_409_conf_update;
     aqr_drivers[3].mepa_driver_if_set = aqr_407_if_set;
     aqr_drivers[3].mepa_driver_if_get = aqr_409_if_get;
     aqr_drivers[3].mepa_driver_cable_diag_start = aqr_veriphy_start;
     aqr_drivers[3].mepa_driver_cable_diag_get = aqr_veriphy_get;
     aqr_drivers[3].mepa_driver_probe = aqr_probe;
+    aqr_drivers[3].mepa_driver_reset = aqr_reset;
     aqr_drivers[3].mepa_driver_aneg_status_get = aqr_status_1g_get;
     aqr_drivers[3].mepa_driver_phy_info_get = aqr_info_get,
 
@@ -703,11 +948,13 @@ mepa_drivers_t mepa_aqr_driver_init()
     aqr_drivers[4].mepa_driver_delete = aqr_delete;
     aqr_drivers[4].mepa_driver_poll = aqr_poll;
     aqr_drivers[4].mepa_driver_conf_set = aqr_409_conf_set;
+    aqr_drivers[4].mepa_driver_conf_update = aqr_409_conf_update;
     aqr_drivers[4].mepa_driver_if_set = aqr_407_if_set;
     aqr_drivers[4].mepa_driver_if_get = aqr_409_if_get;
     aqr_drivers[4].mepa_driver_cable_diag_start = aqr_veriphy_start;
     aqr_drivers[4].mepa_driver_cable_diag_get = aqr_veriphy_get;
     aqr_drivers[4].mepa_driver_probe = aqr_probe;
+    aqr_drivers[4].mepa_driver_reset = aqr_reset;
     aqr_drivers[4].mepa_driver_aneg_status_get = aqr_status_1g_get;
     aqr_drivers[4].mepa_driver_phy_info_get = aqr_info_get,
 
@@ -717,11 +964,13 @@ mepa_drivers_t mepa_aqr_driver_init()
     aqr_drivers[5].mepa_driver_delete = aqr_delete;
     aqr_drivers[5].mepa_driver_poll = aqr_poll;
     aqr_drivers[5].mepa_driver_conf_set = aqr_conf_set;
+    aqr_drivers[5].mepa_driver_conf_update = aqr_conf_update;
     aqr_drivers[5].mepa_driver_if_set = aqr_gen3a_if_set;
     aqr_drivers[5].mepa_driver_if_get = aqr_if_get;
     aqr_drivers[5].mepa_driver_cable_diag_start = aqr_veriphy_start;
     aqr_drivers[5].mepa_driver_cable_diag_get = aqr_veriphy_get;
     aqr_drivers[5].mepa_driver_probe = aqr_probe;
+    aqr_drivers[5].mepa_driver_reset = aqr_reset;
     aqr_drivers[5].mepa_driver_aneg_status_get = aqr_status_1g_get;
     aqr_drivers[5].mepa_driver_phy_info_get = aqr_info_get,
 
@@ -730,11 +979,13 @@ mepa_drivers_t mepa_aqr_driver_init()
     aqr_drivers[6].mepa_driver_delete = aqr_delete;
     aqr_drivers[6].mepa_driver_poll = aqr_poll;
     aqr_drivers[6].mepa_driver_conf_set = aqr_conf_set;
+    aqr_drivers[6].mepa_driver_conf_update = aqr_conf_update;
     aqr_drivers[6].mepa_driver_if_set = aqr_gen3a_if_set;
     aqr_drivers[6].mepa_driver_if_get = aqr_if_get;
     aqr_drivers[6].mepa_driver_cable_diag_start = aqr_veriphy_start;
     aqr_drivers[6].mepa_driver_cable_diag_get = aqr_veriphy_get;
     aqr_drivers[6].mepa_driver_probe = aqr_probe;
+    aqr_drivers[6].mepa_driver_reset = aqr_reset;
     aqr_drivers[6].mepa_driver_aneg_status_get = aqr_status_1g_get;
     aqr_drivers[6].mepa_driver_phy_info_get = aqr_info_get,
 
@@ -743,11 +994,13 @@ mepa_drivers_t mepa_aqr_driver_init()
     aqr_drivers[7].mepa_driver_delete = aqr_delete;
     aqr_drivers[7].mepa_driver_poll = aqr_poll;
     aqr_drivers[7].mepa_driver_conf_set = aqr_conf_set;
+    aqr_drivers[7].mepa_driver_conf_update = aqr_conf_update;
     aqr_drivers[7].mepa_driver_if_set = aqr_gen3b_if_set;
     aqr_drivers[7].mepa_driver_if_get = aqr_if_get;
     aqr_drivers[7].mepa_driver_cable_diag_start = aqr_veriphy_start;
     aqr_drivers[7].mepa_driver_cable_diag_get = aqr_veriphy_get;
     aqr_drivers[7].mepa_driver_probe = aqr_probe;
+    aqr_drivers[7].mepa_driver_reset = aqr_reset;
     aqr_drivers[7].mepa_driver_aneg_status_get = aqr_status_1g_get;
     aqr_drivers[7].mepa_driver_phy_info_get = aqr_info_get,
 
@@ -757,11 +1010,13 @@ mepa_drivers_t mepa_aqr_driver_init()
     aqr_drivers[8].mepa_driver_delete = aqr_delete;
     aqr_drivers[8].mepa_driver_poll = aqr_poll;
     aqr_drivers[8].mepa_driver_conf_set = aqr_conf_set;
+    aqr_drivers[8].mepa_driver_conf_update = aqr_conf_update;
     aqr_drivers[8].mepa_driver_if_set = aqr_gen3a_if_set;
     aqr_drivers[8].mepa_driver_if_get = aqr_if_get;
     aqr_drivers[8].mepa_driver_cable_diag_start = aqr_veriphy_start;
     aqr_drivers[8].mepa_driver_cable_diag_get = aqr_veriphy_get;
     aqr_drivers[8].mepa_driver_probe = aqr_probe;
+    aqr_drivers[8].mepa_driver_reset = aqr_reset;
     aqr_drivers[8].mepa_driver_aneg_status_get = aqr_status_1g_get;
     aqr_drivers[8].mepa_driver_phy_info_get = aqr_info_get,
 
@@ -770,11 +1025,13 @@ mepa_drivers_t mepa_aqr_driver_init()
     aqr_drivers[9].mepa_driver_delete = aqr_delete;
     aqr_drivers[9].mepa_driver_poll = aqr_poll;
     aqr_drivers[9].mepa_driver_conf_set = aqr_conf_set;
+    aqr_drivers[9].mepa_driver_conf_update = aqr_conf_update;
     aqr_drivers[9].mepa_driver_if_set = aqr_gen3a_if_set;
     aqr_drivers[9].mepa_driver_if_get = aqr_if_get;
     aqr_drivers[9].mepa_driver_cable_diag_start = aqr_veriphy_start;
     aqr_drivers[9].mepa_driver_cable_diag_get = aqr_veriphy_get;
     aqr_drivers[9].mepa_driver_probe = aqr_probe;
+    aqr_drivers[9].mepa_driver_reset = aqr_reset;
     aqr_drivers[9].mepa_driver_aneg_status_get = aqr_status_1g_get;
     aqr_drivers[9].mepa_driver_phy_info_get = aqr_info_get,
 
@@ -783,11 +1040,13 @@ mepa_drivers_t mepa_aqr_driver_init()
     aqr_drivers[10].mepa_driver_delete = aqr_delete;
     aqr_drivers[10].mepa_driver_poll = aqr_poll;
     aqr_drivers[10].mepa_driver_conf_set = aqr_conf_set;
+    aqr_drivers[10].mepa_driver_conf_update = aqr_conf_update;
     aqr_drivers[10].mepa_driver_if_set = aqr_gen3b_if_set;
     aqr_drivers[10].mepa_driver_if_get = aqr_if_get;
     aqr_drivers[10].mepa_driver_cable_diag_start = aqr_veriphy_start;
     aqr_drivers[10].mepa_driver_cable_diag_get = aqr_veriphy_get;
     aqr_drivers[10].mepa_driver_probe = aqr_probe;
+    aqr_drivers[10].mepa_driver_reset = aqr_reset;
     aqr_drivers[10].mepa_driver_aneg_status_get = aqr_status_1g_get;
     aqr_drivers[10].mepa_driver_phy_info_get = aqr_info_get,
 
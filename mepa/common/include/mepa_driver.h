@@ -87,6 +87,25 @@ typedef mepa_rc (*mepa_driver_poll_t)(
 typedef mepa_rc (*mepa_driver_conf_set_t)(
     struct mepa_device *dev, const mepa_conf_t *conf);
 
+/**
+ * \brief Apply the changed part of the PHY configuration.
+ *
+ * Optional. Called by mepa_conf_set() instead of mepa_driver_conf_set when
+ * the configuration differs from the previous one, with the changed fields
+ * in chg. The driver may skip the hardware setup of unchanged fields, and
+ * should only restart auto-negotiation when MEPA_CONF_CHG_LINK is set.
+ *
+ * \param dev  [IN]   Driver Instance.
+ * \param conf [IN]   PHY configuration.
+ * \param chg  [IN]   Changed fields, MEPA_CONF_CHG_xxx.
+ *
+ * \return
+ *   MEPA_RC_OK on success.\n
+ *   MEPA_RC_ERROR on error.
+ **/
+typedef mepa_rc (*mepa_driver_conf_update_t)(
+    struct mepa_device *dev, const mepa_conf_t *conf, mepa_conf_change_t chg);
+
 /**
  * \brief Get the current interface configuraton of the PHY.
  *
@@ -519,6 +538,28 @@ typedef mepa_rc (*mepa_driver_isolate_mode_conf_t)(struct mepa_device *dev, cons
  *    MEPA_RC_OK on success.
  **/
 typedef mepa_rc (*mepa_driver_chip_temp_get_t)(struct mepa_device *dev, i16 *const temp);
+
+/**
+ *  \brief Set the chip temperature sampling period.
+ *  \param dev        [IN]    Driver instance.
+ *  \param period_sec [IN]    Sampling period in seconds.
+ *
+ *  \return
+ *    MEPA_RC_NOT_IMPLEMENTED when not supported.\n
+ *    MEPA_RC_OK on success.
+ **/
+typedef mepa_rc (*mepa_driver_chip_temp_period_set_t)(struct mepa_device *dev, const uint32_t period_sec);
+
+/**
+ *  \brief Get the age of the chip temperature.
+ *  \param dev     [IN]    Driver instance.
+ *  \param age_sec [OUT]   Seconds since the sensor conversion was started.
+ *
+ *  \return
+ *    MEPA_RC_NOT_IMPLEMENTED when not supported.\n
+ *    MEPA_RC_OK on success.
+ **/
+typedef mepa_rc (*mepa_driver_chip_temp_age_get_t)(struct mepa_device *dev, uint32_t *const age_sec);
 /**
  * \brief  Debug dump API for PHY.
  *
@@ -534,6 +575,19 @@ typedef mepa_rc (*mepa_debug_info_dump_t)(struct mepa_device *dev,
                              const mepa_debug_print_t pr,
                              const mepa_debug_info_t   *const info);
 
+/**
+ * \brief  Binary register snapshot.
+ *
+ * \param dev  [IN]     Driver instance.
+ * \param snap [IN/OUT] Snapshot buffer and position.
+ *
+ * \return
+ *   MEPA_RC_NOT_IMPLEMENTED when not supported.\n
+ *   MEPA_RC_OK on success.
+ **/
+typedef mepa_rc (*mepa_reg_snapshot_get_t)(struct mepa_device *dev,
+                                           mepa_reg_snapshot_t *const snap);
+
 /**
  * \brief I2C Read - perform i2C I/O thru PHY for Reading SFP using i2C i/f
  *
@@ -800,6 +854,7 @@ typedef struct mepa_driver {
     mepa_driver_poll_t                 mepa_driver_poll;
     mepa_capability_t                  mepa_capability;
     mepa_driver_conf_set_t             mepa_driver_conf_set;
+    mepa_driver_conf_update_t          mepa_driver_conf_update;
     mepa_driver_conf_get_t             mepa_driver_conf_get;
     mepa_driver_if_set_t               mepa_driver_if_set;
     mepa_driver_if_get_t               mepa_driver_if_get;
@@ -827,10 +882,13 @@ typedef struct mepa_driver {
     mepa_driver_phy_info_get_t         mepa_driver_phy_info_get;
     mepa_driver_isolate_mode_conf_t    mepa_driver_isolate_mode_conf;
     mepa_driver_chip_temp_get_t        mepa_driver_chip_temp_get;
+    mepa_driver_chip_temp_period_set_t mepa_driver_chip_temp_period_set;
+    mepa_driver_chip_temp_age_get_t    mepa_driver_chip_temp_age_get;
     mepa_driver_eee_mode_conf_set_t    mepa_driver_eee_mode_conf_set;
     mepa_driver_eee_mode_conf_get_t    mepa_driver_eee_mode_conf_get;
     mepa_driver_eee_status_get_t       mepa_driver_eee_status_get;
     mepa_debug_info_dump_t             mepa_debug_info_dump;
+    mepa_reg_snapshot_get_t            mepa_reg_snapshot_get;
     mepa_driver_phy_i2c_read_t         mepa_driver_phy_i2c_read;
     mepa_driver_phy_i2c_write_t        mepa_driver_phy_i2c_write;
     mepa_driver_phy_i2c_clock_select_t mepa_driver_phy_i2c_clock_select;
@@ -870,6 +928,9 @@ typedef struct mepa_device {
     struct mepa_callout_ctx *callout_ctx;
 
     void *data; /**< Private data */
+
+    mepa_conf_t conf;       /**< Last configuration applied by mepa_conf_set() */
+    mepa_bool_t conf_valid; /**< The conf field is valid */
 } mepa_device_t;
 
 /** \brief Wrapper over an array and counter. It is used by init functions to
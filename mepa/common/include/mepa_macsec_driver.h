@@ -62,6 +62,7 @@ typedef mepa_rc (*mepa_macsec_control_frame_match_conf_get_t)(struct mepa_device
 typedef mepa_rc (*mepa_macsec_pattern_set_t)(struct mepa_device *dev, const mepa_macsec_port_t port, const mepa_macsec_direction_t direction, const mepa_macsec_match_action_t action, const mepa_macsec_match_pattern_t *const pattern);
 typedef mepa_rc (*mepa_macsec_pattern_del_t)(struct mepa_device *dev, const mepa_macsec_port_t port, const mepa_macsec_direction_t direction, const mepa_macsec_match_action_t action);
 typedef mepa_rc (*mepa_macsec_pattern_get_t)(struct mepa_device *dev, const mepa_macsec_port_t port, const mepa_macsec_direction_t direction, const mepa_macsec_match_action_t action, mepa_macsec_match_pattern_t *const pattern);
+typedef mepa_rc (*mepa_macsec_txn_commit_t)(struct mepa_device *dev, const uint32_t cnt, const mepa_macsec_txn_secy_t *const secy, uint32_t *const failed);
 typedef mepa_rc (*mepa_macsec_default_action_set_t)(struct mepa_device *dev, const mepa_port_no_t port_no, const mepa_macsec_default_action_policy_t *const policy);
 typedef mepa_rc (*mepa_macsec_default_action_get_t)(struct mepa_device *dev, const mepa_port_no_t port_no, mepa_macsec_default_action_policy_t *const policy);
 typedef mepa_rc (*mepa_macsec_bypass_mode_set_t)(struct mepa_device *dev, const mepa_port_no_t port_no, const mepa_macsec_bypass_mode_t *const bypass);
@@ -72,12 +73,14 @@ typedef mepa_rc (*mepa_macsec_mtu_set_t)(struct mepa_device *dev, const mepa_por
 typedef mepa_rc (*mepa_macsec_mtu_get_t)(struct mepa_device *dev, const mepa_port_no_t port_no, mepa_macsec_mtu_t *mtu_conf);
 typedef mepa_rc (*mepa_macsec_frame_capture_set_t)(struct mepa_device *dev, const mepa_port_no_t port_no, const mepa_macsec_frame_capture_t capture);
 typedef mepa_rc (*mepa_macsec_frame_get_t)(struct mepa_device *dev, const mepa_port_no_t port_no, const uint32_t buf_length, uint32_t *const return_length, uint8_t *const frame);
+typedef mepa_rc (*mepa_macsec_frame_ring_get_t)(struct mepa_device *dev, const mepa_port_no_t port_no, mepa_macsec_capture_ring_t *const ring, uint32_t *const cnt);
 typedef mepa_rc (*mepa_macsec_event_enable_set_t)(struct mepa_device *dev, const mepa_port_no_t port_no, const mepa_macsec_event_t ev_mask, const mepa_bool_t enable);
 typedef mepa_rc (*mepa_macsec_event_enable_get_t)(struct mepa_device *dev, const mepa_port_no_t port_no, mepa_macsec_event_t *const ev_mask);
 typedef mepa_rc (*mepa_macsec_event_poll_t)(struct mepa_device *dev, const mepa_port_no_t port_no, mepa_macsec_event_t *const ev_mask);
 typedef mepa_rc (*mepa_macsec_event_seq_threshold_set_t)(struct mepa_device *dev, const mepa_port_no_t port_no, const uint32_t threshold);
 typedef mepa_rc (*mepa_macsec_event_seq_threshold_get_t)(struct mepa_device *dev, const mepa_port_no_t port_no, uint32_t *const threshold);
 typedef mepa_rc (*mepa_macsec_egr_intr_sa_get_t)(struct mepa_device *dev, const mepa_port_no_t port_no, mepa_macsec_port_t *const port, uint16_t *const an);
+typedef mepa_rc (*mepa_macsec_sa_event_poll_t)(struct mepa_device *dev, const uint32_t max_cnt, mepa_macsec_sa_event_t *const events, uint32_t *const cnt);
 typedef mepa_rc (*mepa_macsec_csr_read_t)(struct mepa_device *dev, const mepa_port_no_t port_no, const uint16_t mmd, const uint32_t addr, uint32_t *const value);
 typedef mepa_rc (*mepa_macsec_csr_write_t)(struct mepa_device *dev, const mepa_port_no_t port_no, const uint32_t mmd, const uint32_t addr, const uint32_t value);
 typedef mepa_rc (*mepa_macsec_dbg_counter_get_t)(struct mepa_device *dev, const mepa_port_no_t port_no, mepa_macsec_rc_dbg_counters_t *const counters);
@@ -167,6 +170,7 @@ typedef struct mepa_macsec_driver {
     mepa_macsec_pattern_set_t mepa_macsec_pattern_set;
     mepa_macsec_pattern_del_t mepa_macsec_pattern_del;
     mepa_macsec_pattern_get_t mepa_macsec_pattern_get;
+    mepa_macsec_txn_commit_t mepa_macsec_txn_commit;
     mepa_macsec_default_action_set_t mepa_macsec_default_action_set;
     mepa_macsec_default_action_get_t mepa_macsec_default_action_get;
     mepa_macsec_bypass_mode_set_t mepa_macsec_bypass_mode_set;
@@ -177,12 +181,14 @@ typedef struct mepa_macsec_driver {
     mepa_macsec_mtu_get_t mepa_macsec_mtu_get;
     mepa_macsec_frame_capture_set_t mepa_macsec_frame_capture_set;
     mepa_macsec_frame_get_t mepa_macsec_frame_get;
+    mepa_macsec_frame_ring_get_t mepa_macsec_frame_ring_get;
     mepa_macsec_event_enable_set_t mepa_macsec_event_enable_set;
     mepa_macsec_event_enable_get_t mepa_macsec_event_enable_get;
     mepa_macsec_event_poll_t mepa_macsec_event_poll;
     mepa_macsec_event_seq_threshold_set_t mepa_macsec_event_seq_threshold_set;
     mepa_macsec_event_seq_threshold_get_t mepa_macsec_event_seq_threshold_get;
     mepa_macsec_egr_intr_sa_get_t mepa_macsec_egr_intr_sa_get;
+    mepa_macsec_sa_event_poll_t mepa_macsec_sa_event_poll;
     mepa_macsec_csr_read_t mepa_macsec_csr_read;
     mepa_macsec_csr_write_t mepa_macsec_csr_write;
     mepa_macsec_dbg_counter_get_t mepa_macsec_dbg_counter_get;
@@ -69,6 +69,17 @@ static inline time_t MEPA_UPTIME_SECONDS(void)
     }
 }
 
+/** Monotonic time in nanoseconds, not subject to NTP slewing. 0 if not available */
+static inline uint64_t MEPA_UPTIME_NSEC(void)
+{
+    struct timespec time;
+    if (clock_gettime(CLOCK_MONOTONIC_RAW, &time) == 0) {
+        return ((uint64_t)time.tv_sec * 1000000000ULL) + time.tv_nsec;
+    } else {
+        return 0;
+    }
+}
+
 #define MEPA_LLABS(arg)               llabs(arg)
 #define MEPA_ABS(arg)                 abs(arg)
 
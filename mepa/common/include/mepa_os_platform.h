@@ -53,6 +53,9 @@ static inline time_t MEPA_UPTIME_SECONDS(void)
 }
 #endif
 
+/** Monotonic time in nanoseconds. The 32-bit system tick wraps too fast to be used, so 0 (not available) */
+#define MEPA_UPTIME_NSEC() ((uint64_t)0)
+
 #define MEPA_MTIMER_TIMEOUT(timer) (((((timer)->now = os_platform_get_system_time()) - (timer)->timeout) > 0)?(((timer)->now/TICKS_PER_MS_300MHZ > MAX_ALLOWED_TIME_DIFF)? MEPA_OS_TRUE:MEPA_OS_FALSE):MEPA_OS_FALSE) /**< Timer timeout macro */
 
 #define MEPA_MTIMER_START(timer, msec) { \
@@ -39,6 +39,9 @@ typedef struct {
     mepa_timeval_t now;
 } mepa_mtimer_t;
 
+/** Monotonic time in nanoseconds. 0 if not available */
+#define MEPA_UPTIME_NSEC() ((uint64_t)lm_os_ext_time_get())
+
 #define MEPA_TIMERCMP(time_a, time_b, cmp) ((time_a.tv_sec cmp time_b.tv_sec) ? 1 : 0)
 
 #define MEPA_MTIMER_START(timer, msec) { \
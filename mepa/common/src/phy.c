@@ -100,13 +100,85 @@ static size_t size_align(size_t s)
     return s;
 }
 
+// Memory arena, see mepa_arena_set()
+static struct {
+    char     *base;
+    size_t   size;
+    size_t   used;
+    size_t   last;     // Offset of the latest allocation
+    uint32_t live_cnt; // Allocations not freed yet
+    uint32_t alloc_cnt;
+    uint32_t fallback_cnt;
+} MEPA_arena;
+
+static size_t arena_align(size_t s)
+{
+    return ((s + MEPA_ARENA_ALIGN - 1) / MEPA_ARENA_ALIGN) * MEPA_ARENA_ALIGN;
+}
+
+static mepa_bool_t arena_owns(void *ptr)
+{
+    char *p = (char *)ptr;
+
+    return (MEPA_arena.base && p >= MEPA_arena.base && p < (MEPA_arena.base + MEPA_arena.size));
+}
+
+mepa_rc mepa_arena_set(void *base, size_t size)
+{
+    char   *p = (char *)base;
+    size_t skip;
+
+    if (MEPA_arena.used) {
+        T_E("Arena in use, %zu bytes allocated", MEPA_arena.used);
+        return MEPA_RC_ERROR;
+    }
+
+    memset(&MEPA_arena, 0, sizeof(MEPA_arena));
+    if (p == NULL) {
+        return MEPA_RC_OK;
+    }
+
+    // Start the arena on a cache line boundary
+    skip = (MEPA_ARENA_ALIGN - ((uintptr_t)p % MEPA_ARENA_ALIGN)) % MEPA_ARENA_ALIGN;
+    if (size <= skip) {
+        T_E("Arena too small: %zu", size);
+        return MEPA_RC_ERROR;
+    }
+    MEPA_arena.base = p + skip;
+    MEPA_arena.size = size - skip;
+    T_I("Arena at %p, size %zu", MEPA_arena.base, MEPA_arena.size);
+    return MEPA_RC_OK;
+}
+
+mepa_rc mepa_arena_status_get(mepa_arena_status_t *const status)
+{
+    status->size = MEPA_arena.size;
+    status->used = MEPA_arena.used;
+    status->alloc_cnt = MEPA_arena.alloc_cnt;
+    status->fallback_cnt = MEPA_arena.fallback_cnt;
+    return MEPA_RC_OK;
+}
+
 void *mepa_mem_alloc_int(const mepa_callout_t    MEPA_SHARED_PTR *callout,
                          struct mepa_callout_ctx MEPA_SHARED_PTR *callout_ctx,
                          size_t                                   size)
 {
     void *mem;
-    uint64_t *mem64;
-    size_t cnt;
+
+    if (MEPA_arena.base) {
+        size = arena_align(size);
+        if (size <= (MEPA_arena.size - MEPA_arena.used)) {
+            mem = MEPA_arena.base + MEPA_arena.used;
+            MEPA_arena.last = MEPA_arena.used;
+            MEPA_arena.used += size;
+            MEPA_arena.live_cnt++;
+            MEPA_arena.alloc_cnt++;
+            memset(mem, 0, size);
+            return mem;
+        }
+        MEPA_arena.fallback_cnt++;
+        T_W("Arena full, %zu bytes requested", size);
+    }
 
     if (!callout->mem_alloc) {
         T_E("No mem_alloc callout");
@@ -117,16 +189,11 @@ void *mepa_mem_alloc_int(const mepa_callout_t    MEPA_SHARED_PTR *callout,
 
     mem = callout->mem_alloc(callout_ctx, size);
     if (!mem) {
-        T_E("Out of memory? %z", size);
+        T_E("Out of memory? %zu", size);
         return 0;
     }
 
-    mem64 = (uint64_t *)mem;
-
-    size /= 8;
-    for (cnt = 0; cnt < size; cnt++) {
-        mem64[cnt] = 0;
-    }
+    memset(mem, 0, size);
 
     return mem;
 }
@@ -135,6 +202,18 @@ void mepa_mem_free_int(const mepa_callout_t    MEPA_SHARED_PTR *callout,
                        struct mepa_callout_ctx MEPA_SHARED_PTR *callout_ctx,
                        void                                    *ptr)
 {
+    if (arena_owns(ptr)) {
+        // Arena memory is owned by the application. The latest allocation is returned to the
+        // arena, and the arena is empty again when all its allocations are freed.
+        if (MEPA_arena.live_cnt && --MEPA_arena.live_cnt == 0) {
+            MEPA_arena.used = 0;
+        } else if ((char *)ptr == MEPA_arena.base + MEPA_arena.last) {
+            MEPA_arena.used = MEPA_arena.last;
+        }
+        MEPA_arena.last = MEPA_arena.used;
+        return;
+    }
+
     if (!callout->mem_free) {
         return;
     }
@@ -156,6 +235,11 @@ struct mepa_device *mepa_create_int(
     size_t dev_aligned = size_align(sizeof(mepa_device_t));
     size_t priv_aligned = size_align(size_of_private_data);
 
+    if (MEPA_arena.base) {
+        // Let the private data start on its own cache line
+        dev_aligned = arena_align(dev_aligned);
+    }
+
     mem = (char *)mepa_mem_alloc_int(callout, callout_ctx, dev_aligned + priv_aligned);
     if (!mem) {
         T_E("Alloc failed. Port: %d, size: %d", conf->numeric_handle, dev_aligned + priv_aligned);
@@ -287,6 +371,7 @@ mepa_rc mepa_reset(struct mepa_device *dev,
         return MESA_RC_NOT_IMPLEMENTED;
     }
 
+    dev->conf_valid = 0;
     return dev->drv->mepa_driver_reset(dev, rst_conf);
 }
 
@@ -300,14 +385,81 @@ mepa_rc mepa_poll(struct mepa_device *dev,
     return dev->drv->mepa_driver_poll(dev, status);
 }
 
+// Compare field by field, the structures may contain padding
+static mepa_conf_change_t mepa_conf_change(const mepa_conf_t *old, const mepa_conf_t *conf)
+{
+    const mepa_aneg_adv_t *a = &old->aneg, *b = &conf->aneg;
+    const phy10g_conf_t   *c = &old->conf_10g, *d = &conf->conf_10g;
+    mepa_conf_change_t    chg = 0;
+
+    if (old->speed != conf->speed || old->fdx != conf->fdx) {
+        chg |= MEPA_CONF_CHG_SPEED;
+    }
+    if (old->flow_control != conf->flow_control) {
+        chg |= MEPA_CONF_CHG_FLOW_CONTROL;
+    }
+    if (old->adv_dis != conf->adv_dis ||
+        a->speed_10m_hdx != b->speed_10m_hdx || a->speed_10m_fdx != b->speed_10m_fdx ||
+        a->speed_100m_hdx != b->speed_100m_hdx || a->speed_100m_fdx != b->speed_100m_fdx ||
+        a->speed_1g_fdx != b->speed_1g_fdx || a->speed_1g_hdx != b->speed_1g_hdx ||
+        a->tx_remote_fault != b->tx_remote_fault || a->speed_2g5_fdx != b->speed_2g5_fdx ||
+        a->speed_5g_fdx != b->speed_5g_fdx || a->speed_10g_fdx != b->speed_10g_fdx ||
+        a->no_restart_aneg != b->no_restart_aneg) {
+        chg |= MEPA_CONF_CHG_ADV;
+    }
+    if (old->admin.enable != conf->admin.enable) {
+        chg |= MEPA_CONF_CHG_ADMIN;
+    }
+    if (old->mac_if_aneg_ena != conf->mac_if_aneg_ena) {
+        chg |= MEPA_CONF_CHG_MAC_IF_ANEG;
+    }
+    if (old->man_neg != conf->man_neg) {
+        chg |= MEPA_CONF_CHG_MAN_NEG;
+    }
+    if (old->mdi_mode != conf->mdi_mode) {
+        chg |= MEPA_CONF_CHG_MDI_MODE;
+    }
+    if (old->force_ams_mode_sel != conf->force_ams_mode_sel) {
+        chg |= MEPA_CONF_CHG_FORCE_AMS;
+    }
+    if (c->oper_mode != d->oper_mode || c->interface_mode != d->interface_mode ||
+        c->channel_id != d->channel_id || c->h_media != d->h_media || c->l_media != d->l_media ||
+        c->channel_high_to_low != d->channel_high_to_low) {
+        chg |= MEPA_CONF_CHG_CONF_10G;
+    }
+    return chg;
+}
+
 mepa_rc mepa_conf_set(struct mepa_device *dev,
                       const mepa_conf_t *conf)
 {
+    mepa_conf_change_t chg = MEPA_CONF_CHG_ALL;
+    mepa_rc            rc;
+
     if (!dev || !dev->drv->mepa_driver_conf_set) {
         return MESA_RC_NOT_IMPLEMENTED;
     }
 
-    return dev->drv->mepa_driver_conf_set(dev, conf);
+    if (dev->conf_valid) {
+        chg = mepa_conf_change(&dev->conf, conf);
+        if (chg == 0) {
+            T_D("port %u: configuration unchanged", dev->numeric_handle);
+            return MEPA_RC_OK;
+        }
+    }
+
+    if (dev->drv->mepa_driver_conf_update) {
+        rc = dev->drv->mepa_driver_conf_update(dev, conf, chg);
+    } else {
+        rc = dev->drv->mepa_driver_conf_set(dev, conf);
+    }
+    if (rc == MEPA_RC_OK) {
+        dev->conf = *conf;
+        dev->conf_valid = 1;
+    } else {
+        dev->conf_valid = 0;
+    }
+    return rc;
 }
 
 mepa_rc mepa_conf_get(struct mepa_device *dev,
@@ -327,6 +479,7 @@ mepa_rc mepa_if_set(struct mepa_device *dev,
         return MESA_RC_NOT_IMPLEMENTED;
     }
 
+    dev->conf_valid = 0;
     return dev->drv->mepa_driver_if_set(dev, intf);
 }
 
@@ -348,6 +501,7 @@ mepa_rc mepa_power_set(struct mepa_device *dev,
         return MESA_RC_NOT_IMPLEMENTED;
     }
 
+    dev->conf_valid = 0;
     return dev->drv->mepa_driver_power_set(dev, power);
 }
 
@@ -378,6 +532,7 @@ mepa_rc mepa_media_set(struct mepa_device *dev,
         return MESA_RC_NOT_IMPLEMENTED;
     }
 
+    dev->conf_valid = 0;
     return dev->drv->mepa_driver_media_set(dev, phy_media_if);
 }
 
@@ -641,6 +796,22 @@ mepa_rc mepa_chip_temp_get(struct mepa_device *dev, i16 *const temp)
     return dev->drv->mepa_driver_chip_temp_get(dev, temp);
 }
 
+mepa_rc mepa_chip_temp_period_set(struct mepa_device *dev, const uint32_t period_sec)
+{
+    if (!dev || !dev->drv->mepa_driver_chip_temp_period_set) {
+        return MESA_RC_NOT_IMPLEMENTED;
+    }
+    return dev->drv->mepa_driver_chip_temp_period_set(dev, period_sec);
+}
+
+mepa_rc mepa_chip_temp_age_get(struct mepa_device *dev, uint32_t *const age_sec)
+{
+    if (!dev || !dev->drv->mepa_driver_chip_temp_age_get) {
+        return MESA_RC_NOT_IMPLEMENTED;
+    }
+    return dev->drv->mepa_driver_chip_temp_age_get(dev, age_sec);
+}
+
 mepa_rc mepa_eee_mode_conf_set(struct mepa_device *dev,  const mepa_phy_eee_conf_t conf)
 {
     if (!dev || !dev->drv->mepa_driver_eee_mode_conf_set) {
@@ -1215,6 +1386,21 @@ mepa_rc mepa_debug_info_dump(struct mepa_device *dev,
     return dev->drv->mepa_debug_info_dump(dev, pr, info);
 }
 
+mepa_rc mepa_reg_snapshot_get(struct mepa_device *dev,
+                              mepa_reg_snapshot_t *const snap)
+{
+    if (!dev || !dev->drv->mepa_reg_snapshot_get) {
+        return MESA_RC_NOT_IMPLEMENTED;
+    }
+
+    if (!snap->entry || !snap->size) {
+        return MEPA_RC_ERR_PARM;
+    }
+    snap->cnt = 0;
+    snap->done = 0;
+    return dev->drv->mepa_reg_snapshot_get(dev, snap);
+}
+
 mepa_rc mepa_sqi_read(struct mepa_device *dev, uint32_t *const value)
 {
     if (!dev->drv->mepa_driver_sqi_read) {
@@ -2172,6 +2358,22 @@ mepa_rc mepa_macsec_pattern_get(struct mepa_device *dev,
     return dev->drv->mepa_macsec->mepa_macsec_pattern_get(dev, port, direction, action, pattern);
 }
 
+mepa_rc mepa_macsec_txn_commit(struct mepa_device *dev,
+                               const uint32_t cnt,
+                               const mepa_macsec_txn_secy_t *const secy,
+                               uint32_t *const failed)
+{
+    if (!dev->drv->mepa_macsec) {
+        return MESA_RC_NOT_IMPLEMENTED;
+    }
+
+    if (!dev->drv->mepa_macsec->mepa_macsec_txn_commit) {
+        return MESA_RC_NOT_IMPLEMENTED;
+    }
+
+    return dev->drv->mepa_macsec->mepa_macsec_txn_commit(dev, cnt, secy, failed);
+}
+
 mepa_rc mepa_macsec_default_action_set(struct mepa_device *dev,
                                        const mepa_port_no_t port_no,
                                        const mepa_macsec_default_action_policy_t *const policy)
@@ -2324,6 +2526,22 @@ mepa_rc mepa_macsec_frame_get(struct mepa_device *dev,
     return dev->drv->mepa_macsec->mepa_macsec_frame_get(dev, port_no, buf_length, return_length, frame);
 }
 
+mepa_rc mepa_macsec_frame_ring_get(struct mepa_device *dev,
+                                   const mepa_port_no_t port_no,
+                                   mepa_macsec_capture_ring_t *const ring,
+                                   uint32_t *const cnt)
+{
+    if (!dev->drv->mepa_macsec) {
+        return MESA_RC_NOT_IMPLEMENTED;
+    }
+
+    if (!dev->drv->mepa_macsec->mepa_macsec_frame_ring_get) {
+        return MESA_RC_NOT_IMPLEMENTED;
+    }
+
+    return dev->drv->mepa_macsec->mepa_macsec_frame_ring_get(dev, port_no, ring, cnt);
+}
+
 mepa_rc mepa_macsec_event_enable_set(struct mepa_device *dev,
                                      const mepa_port_no_t port_no,
                                      const mepa_macsec_event_t ev_mask,
@@ -2416,6 +2634,22 @@ mepa_rc mepa_macsec_egr_intr_sa_get(struct mepa_device *dev,
     return dev->drv->mepa_macsec->mepa_macsec_egr_intr_sa_get(dev, port_no, port, an);
 }
 
+mepa_rc mepa_macsec_sa_event_poll(struct mepa_device *dev,
+                                  const uint32_t max_cnt,
+                                  mepa_macsec_sa_event_t *const events,
+                                  uint32_t *const cnt)
+{
+    if (!dev->drv->mepa_macsec) {
+        return MESA_RC_NOT_IMPLEMENTED;
+    }
+
+    if (!dev->drv->mepa_macsec->mepa_macsec_sa_event_poll) {
+        return MESA_RC_NOT_IMPLEMENTED;
+    }
+
+    return dev->drv->mepa_macsec->mepa_macsec_sa_event_poll(dev, max_cnt, events, cnt);
+}
+
 mepa_rc mepa_macsec_csr_read(struct mepa_device *dev,
                              const mepa_port_no_t port_no,
                              const uint16_t mmd,
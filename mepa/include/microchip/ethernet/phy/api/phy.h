@@ -178,6 +178,38 @@ typedef mepa_rc (*mepa_spi_write_64bit_t)(struct mepa_callout_ctx        ctx,
                                           uint64_t                       *const value);
 
 
+/** \brief Maximum number of operations in one SPI batch call */
+#define MEPA_SPI_BATCH_MAX 16
+
+/** \brief SPI 32bit register operation, used by mepa_spi_batch_t */
+typedef struct {
+    mepa_bool_t read;   /**< Read (TRUE) or write (FALSE) */
+    uint8_t     mmd;    /**< MMD register */
+    uint16_t    addr;   /**< Register address (0-65535) */
+    uint32_t    *value; /**< Read: Value read, write: Value to write */
+} mepa_spi_op_t;
+
+/**
+ * \brief SPI 32bit batch read/write function
+ *
+ *   Execute a sequence of register operations in order, allowing the
+ *   implementation to combine them into fewer bus transactions.
+ *   The callout is optional. When not provided, spi_read/spi_write are used.
+ *
+ * \param ctx     [IN]    Pointer to a callout structure
+ * \param port_no [IN]    Port Number
+ * \param cnt     [IN]    Number of operations (1-MEPA_SPI_BATCH_MAX).
+ * \param ops     [INOUT] Operations.
+ *
+ * \return
+ *   MEPA_RC_NOT_IMPLEMENTED when not supported.\n
+ *   MEPA_RC_OK on success.
+ **/
+typedef mepa_rc (*mepa_spi_batch_t)(struct mepa_callout_ctx        *ctx,
+                                    mepa_port_no_t                 port_no,
+                                    uint32_t                       cnt,
+                                    mepa_spi_op_t                  *const ops);
+
 typedef void (*mepa_trace_func_t)(const mepa_trace_data_t *data, va_list args);
 typedef void *(*mepa_mem_alloc_t)(struct mepa_callout_ctx *ctx, size_t size);
 typedef void (*mepa_mem_free_t)(struct mepa_callout_ctx *ctx, void *ptr);
@@ -213,6 +245,8 @@ typedef struct mepa_callout {
 
     mepa_mem_alloc_t       mem_alloc;
     mepa_mem_free_t        mem_free;
+
+    mepa_spi_batch_t       spi_batch;
 } mepa_callout_t;
 
 struct vtss_state_s;
@@ -259,6 +293,55 @@ struct mepa_device *mepa_create(const mepa_callout_t    MEPA_SHARED_PTR *callout
  **/
 mepa_rc mepa_delete(struct mepa_device *dev);
 
+/** \brief Alignment of allocations taken from the memory arena (cache line size) */
+#define MEPA_ARENA_ALIGN 64
+
+/** \brief Memory arena status */
+typedef struct {
+    size_t   size;          /**< Arena size in bytes */
+    size_t   used;          /**< Bytes allocated from the arena */
+    uint32_t alloc_cnt;     /**< Number of allocations served by the arena */
+    uint32_t fallback_cnt;  /**< Number of allocations served by the mem_alloc callout because the arena was full */
+} mepa_arena_status_t;
+
+/**
+ * \brief Use an application provided memory region for all MEPA allocations.
+ *
+ *   When an arena is set, device instances, driver private data and the vtss
+ *   state are carved sequentially from the region instead of calling the
+ *   'mem_alloc' callout. Devices created in port order are therefore laid out
+ *   contiguously per chip, and each block starts on a new cache line.
+ *   Memory taken from the arena is not returned by 'mem_free'; the region is
+ *   owned by the application. Freeing the latest arena allocation returns it
+ *   to the arena, and the arena is empty again when all its allocations are
+ *   freed, i.e. when all MEPA instances are deleted. Other freed arena memory
+ *   is only reused then. When the arena is full, the 'mem_alloc' callout is
+ *   used.
+ *
+ *   The arena is global and must be set before the first mepa_create() call.
+ *   MEPA allocations are not serialized by the arena; they are done from
+ *   mepa_create() and driver init functions, which the application must
+ *   call from one thread at a time.
+ *
+ * \param base [IN] Start of region, NULL to disable arena mode.
+ * \param size [IN] Size of region in bytes.
+ *
+ * \return
+ *   MEPA_RC_OK on success.\n
+ *   MEPA_RC_ERROR if the current arena is in use.
+ **/
+mepa_rc mepa_arena_set(void *base, size_t size);
+
+/**
+ * \brief Get memory arena status.
+ *
+ * \param status [OUT] Arena status.
+ *
+ * \return
+ *   MEPA_RC_OK on success.
+ **/
+mepa_rc mepa_arena_status_get(mepa_arena_status_t *const status);
+
 /**
  * \brief Resets PHY.
  *
@@ -377,6 +460,7 @@ mepa_rc mepa_cable_diag_start(struct mepa_device *dev,
  *
  * \return
  *   MEPA_RC_NOT_IMPLEMENTED when not supported.\n
+ *   MEPA_RC_INCOMPLETE while cable diagnostics is still running.\n
  *   MEPA_RC_OK on success.\n
  *   MEPA_RC_ERROR on error.
  **/
@@ -671,6 +755,28 @@ mepa_rc mepa_debug_info_dump(struct mepa_device *dev,
                              const mepa_debug_print_t pr,
                              const mepa_debug_info_t   *const info);
 
+/**
+ * \brief  Binary register snapshot.
+ *
+ * Reads the registers covered by mepa_debug_info_dump() into a compact
+ * (block, address, value) buffer, leaving the decoding to host side tools.
+ * The driver lock is released between register blocks, so taking a
+ * snapshot does not stall other PHY operations for the full duration.
+ *
+ * Set snap->cursor to zero and call until snap->done is set. Each call
+ * fills at most snap->size entries and advances snap->cursor.
+ *
+ * \param dev  [IN]     Driver instance.
+ * \param snap [IN/OUT] Snapshot buffer and position.
+ *
+ * \return
+ *   MEPA_RC_NOT_IMPLEMENTED when not supported.\n
+ *   MEPA_RC_ERR_PARM when the buffer is empty.\n
+ *   MEPA_RC_OK on success.
+ **/
+mepa_rc mepa_reg_snapshot_get(struct mepa_device *dev,
+                              mepa_reg_snapshot_t *const snap);
+
 /** - I2C ---------------------------------------------------- */
 /**
  * \brief I2C Read - perform i2C I/O thru PHY for Reading SFP using i2C i/f
@@ -813,6 +919,33 @@ mepa_rc mepa_fefi_detect(struct mepa_device *dev,
  **/
 mepa_rc mepa_chip_temp_get(struct mepa_device *dev, int16_t *const temp);
 
+/**
+ *  \brief Set the chip temperature sampling period.
+ *  \Drivers supporting it keep one sensor conversion in flight per chip, and
+ *  \mepa_chip_temp_get() returns the last sampled temperature until it is older
+ *  \than the period. Zero makes mepa_chip_temp_get() wait for a new conversion.
+ *
+ *  \param dev        [IN]    Driver instance.
+ *  \param period_sec [IN]    Sampling period in seconds.
+ *
+ *  \return
+ *    MEPA_RC_NOT_IMPLEMENTED when not supported.\n
+ *    MEPA_RC_OK on success.
+ **/
+mepa_rc mepa_chip_temp_period_set(struct mepa_device *dev, const uint32_t period_sec);
+
+/**
+ *  \brief Get the age of the temperature returned by mepa_chip_temp_get().
+ *
+ *  \param dev     [IN]    Driver instance.
+ *  \param age_sec [OUT]   Seconds since the sensor conversion was started.
+ *
+ *  \return
+ *    MEPA_RC_NOT_IMPLEMENTED when not supported.\n
+ *    MEPA_RC_OK on success.
+ **/
+mepa_rc mepa_chip_temp_age_get(struct mepa_device *dev, uint32_t *const age_sec);
+
 /**
  * \The energy efficient ethernet (EEE) helps in reducing the power consumption on physical layer devices. Configuring
  * \these EEE on interfaces includes enabling EEE on Base-T copper ethernet port based on the power utilization and
@@ -0,0 +1,77 @@
+// Copyright (c) 2004-2020 Microchip Technology Inc. and its subsidiaries.
+// SPDX-License-Identifier: MIT
+
+#ifndef _MEPA_AQR_API_H_
+#define _MEPA_AQR_API_H_
+
+#include <microchip/ethernet/phy/api/types.h>
+#include <microchip/ethernet/hdr_start.h>  /**< ALL INCLUDE ABOVE THIS LINE */
+
+/* AQR firmware gang-load, only available when the AQR driver is built */
+
+/** \brief Maximum number of PHYs in one gang-load operation */
+#define MEPA_AQR_FW_LOAD_PORT_MAX 48
+
+/** \brief AQR firmware load configuration */
+typedef struct {
+    const uint8_t *image;         /**< Firmware image (incl. trailing CRC-16) */
+    uint32_t       image_size;    /**< Size of image in bytes */
+    uint8_t        major;         /**< Expected firmware major revision */
+    uint8_t        minor;         /**< Expected firmware minor revision */
+    uint8_t        build;         /**< Expected firmware build (ROM) id */
+    uint8_t        gang_addr;     /**< MDIO address used while in gang-load mode */
+    mepa_device_t *gang_dev;      /**< Device whose callout addresses gang_addr on the shared MDIO bus */
+} mepa_aqr_fw_load_conf_t;
+
+/** \brief Per-PHY AQR firmware load entry */
+typedef struct {
+    mepa_device_t *dev;           /**< PHY to provision */
+    uint32_t       prov_addr;     /**< Provisioning (daisy-chain) address, 0-47 */
+    mepa_rc        rc;            /**< OUT: Result for this PHY */
+    mepa_bool_t    skipped;       /**< OUT: PHY already runs the expected firmware */
+    uint32_t       check_ms;      /**< OUT: Time spent reading the firmware version */
+} mepa_aqr_fw_load_port_t;
+
+/**
+ * \brief Load firmware into all PHYs on an MDIO bus in one gang-load operation.
+ *
+ * PHYs already running the expected firmware are skipped. The remaining PHYs
+ * get a daisy-chain reset with their provisioning address, are moved to
+ * conf->gang_addr and are loaded simultaneously, after which each PHY reports
+ * its own mailbox CRC result.
+ *
+ * \param conf    [IN]     Image and gang-load configuration.
+ * \param ports   [IN/OUT] Array of PHYs to load, in chip port order, with per-PHY results.
+ * \param cnt     [IN]     Number of entries in ports.
+ * \param load_ms [OUT]    Time spent in the gang-load, common for all loaded PHYs.
+ *
+ * \return MEPA_RC_OK if all PHYs run the expected firmware afterwards, otherwise MEPA_RC_ERROR.
+ **/
+mepa_rc mepa_aqr_fw_load(const mepa_aqr_fw_load_conf_t *conf,
+                         mepa_aqr_fw_load_port_t       *ports,
+                         uint32_t                      cnt,
+                         uint32_t                      *const load_ms);
+
+/**
+ * \brief Register PHYs to be gang-loaded from the reset path.
+ *
+ * The first mepa_reset() of a PHY in the set loads all PHYs of the set as done
+ * by mepa_aqr_fw_load(). The mepa_reset() of each PHY returns the load result
+ * of that PHY.
+ *
+ * Each MDIO bus has its own set, owned by conf->gang_dev. Registering a new set
+ * with the same gang_dev replaces the previous one, and a PHY can only be in one
+ * set. Deleting a PHY removes it from its set, deleting gang_dev unregisters the set.
+ *
+ * \param conf  [IN] Image and gang-load configuration.
+ * \param ports [IN] Array of PHYs to load, in chip port order.
+ * \param cnt   [IN] Number of entries in ports.
+ *
+ * \return MEPA_RC_OK if the set was registered, otherwise MEPA_RC_ERROR.
+ **/
+mepa_rc mepa_aqr_fw_load_reg(const mepa_aqr_fw_load_conf_t *conf,
+                             const mepa_aqr_fw_load_port_t *ports,
+                             uint32_t                      cnt);
+
+#include <microchip/ethernet/hdr_end.h>
+#endif /**< _MEPA_AQR_API_H_ */
@@ -979,6 +979,67 @@ mepa_rc mepa_macsec_pattern_get(struct mepa_device *dev,
                                 const mepa_macsec_match_action_t action,
                                 mepa_macsec_match_pattern_t *const pattern);
 
+/*--------------------------------------------------------------------*/
+/* Transactional SecY provisioning                                    */
+/*--------------------------------------------------------------------*/
+
+#define MEPA_MACSEC_TXN_PATTERN_MAX 6  /**< Matching patterns per SecY in a transaction, one per action and direction */
+#define MEPA_MACSEC_TXN_RX_SC_MAX   4  /**< Rx SCs per SecY in a transaction */
+
+/** \brief Matching pattern of a SecY in a transaction, see mepa_macsec_pattern_set() */
+typedef struct {
+    mepa_macsec_direction_t     direction;                    /**< Direction */
+    mepa_macsec_match_action_t  action;                       /**< Action */
+    mepa_macsec_match_pattern_t pattern;                      /**< Pattern */
+} mepa_macsec_txn_pattern_t;
+
+/** \brief SA of a SecY in a transaction. The AN is the index of the SA in its SC */
+typedef struct {
+    mepa_bool_t           enable;                             /**< Create the SA */
+    mepa_bool_t           activate;                           /**< Activate the SA */
+    mepa_macsec_pkt_num_t pn;                                 /**< Tx SA: Next PN. Rx SA: Lowest PN */
+    mepa_bool_t           confidentiality;                    /**< Tx SA only: Encrypt the frames */
+    mepa_macsec_sak_t     sak;                                /**< Secure Association Key */
+    mepa_macsec_ssci_t    ssci;                               /**< Short SCI, XPN cipher suites only */
+} mepa_macsec_txn_sa_t;
+
+/** \brief Rx SC of a SecY in a transaction */
+typedef struct {
+    mepa_macsec_sci_t    sci;                                 /**< SCI of the peer */
+    mepa_macsec_txn_sa_t sa[MEPA_MACSEC_SA_PER_SC];           /**< Rx SAs */
+} mepa_macsec_txn_rx_sc_t;
+
+/** \brief Complete configuration of a SecY in a transaction */
+typedef struct {
+    mepa_macsec_port_t        port;                           /**< MACsec port of the SecY */
+    mepa_macsec_secy_conf_t   conf;                           /**< SecY configuration */
+    uint32_t                  pattern_cnt;                    /**< Number of matching patterns */
+    mepa_macsec_txn_pattern_t pattern[MEPA_MACSEC_TXN_PATTERN_MAX]; /**< Matching patterns */
+    mepa_bool_t               controlled;                     /**< Enable the controlled port */
+    mepa_bool_t               tx_sc;                          /**< Create the Tx SC */
+    mepa_macsec_txn_sa_t      tx_sa[MEPA_MACSEC_SA_PER_SC];   /**< Tx SAs */
+    uint32_t                  rx_sc_cnt;                      /**< Number of Rx SCs */
+    mepa_macsec_txn_rx_sc_t   rx_sc[MEPA_MACSEC_TXN_RX_SC_MAX]; /**< Rx SCs */
+} mepa_macsec_txn_secy_t;
+
+/** Create a number of SecYs including their patterns, SCs and SAs as one transaction.
+ *  The SecYs may be on any of the ports handled by the same PHY instance as dev.
+ *  The complete transaction is validated before anything is written to the PHY,
+ *  and it is written under one lock hold. The result is the same as calling
+ *  mepa_macsec_secy_conf_add(), mepa_macsec_pattern_set(), mepa_macsec_secy_controlled_set(),
+ *  mepa_macsec_tx_sc_set(), mepa_macsec_rx_sc_add(), the SA set and the SA activate functions.
+ *  If any step fails, the SecYs created by the transaction are deleted again.
+ *
+ * \param dev    [IN]  Driver instance.
+ * \param cnt    [IN]  Number of SecYs.
+ * \param secy   [IN]  SecY configurations.
+ * \param failed [OUT] Index of the failing SecY, or cnt if all were created. May be NULL.
+ */
+mepa_rc mepa_macsec_txn_commit(struct mepa_device *dev,
+                               const uint32_t cnt,
+                               const mepa_macsec_txn_secy_t *const secy,
+                               uint32_t *const failed);
+
 
 /** \brief Default matching actions */
 typedef enum {
@@ -1121,6 +1182,52 @@ mepa_rc mepa_macsec_frame_get(struct mepa_device *dev,
                               uint32_t *const return_length,
                               uint8_t *const frame);
 
+/** \brief Frame retrieved from the capture buffer, see mepa_macsec_frame_ring_get() */
+typedef struct {
+    mepa_port_no_t              port_no;                                    /**< Port the frame was captured on */
+    mepa_macsec_frame_capture_t direction;                                  /**< MEPA_MACSEC_FRAME_CAPTURE_INGRESS or MEPA_MACSEC_FRAME_CAPTURE_EGRESS */
+    uint64_t                    timestamp;                                  /**< Time of retrieval from the capture buffer (MEPA_UPTIME_NSEC) */
+    mepa_bool_t                 truncated;                                  /**< Frame was truncated by the capture buffer or longer than MEPA_MACSEC_FRAME_CAPTURE_SIZE_MAX */
+    uint32_t                    debug_code;                                 /**< Security fail debug code */
+    uint32_t                    length;                                     /**< Number of bytes in frame, at most MEPA_MACSEC_FRAME_CAPTURE_SIZE_MAX */
+    uint8_t                     frame[MEPA_MACSEC_FRAME_CAPTURE_SIZE_MAX];  /**< Frame data */
+} mepa_macsec_capture_frame_t;
+
+/** \brief Ring of captured frames, owned by the application.
+ *  head and tail are free running counters, the entry at (counter % size) is the next one
+ *  to write/read. The ring is empty when head == tail and full when head - tail == size. */
+typedef struct {
+    mepa_macsec_capture_frame_t *frame;     /**< Array of size entries */
+    uint32_t                    size;       /**< Number of entries in the frame array */
+    uint32_t                    head;       /**< Frames written, updated by mepa_macsec_frame_ring_get() */
+    uint32_t                    tail;       /**< Frames read, updated by the application */
+    uint32_t                    dropped;    /**< Frames dropped because the ring was full */
+} mepa_macsec_capture_ring_t;
+
+/** Move all frames in the capture buffer into a ring and re-arm capturing. Used for test/debugging.
+ *  Capturing must first be started with mepa_macsec_frame_capture_set(). Where mepa_macsec_frame_get()
+ *  returns only the first frame in the buffer, this drains every frame in the buffer before the
+ *  triggers are re-enabled, so calling it periodically keeps capturing frames.
+ *
+ *  Each call costs 1 status read and 4-6 trigger writes, plus 2 + ceil(length/4) CSR reads per
+ *  frame. 1G PHYs are accessed in the MACsec CSR batch mode. With a 2.5 MHz MDIO bus, this
+ *  is about 1.9 msec per 64 byte frame (~500 frames/sec) and 13 msec per 500 byte frame
+ *  (~75 frames/sec) on 1G PHYs, about twice the rate of mepa_macsec_frame_get().
+ *
+ * \param dev     [IN]     Driver instance.
+ * \param port_no [IN]     Port number.
+ * \param ring    [IN/OUT] Ring to add the frames to.
+ * \param cnt     [OUT]    Number of frames read from the capture buffer, including dropped ones.
+ *
+ * \return
+ *   MEPA_RC_OK when successful.\n
+ *   MEPA_RC_NOT_IMPLEMENTED when not supported.
+ */
+mepa_rc mepa_macsec_frame_ring_get(struct mepa_device *dev,
+                                   const mepa_port_no_t port_no,
+                                   mepa_macsec_capture_ring_t *const ring,
+                                   uint32_t *const cnt);
+
 /** \brief Enum for events  */
 typedef enum {
     MEPA_MACSEC_SEQ_NONE  = 0x0,
@@ -1175,6 +1282,37 @@ mepa_rc mepa_macsec_egr_intr_sa_get(struct mepa_device *dev,
                                     mepa_macsec_port_t *const port,
                                     uint16_t *const an);
 
+/** \brief Egress SA event, see mepa_macsec_sa_event_poll() */
+typedef struct {
+    mepa_macsec_port_t    port;                               /**< MACsec port of the SecY */
+    mepa_macsec_sci_t     sci;                                /**< SCI of the Tx SC */
+    uint16_t              an;                                 /**< Association number of the SA */
+    mepa_macsec_event_t   event;                              /**< MEPA_MACSEC_SEQ_THRESHOLD_EVENT or MEPA_MACSEC_SEQ_ROLLOVER_EVENT */
+    mepa_macsec_pkt_num_t next_pn;                            /**< Next PN of the SA */
+} mepa_macsec_sa_event_t;
+
+/** Get the Tx SAs with active sequence number events on all ports handled by the same
+ *  PHY instance as dev. The egress event status of each MACsec port is read and cleared
+ *  once, and the events are resolved to the active Tx SA of each SecY, so the SAs to
+ *  rekey are found without calling mepa_macsec_event_poll() and mepa_macsec_tx_sa_status_get()
+ *  for every port and SA. The events must be enabled with mepa_macsec_event_enable_set().
+ *
+ * \param dev     [IN]  Driver instance.
+ * \param max_cnt [IN]  Size of the events array.
+ * \param events  [OUT] SA events.
+ * \param cnt     [OUT] Number of SA events returned.
+ *
+ * \return
+ *   MEPA_RC_OK when all events are returned.\n
+ *   MEPA_RC_INCOMPLETE when more events are pending, call again to get them.
+ *   SAs on the port being resolved when the array got full may then be reported again.\n
+ *   MEPA_RC_NOT_IMPLEMENTED when not supported.
+ */
+mepa_rc mepa_macsec_sa_event_poll(struct mepa_device *dev,
+                                  const uint32_t max_cnt,
+                                  mepa_macsec_sa_event_t *const events,
+                                  uint32_t *const cnt);
+
 /**
  * \brief Chip register read
  *
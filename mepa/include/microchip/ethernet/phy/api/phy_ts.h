@@ -164,6 +164,7 @@ typedef struct {
     mepa_bool_t                   dly_req_recv_10byte_ts; /**< Store 10-byte ingress timestamp for delay request message. Used for auto delay req/response. */
     mepa_bool_t                   tx_auto_followup_ts; /**< If true, PHY will insert timestamp in follow-up message instead of generating interrupt to application. */
     mepa_mch_pch_t                mch_pch_conf; /**< Configuration for PCH and MCH. */
+    uint32_t                      ltc_read_interval_ms; /**< If non-zero, mepa_ts_ltc_get() reads the free running LTC from hardware at most once per interval (and after LTC steps) and extrapolates from the last read in between, as long as the estimated extrapolation error stays within the PHY's bound. An LTC latched on the 1PPS edge is always read from hardware. 0 means always read hardware. Not supported by all PHYs. */
 } mepa_ts_init_conf_t;
 
 /** \brief PHY timestamp unit reset */
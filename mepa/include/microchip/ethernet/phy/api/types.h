@@ -280,6 +280,24 @@ typedef struct {
     phy10g_conf_t conf_10g;
 } mepa_conf_t;
 
+/** \brief Set of mepa_conf_t fields changed since the previous configuration */
+typedef uint32_t mepa_conf_change_t;
+
+#define MEPA_CONF_CHG_SPEED        0x00000001 /**< speed or fdx changed */
+#define MEPA_CONF_CHG_FLOW_CONTROL 0x00000002 /**< flow_control changed */
+#define MEPA_CONF_CHG_ADV          0x00000004 /**< aneg or adv_dis changed */
+#define MEPA_CONF_CHG_ADMIN        0x00000008 /**< admin changed */
+#define MEPA_CONF_CHG_MAC_IF_ANEG  0x00000010 /**< mac_if_aneg_ena changed */
+#define MEPA_CONF_CHG_MAN_NEG      0x00000020 /**< man_neg changed */
+#define MEPA_CONF_CHG_MDI_MODE     0x00000040 /**< mdi_mode changed */
+#define MEPA_CONF_CHG_FORCE_AMS    0x00000080 /**< force_ams_mode_sel changed */
+#define MEPA_CONF_CHG_CONF_10G     0x00000100 /**< conf_10g changed */
+#define MEPA_CONF_CHG_ALL          0x000001ff /**< All fields, e.g. first configuration */
+
+/** \brief Changes that affect the link partner negotiation */
+#define MEPA_CONF_CHG_LINK (MEPA_CONF_CHG_SPEED | MEPA_CONF_CHG_FLOW_CONTROL | MEPA_CONF_CHG_ADV | \
+                            MEPA_CONF_CHG_ADMIN | MEPA_CONF_CHG_MAN_NEG)
+
 /** \brief  MEPA event mask */
 typedef uint32_t mepa_event_t;
 
@@ -536,6 +554,22 @@ typedef struct {
     mepa_bool_t        vml_format;  /**< VML format register dump */
 } mepa_debug_info_t;
 
+/** \brief Register snapshot entry */
+typedef struct {
+    uint16_t block; /**< Driver specific register block, e.g. page or MMD */
+    uint16_t addr;  /**< Register address within the block */
+    uint32_t value; /**< Register value */
+} mepa_reg_snapshot_entry_t;
+
+/** \brief Register snapshot buffer */
+typedef struct {
+    mepa_reg_snapshot_entry_t *entry;  /**< [IN] Entry buffer */
+    uint32_t                  size;    /**< [IN] Number of entries in the buffer */
+    uint32_t                  cnt;     /**< [OUT] Number of entries filled */
+    uint32_t                  cursor;  /**< [IN/OUT] Position to continue from, zero to start a new snapshot */
+    mepa_bool_t               done;    /**< [OUT] All registers have been read */
+} mepa_reg_snapshot_t;
+
 /** \brief self-test information structure */
 typedef struct {
     mepa_port_speed_t	speed;
@@ -41,9 +41,33 @@ typedef struct {
   * API will be called by the user 10 times per sec.
   * This API needs to be called for all the ports by the application before mepa_phy_reset()
   *
+  * The workarounds are timed from host monotonic time (MEPA_UPTIME_NSEC) when the OS
+  * port provides it, and the repetetive count is then not used.
+  *
   **/
 mepa_rc lan8814_rep_count_set(mepa_device_t *dev, const uint8_t rep_cnt);
 
+/** \brief No workaround deadline pending */
+#define LAN8814_NEXT_SERVICE_NONE 0xffffffff
+
+/**
+ * \brief
+ * Get the time until the next SW workaround deadline of a port
+ *
+ * \param dev      [IN]         mepa driver
+ * \param msec     [OUT]        msec until mepa_poll() must be called again for the
+ *                              workarounds, LAN8814_NEXT_SERVICE_NONE if none is pending
+ *
+ * \return Return code.
+ *  MEPA_RC_OK  on Sucess
+ **/
+
+/** The ANEG, downshift, CRC and 100fdx workarounds are driven by deadlines set in mepa_poll().
+  * Call this API after mepa_poll() to sleep until the next deadline instead of polling at a
+  * fixed rate. Link changes are still only seen when mepa_poll() is called.
+  **/
+mepa_rc lan8814_next_service_get(mepa_device_t *dev, uint32_t *const msec);
+
 /**
  * \brief
  * Configure downshift for a particular port
@@ -477,10 +477,53 @@ static mepa_rc lan8814_downshift(mepa_device_t *dev)
     return MEPA_RC_OK;
 }
 
+// Host monotonic time in msec. 0 when the OS port has no time source.
+static uint64_t lan8814_wa_now_ms(void)
+{
+    return MEPA_UPTIME_NSEC() / 1000000;
+}
+
+// Start the workaround timer at the first call and return TRUE once msec has passed since then.
+// Without a host time source, the polls are counted assuming rep_cnt polls per second.
+static mepa_bool_t lan8814_wa_timer_expired(phy_data_t *data, lan8814_wa_timer_t *timer, uint32_t msec)
+{
+    uint64_t now = lan8814_wa_now_ms();
+
+    if (now == 0) {
+        timer->loop_cnt++;
+        return (timer->loop_cnt > (msec / 1000) * data->rep_cnt);
+    }
+    if (timer->deadline_ms == 0) {
+        timer->deadline_ms = now + msec;
+        return FALSE;
+    }
+    return (now >= timer->deadline_ms);
+}
+
+static void lan8814_wa_timer_stop(lan8814_wa_timer_t *timer)
+{
+    timer->deadline_ms = 0;
+    timer->loop_cnt = 0;
+}
+
+// Remaining time of a running timer in msec, LAN8814_NEXT_SERVICE_NONE if not running
+static uint32_t lan8814_wa_timer_left(phy_data_t *data, lan8814_wa_timer_t *timer, uint64_t now)
+{
+    if (now == 0) {
+        // Next expected poll
+        return (timer->loop_cnt ? 1000 / (data->rep_cnt ? data->rep_cnt : 1) : LAN8814_NEXT_SERVICE_NONE);
+    }
+    if (timer->deadline_ms == 0) {
+        return LAN8814_NEXT_SERVICE_NONE;
+    }
+    return (timer->deadline_ms > now ? (uint32_t)(timer->deadline_ms - now) : 0);
+}
+
 static mepa_rc lan8814_poll(mepa_device_t *dev, mepa_status_t *status)
 {
     uint16_t val, val2, val3 = 0;
     phy_data_t *data = (phy_data_t *) dev->data;
+    mepa_bool_t wa_active;
 
     MEPA_ENTER(dev);
     RD(dev, LAN8814_BASIC_STATUS, &val);
@@ -507,28 +550,35 @@ static mepa_rc lan8814_poll(mepa_device_t *dev, mepa_status_t *status)
         // establish the link then perform downshift to 100M.
         RD(dev, LAN8814_DIGITAL_AX_AN_STATUS, &val3);
         RD(dev, LAN8814_CONTROL, &val2);
+        wa_active = FALSE;
         if (data->dsh_conf.dsh_enable && !status->link && ((val2 && LAN8814_F_1000T_SPEED_STATUS) && (val3 & LAN8814_F_LINK_DET) && (data->aneg_flag)) && !data->dsh_complete) {
-            data->loop_cnt++;
-            if (data->loop_cnt > data->dsh_conf.dsh_thr_cnt * data->rep_cnt) {
+            wa_active = TRUE;
+            if (lan8814_wa_timer_expired(data, &data->wa_timer, data->dsh_conf.dsh_thr_cnt * 1000)) {
                lan8814_downshift(dev);
-               data->loop_cnt = 0;
+               lan8814_wa_timer_stop(&data->wa_timer);
                data->aneg_flag = FALSE;
                T_I(MEPA_TRACE_GRP_GEN, "Downshift on port %d", data->port_no);
             }
-            T_I(MEPA_TRACE_GRP_GEN, "Downshift capable on port %d dsh_loop_cnt%d rep_cnt %d",data->port_no, data->loop_cnt, data->rep_cnt);
+            T_I(MEPA_TRACE_GRP_GEN, "Downshift capable on port %d deadline %llu loop_cnt %d", data->port_no,
+                (unsigned long long)data->wa_timer.deadline_ms, data->wa_timer.loop_cnt);
         }
         // MEPA 555: This is a SW workaround for the ANEG state machine hung.
         // Check link up and aneg status complete when a valid signal is detected from link partner wait for 2 secs, couldn't establish link restart ANEG state Machine.
         if (!status->link && !(val & (LAN8814_F_BASIC_STATUS_ANEG_COMPLETE)) && (val3 & LAN8814_F_SIG_DET) && !data->aneg_flag) {
-            data->loop_cnt++;
-            T_I(MEPA_TRACE_GRP_GEN, "Aneg not complete on port %d loop_cnt%d rep_cnt %d",data->port_no, data->loop_cnt, data->rep_cnt);
-            if (data->loop_cnt > 2 * data->rep_cnt) { // default value for rep cnt to be 1sec
+            wa_active = TRUE;
+            T_I(MEPA_TRACE_GRP_GEN, "Aneg not complete on port %d deadline %llu loop_cnt %d", data->port_no,
+                (unsigned long long)data->wa_timer.deadline_ms, data->wa_timer.loop_cnt);
+            if (lan8814_wa_timer_expired(data, &data->wa_timer, 2000)) {
                 T_I(MEPA_TRACE_GRP_GEN, "Aneg state machine stuck!! restarting ANEG on port %d", data->port_no);
-                data->loop_cnt = 0;
+                lan8814_wa_timer_stop(&data->wa_timer);
                 WRM(dev, LAN8814_BASIC_CONTROL, LAN8814_F_BASIC_CTRL_RESTART_ANEG, LAN8814_F_BASIC_CTRL_RESTART_ANEG);
                 data->aneg_flag = TRUE;
             }
         }
+        if (!wa_active) {
+            // Neither condition holds, so a later wait must not inherit the old deadline
+            lan8814_wa_timer_stop(&data->wa_timer);
+        }
 
         if (!status->link || data->loopback.near_end_ena) {
             // No need to read aneg values when link is down or when near-end loopback enabled.
@@ -547,12 +597,17 @@ static mepa_rc lan8814_poll(mepa_device_t *dev, mepa_status_t *status)
                     !data->post_mac_rst) {
                         //link not completely up
                         status->link = 0;
-                } else if (!data->aneg_after_link_up) {// poll the status for 1 iteration assuming the polling interval is 1 second apart.
+                } else if (!data->aneg_after_link_up) {// hold the link down for 1 second after the aneg restart.
                     T_I(MEPA_TRACE_GRP_GEN, "Aneg restarted on port %d", data->port_no);
                     WRM(dev, LAN8814_BASIC_CONTROL, LAN8814_F_BASIC_CTRL_RESTART_ANEG, LAN8814_F_BASIC_CTRL_RESTART_ANEG);
                     data->aneg_after_link_up = TRUE;
+                    lan8814_wa_timer_stop(&data->crc_timer);
+                    (void)lan8814_wa_timer_expired(data, &data->crc_timer, 1000);
+                    status->link = 0;
+                } else if (!lan8814_wa_timer_expired(data, &data->crc_timer, 1000)) {
                     status->link = 0;
                 } else if (data->aneg_after_link_up) {// After auto-negotiation restarted, set the link status as up.
+                    lan8814_wa_timer_stop(&data->crc_timer);
                     status->speed = MEPA_SPEED_1G;
                     status->fdx = 1;
                     data->crc_workaround = FALSE;
@@ -607,12 +662,14 @@ static mepa_rc lan8814_poll(mepa_device_t *dev, mepa_status_t *status)
         RD(dev, LAN8814_DIGITAL_AX_AN_STATUS, &val2);
         RD(dev, LAN8814_CONTROL, &val);
         if (status->speed == MEPA_SPEED_100M && ((val2 & LAN8814_F_LINK_DET) && !status->link)) {
-            if((data->loop_cnt++ > 2 * data->rep_cnt)) {
+            if (lan8814_wa_timer_expired(data, &data->wa_timer, 2000)) {
                 val |= LAN8814_F_CONTROL_SOFT_RESET;
                 WRM(dev, LAN8814_CONTROL, val, LAN8814_F_CONTROL_SOFT_RESET);
                 T_I(MEPA_TRACE_GRP_GEN, "DSP soft reset for link up on Port %d", data->port_no);
-                data->loop_cnt = 0;
+                lan8814_wa_timer_stop(&data->wa_timer);
             }
+        } else {
+            lan8814_wa_timer_stop(&data->wa_timer);
         }
         // MEPA 503 workaround ends here
     }
@@ -637,13 +694,13 @@ end:
                     val |= (LAN8814_F_ANEG_MSTR_SLV_CTRL_CFG_VAL | LAN8814_F_ANEG_MSTR_SLV_CTRL_1000_T_FULL_DUP);
                     T_I(MEPA_TRACE_GRP_GEN, "link Down Readvertising 1G Speed Changed on port: %d", data->port_no);
                     WRM(dev, LAN8814_ANEG_MSTR_SLV_CTRL, val, LAN8814_F_ANEG_MSTR_SLV_CTRL_1000_T_FULL_DUP | LAN8814_F_ANEG_MSTR_SLV_CTRL_CFG_VAL);
-                    data->loop_cnt = data->dsh_complete = 0;
+                    data->dsh_complete = 0;
                     data->aneg_after_link_up = FALSE;
                 }
             }
-            data->loop_cnt = 0;
+            lan8814_wa_timer_stop(&data->wa_timer);
             data->aneg_flag = 0;
-            T_I(MEPA_TRACE_GRP_GEN,"After restart workaround on port->no:%d and data->dsh_loop_cnt:%d", data->port_no, data->loop_cnt);
+            T_I(MEPA_TRACE_GRP_GEN,"After restart workaround on port->no:%d", data->port_no);
         }
     }
     data->link_status = status->link;
@@ -654,6 +711,21 @@ end:
     return MEPA_RC_OK;
 }
 
+mepa_rc lan8814_next_service_get(mepa_device_t *dev, uint32_t *const msec)
+{
+    phy_data_t *data = (phy_data_t *) dev->data;
+    uint64_t now = lan8814_wa_now_ms();
+    uint32_t left;
+
+    MEPA_ENTER(dev);
+    *msec = lan8814_wa_timer_left(data, &data->wa_timer, now);
+    if ((left = lan8814_wa_timer_left(data, &data->crc_timer, now)) < *msec) {
+        *msec = left;
+    }
+    MEPA_EXIT(dev);
+    return MEPA_RC_OK;
+}
+
 static mepa_rc lan8814_conf_mdi_mode(mepa_device_t *dev, const mepa_media_mode_t mode)
 {
     phy_data_t *data = (phy_data_t *)dev->data;
@@ -806,6 +878,31 @@ static mepa_rc lan8814_conf_set(mepa_device_t *dev, const mepa_conf_t *config)
     return MEPA_RC_OK;
 }
 
+static mepa_rc lan8814_conf_update(mepa_device_t *dev, const mepa_conf_t *config, mepa_conf_change_t chg)
+{
+    phy_data_t *data = (phy_data_t *)dev->data;
+    mepa_bool_t qsgmii_aneg = config->speed != MEPA_SPEED_AUTO ? FALSE : config->mac_if_aneg_ena;
+
+    // Only the MDI mode and host side aneg can be changed without touching the link
+    if (!config->admin.enable ||
+        (chg & ~(MEPA_CONF_CHG_MDI_MODE | MEPA_CONF_CHG_MAC_IF_ANEG | MEPA_CONF_CHG_FORCE_AMS | MEPA_CONF_CHG_CONF_10G))) {
+        return lan8814_conf_set(dev, config);
+    }
+
+    MEPA_ENTER(dev);
+    if (chg & MEPA_CONF_CHG_MDI_MODE) {
+        lan8814_conf_mdi_mode(dev, config->mdi_mode);
+    }
+    if (qsgmii_aneg != data->conf.mac_if_aneg_ena) {
+        lan8814_qsgmii_aneg(dev, qsgmii_aneg);
+    }
+    data->conf = *config;
+    data->conf.mac_if_aneg_ena = qsgmii_aneg;
+    MEPA_EXIT(dev);
+    T_D(MEPA_TRACE_GRP_GEN, "port %d updated without aneg, chg 0x%x", data->port_no, chg);
+    return MEPA_RC_OK;
+}
+
 static mepa_rc lan8814_conf_get(mepa_device_t *dev, mepa_conf_t *const config)
 {
     phy_data_t *data = (phy_data_t *)dev->data;
@@ -2438,6 +2535,91 @@ static mepa_rc lan8814_reg_dump(struct mepa_device *dev,
     return MEPA_RC_OK;
 }
 
+// Register blocks of the snapshot, covering the registers of lan8814_reg_dump().
+// Block 0 is the direct registers, block N+1 is extended page N and block
+// LAN8814_SNAPSHOT_MMD+N is MMD N.
+#define LAN8814_SNAPSHOT_MMD   0x100
+#define LAN8814_SNAPSHOT_CHUNK 64 // Maximum number of registers read while holding the lock
+
+static const struct {
+    uint16_t block;
+    uint16_t addr;
+    uint16_t cnt;
+} lan8814_snapshot_tbl[] = {
+    {0, 0, 32},
+    {1, 0, 17},
+    {2, 0, 239},
+    {3, 0, 111},
+    {4, 0, 28},
+    {5, 0, 772},
+    {6, 0, 708},
+    {8, 58, 2},
+    {8, 62, 2},
+    {29, 0, 80},
+    {30, 0, 80},
+    {32, 0, 1},
+    {32, 8, 10},
+    {LAN8814_SNAPSHOT_MMD + 3, 0, 2},
+    {LAN8814_SNAPSHOT_MMD + 3, 20, 1},
+    {LAN8814_SNAPSHOT_MMD + 7, 60, 2},
+};
+
+// The cursor holds the table index in the upper 16 bits and the register offset in the lower 16 bits
+static mepa_rc lan8814_reg_snapshot_get(struct mepa_device *dev,
+                                        mepa_reg_snapshot_t *const snap)
+{
+    uint32_t                  tbl_cnt = sizeof(lan8814_snapshot_tbl)/sizeof(lan8814_snapshot_tbl[0]);
+    uint32_t                  idx = (snap->cursor >> 16), offs = (snap->cursor & 0xffff), cnt, i;
+    uint16_t                  block, addr, val = 0;
+    mepa_reg_snapshot_entry_t *entry;
+    mepa_rc                   rc = MEPA_RC_OK;
+
+    while (idx < tbl_cnt && snap->cnt < snap->size) {
+        block = lan8814_snapshot_tbl[idx].block;
+        cnt = (lan8814_snapshot_tbl[idx].cnt - offs);
+        if (cnt > LAN8814_SNAPSHOT_CHUNK) {
+            cnt = LAN8814_SNAPSHOT_CHUNK;
+        }
+        if (cnt > (snap->size - snap->cnt)) {
+            cnt = (snap->size - snap->cnt);
+        }
+
+        // Extended pages are read with address post increment, one MIIM read per register
+        MEPA_ENTER(dev);
+        for (i = 0; i < cnt; i++) {
+            addr = (lan8814_snapshot_tbl[idx].addr + offs + i);
+            if (block >= LAN8814_SNAPSHOT_MMD) {
+                rc = lan8814_mmd_reg_rd(dev, block - LAN8814_SNAPSHOT_MMD, addr, &val);
+            } else if (block) {
+                rc = lan8814_ext_incr_reg_rd(dev, block - 1, addr, &val, i == 0);
+            } else {
+                rc = lan8814_direct_reg_rd(dev, addr, &val);
+            }
+            if (rc != MEPA_RC_OK) {
+                break;
+            }
+            entry = &snap->entry[snap->cnt++];
+            entry->block = block;
+            entry->addr = addr;
+            entry->value = val;
+        }
+        MEPA_EXIT(dev);
+        if (rc != MEPA_RC_OK) {
+            T_E(MEPA_TRACE_GRP_GEN, "port %d: snapshot of block %u failed", dev->numeric_handle, block);
+            return rc;
+        }
+
+        offs += cnt;
+        if (offs >= lan8814_snapshot_tbl[idx].cnt) {
+            idx++;
+            offs = 0;
+        }
+    }
+    snap->cursor = ((idx << 16) | offs);
+    snap->done = (idx >= tbl_cnt);
+    return MEPA_RC_OK;
+}
+
 static mepa_rc lan8814_debug_info_dump(struct mepa_device *dev,
                                     const mepa_debug_print_t pr,
                                     const mepa_debug_info_t   *const info)
@@ -2494,6 +2676,7 @@ mepa_drivers_t mepa_lan8814_driver_init()
             .mepa_driver_reset = lan8814_reset,
             .mepa_driver_poll = lan8814_poll,
             .mepa_driver_conf_set = lan8814_conf_set,
+            .mepa_driver_conf_update = lan8814_conf_update,
             .mepa_driver_conf_get = lan8814_conf_get,
             .mepa_driver_if_set = lan8814_if_set,
             .mepa_driver_if_get = lan8814_if_get,
@@ -2523,6 +2706,7 @@ mepa_drivers_t mepa_lan8814_driver_init()
             .mepa_driver_synce_clock_conf_set = lan8814_recovered_clk_set,
             .mepa_driver_isolate_mode_conf = lan8814_isolate_mode_conf,
             .mepa_debug_info_dump = lan8814_debug_info_dump,
+            .mepa_reg_snapshot_get = lan8814_reg_snapshot_get,
             .mepa_driver_sqi_read = lan8814_sqi_read,
             .mepa_driver_start_of_frame_conf_set = lan8814_start_of_frame_conf_set,
             .mepa_driver_start_of_frame_conf_get = lan8814_start_of_frame_conf_get,
@@ -2543,6 +2727,7 @@ mepa_drivers_t mepa_lan8814_driver_init()
             .mepa_driver_reset = lan8814_reset,
             .mepa_driver_poll = lan8814_poll,
             .mepa_driver_conf_set = lan8814_conf_set,
+            .mepa_driver_conf_update = lan8814_conf_update,
             .mepa_driver_conf_get = lan8814_conf_get,
             .mepa_driver_if_set = lan8814_if_set,
             .mepa_driver_if_get = lan8814_if_get,
@@ -2571,6 +2756,7 @@ mepa_drivers_t mepa_lan8814_driver_init()
             .mepa_driver_synce_clock_conf_set = lan8814_recovered_clk_set,
             .mepa_driver_isolate_mode_conf = lan8814_isolate_mode_conf,
             .mepa_debug_info_dump = lan8814_debug_info_dump,
+            .mepa_reg_snapshot_get = lan8814_reg_snapshot_get,
             .mepa_driver_sqi_read = lan8814_sqi_read,
             .mepa_driver_start_of_frame_conf_set = lan8814_start_of_frame_conf_set,
             .mepa_driver_start_of_frame_conf_get = lan8814_start_of_frame_conf_get,
@@ -2590,6 +2776,7 @@ mepa_drivers_t mepa_lan8814_driver_init()
             .mepa_driver_reset = lan8814_reset,
             .mepa_driver_poll = lan8814_poll,
             .mepa_driver_conf_set = lan8814_conf_set,
+            .mepa_driver_conf_update = lan8814_conf_update,
             .mepa_driver_conf_get = lan8814_conf_get,
             .mepa_driver_if_set = mas_if_set,
             .mepa_driver_if_get = mas_if_get,
@@ -2617,6 +2804,7 @@ mepa_drivers_t mepa_lan8814_driver_init()
             .mepa_driver_loopback_get = lan8814_loopback_get,
             .mepa_driver_isolate_mode_conf = lan8814_isolate_mode_conf,
             .mepa_debug_info_dump = lan8814_debug_info_dump,
+            .mepa_reg_snapshot_get = lan8814_reg_snapshot_get,
             .mepa_driver_sqi_read = lan8814_sqi_read,
             .mepa_driver_start_of_frame_conf_set = lan8814_start_of_frame_conf_set,
             .mepa_driver_start_of_frame_conf_get = lan8814_start_of_frame_conf_get,
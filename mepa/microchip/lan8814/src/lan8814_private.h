@@ -121,6 +121,23 @@ typedef struct {
     lan8814_ts_port_latencies_t        port_latencies;
 } lan8814_ts_port_conf_t;
 
+// Software model of the free running LTC. Between hardware reads, the LTC is
+// extrapolated from the last hardware sample using host monotonic time and the
+// current rate adjustment, as long as the estimated error is within bounds.
+typedef struct {
+    uint32_t                      interval_ms;          // Hardware read interval. 0 => model disabled
+    mepa_bool_t                   valid;                // Model holds a usable hardware sample
+    mepa_timestamp_t              ltc;                  // LTC at the anchor point
+    uint64_t                      host_ns;              // Host time at the anchor point (settle deadline while not valid)
+    uint64_t                      read_ns;              // Host time of the last hardware read
+    mepa_ts_scaled_ppb_t          rate_adj;             // Rate adjustment in effect since the anchor point
+    uint32_t                      hw_reads;             // Number of hardware LTC reads
+    uint32_t                      sw_reads;             // Number of LTC reads answered by the model
+    int64_t                       max_err_ns;           // Largest model error seen at a hardware read
+    int64_t                       drift_ppb;            // Model drift measured at the last hardware read, bounds the error
+    int64_t                       latch_err_ns;         // Host time uncertainty of the last hardware read, half the LTC_READ duration
+} lan8814_ltc_model_t;
+
 typedef struct {
     mepa_bool_t                   ptp_en;               // Chip PTP enabled/disabled
     lan8814_ts_tsu_op_mode_t         tsu_op_mode;          // TSU operating Mode: Standalone/PCH/PCH-MCH
@@ -139,39 +156,51 @@ typedef struct {
     mepa_bool_t                   ts_init_done;
     mepa_ts_tc_op_mode_t          tc_op_mode;           // tc mode for correction field update
     mepa_mch_pch_t                mch_pch;
+    lan8814_ltc_model_t           ltc_model;            // LTC read model (base port only)
 } lan8814_ts_data_t;
 
 
+// Workaround timer. The deadline is taken from host monotonic time, so the
+// workarounds do not depend on how often lan8814_poll() is called. Without a
+// host time source, polls are counted instead at rep_cnt polls per second.
+typedef struct {
+    uint64_t                 deadline_ms; // Host time of expiry. 0 => not running
+    uint8_t                  loop_cnt;    // Number of polls since start (no host time source)
+} lan8814_wa_timer_t;
+
 typedef struct {
+    // Fields used by every lan8814_poll() call are kept first, so they share the
+    // first cache lines of the private data (see mepa_arena_set()).
+    mepa_port_no_t           port_no;
+    mepa_device_t            *base_dev; // Pointer to the device of base port on the phy chip
     mepa_bool_t              init_done;
+    mepa_bool_t              link_status;
+    mepa_port_speed_t        speed_status;
+    mepa_bool_t              fdx_status;
+    mepa_bool_t              post_mac_rst;
+    mepa_bool_t              aneg_after_link_up;
+    mepa_bool_t              crc_workaround;
+    mepa_bool_t              dsh_complete; //flag to denote downshift operation completed.
+    mepa_bool_t              aneg_flag; //flag to denote ANEG restart is completed.
+    uint8_t                  rep_cnt; //Rate at which application polls a port per sec, for ex: rep_cnt = 10 means 10 times polling will be called per port per sec. Only used without a host time source.
+    lan8814_wa_timer_t       wa_timer; //Timer for MEPA 555, downshift and MEPA 503 workarounds.
+    lan8814_wa_timer_t       crc_timer; //Timer for the CRC workaround aneg restart.
     uint8_t                  packet_idx;
-    mepa_port_no_t           port_no;
     mepa_conf_t              conf;
     mepa_event_t             events;
     mepa_loopback_t          loopback;
     mepa_bool_t              qsgmii_phy_aneg_dis;
     phy_dev_info_t           dev;
     mepa_synce_clock_conf_t  synce_conf;
-    mepa_device_t            *base_dev; // Pointer to the device of base port on the phy chip
-    mepa_bool_t              link_status;
-    mepa_port_speed_t        speed_status;
-    mepa_bool_t              fdx_status;
     mepa_cable_diag_result_t cable_diag;
     mepa_start_of_frame_conf_t sof_conf;
     mepa_bool_t              framepreempt_en; // Frame Preemption
     mepa_media_mode_t        mdi_mode;
-    mepa_bool_t              post_mac_rst;
-    mepa_bool_t              aneg_after_link_up;
-    mepa_bool_t              crc_workaround;
     lan8814_ts_data_t           ts_state;
     mepa_phy_prbs_generator_conf_t prbs_conf;
     mepa_bool_t              prbs_init;
     mepa_phy_eee_conf_t      eee_conf;
     lan8814_phy_downshift_t  dsh_conf; //Auto downshift configuration(chip specific)
-    uint8_t                  loop_cnt; //variable to denote no of times status poll getting called by application when MEPA 555 or MEPA 546 occurs.
-    uint8_t                  rep_cnt; //Rate at which application polls a port per sec, for ex: rep_cnt = 10 means 10 times polling will be called per port per sec.
-    mepa_bool_t              dsh_complete; //flag to denote downshift operation completed.
-    mepa_bool_t              aneg_flag; //flag to denote ANEG restart is completed.
 } phy_data_t;
 
 #endif
@@ -13,6 +13,17 @@
 #define CLK_PERIOD_250_MHZ  4 // 4 nano seconds clock period.
 #define CLK_PERIOD_200_MHZ  5 // 5 nano seconds clock period.
 
+#define LAN8814_NSEC_PER_SEC        1000000000LL
+// LTC loads and steps requested through LAN8814_PTP_LTC_EXT_ADJ_CFG take effect on the next 1PPS edge.
+// The LTC model is not used until this much time has passed since the request.
+#define LAN8814_LTC_LOAD_SETTLE_NS  (1100 * 1000000LL)
+// Largest allowed estimated error of the LTC model. The estimate is the extrapolation error from the drift
+// measured at the last hardware read, plus the host time uncertainty of that read, which is half the time
+// taken by the MDIO accesses of the LTC_READ command. The hardware is read when the estimate exceeds this.
+#define LAN8814_LTC_MODEL_MAX_ERR_NS     (100 * 1000LL)
+// Drift before it has been measured. The model is not used until two hardware reads have been compared.
+#define LAN8814_LTC_MODEL_DRIFT_UNKNOWN  LAN8814_NSEC_PER_SEC
+
 static  uint16_t lan8814_ing_latencies[MEPA_TS_CLOCK_FREQ_MAX - 1][3] = {
                                  // 1000,  100,    10 speeds
     [MEPA_TS_CLOCK_FREQ_25M] =    {  415, 1447, 8377 }, // Internal clock is 250 MHz
@@ -44,6 +55,7 @@ static uint16_t lan8814_twostep_egr_lat_adj[MEPA_TS_CLOCK_FREQ_MAX][4] = {
 static uint8_t def_mac[] = {0x01, 0x1B, 0x19, 0x00, 0x00, 0x00};
 
 static mepa_rc lan8814_ltc_target_seconds(mepa_device_t *dev, uint32_t sec);
+static void lan8814_ltc_model_step(mepa_device_t *base_dev, mepa_bool_t pps_load);
 
 static void get_default_ts_eth_class(mepa_ts_classifier_eth_t *const conf)
 {
@@ -308,6 +320,9 @@ static mepa_rc lan8814_ts_init_conf_set(mepa_device_t *dev, const mepa_ts_init_c
             MEPA_EXIT(base_dev);
             return rc;
         }
+        memset(&data->ts_state.ltc_model, 0, sizeof(data->ts_state.ltc_model));
+        data->ts_state.ltc_model.interval_ms = ts_init_conf->ltc_read_interval_ms;
+        data->ts_state.ltc_model.drift_ppb = LAN8814_LTC_MODEL_DRIFT_UNKNOWN;
         MEPA_EXIT(base_dev);
     }
 
@@ -335,6 +350,7 @@ static mepa_rc lan8814_ts_init_conf_get(mepa_device_t *dev, mepa_ts_init_conf_t
     ts_init_conf->dly_req_recv_10byte_ts = FALSE;
     ts_init_conf->tx_auto_followup_ts = data->ts_state.tx_auto_followup_ts;
     ts_init_conf->mch_pch_conf      = data->ts_state.mch_pch;
+    ts_init_conf->ltc_read_interval_ms = ((phy_data_t *)data->base_dev->data)->ts_state.ltc_model.interval_ms;
     MEPA_EXIT(dev);
 
     return MEPA_RC_OK;
@@ -414,6 +430,7 @@ static mepa_rc lan8814_ts_ltc_ls_en_set(mepa_device_t *dev, const mepa_ts_ls_typ
             } else {
                 EP_WRM(base_dev, LAN8814_PTP_CMD_CTL, LAN8814_PTP_CMD_CTL_LTC_LOAD, LAN8814_PTP_CMD_CTL_LTC_LOAD);
             }
+            lan8814_ltc_model_step(base_dev, ls_pps);
             break;
         case MEPA_TS_CMD_SAVE:
             if (ls_pps == TRUE) {
@@ -437,9 +454,171 @@ static mepa_rc lan8814_ts_ltc_ls_en_set(mepa_device_t *dev, const mepa_ts_ls_typ
     return MEPA_RC_OK;
 }
 
+// Add a signed number of nanoseconds to a timestamp.
+static void lan8814_ltc_add_ns(mepa_timestamp_t *ts, int64_t ns)
+{
+    int64_t sec = ((int64_t)ts->seconds.high << 32) | ts->seconds.low;
+    int64_t nsec = (int64_t)ts->nanoseconds + ns;
+    int64_t sec_adj = MEPA_DIV64(nsec, LAN8814_NSEC_PER_SEC);
+
+    nsec = nsec - (sec_adj * LAN8814_NSEC_PER_SEC);
+    if (nsec < 0) {
+        nsec += LAN8814_NSEC_PER_SEC;
+        sec_adj--;
+    }
+    sec += sec_adj;
+    ts->seconds.high = (sec >> 32) & 0xFFFF;
+    ts->seconds.low = sec & 0xFFFFFFFF;
+    ts->nanoseconds = nsec;
+}
+
+// Difference a - b in nanoseconds. Only meaningful for timestamps close to each other.
+static int64_t lan8814_ltc_diff_ns(const mepa_timestamp_t *a, const mepa_timestamp_t *b)
+{
+    int64_t sec_a = ((int64_t)a->seconds.high << 32) | a->seconds.low;
+    int64_t sec_b = ((int64_t)b->seconds.high << 32) | b->seconds.low;
+
+    return ((sec_a - sec_b) * LAN8814_NSEC_PER_SEC) + ((int64_t)a->nanoseconds - (int64_t)b->nanoseconds);
+}
+
+// Extrapolate the LTC model to host time 'now'.
+static void lan8814_ltc_model_predict(const lan8814_ltc_model_t *model, uint64_t now, mepa_timestamp_t *ts)
+{
+    int64_t elapsed = (int64_t)(now - model->host_ns);
+    int64_t adj = model->rate_adj;
+    int64_t sec = MEPA_DIV64(elapsed, LAN8814_NSEC_PER_SEC);
+    int64_t ms = MEPA_DIV64(elapsed - (sec * LAN8814_NSEC_PER_SEC), 1000000);
+    int64_t ns = elapsed - (sec * LAN8814_NSEC_PER_SEC) - (ms * 1000000);
+
+    // rate_adj is in scaled ppb i.e. ppb * 2^16. The product is split so the fractional ppb are kept without overflow.
+    elapsed += (MEPA_DIV64(sec * adj, 1LL << 16) + MEPA_DIV64(ms * adj, 1000LL << 16) +
+                MEPA_DIV64(ns * adj, LAN8814_NSEC_PER_SEC << 16));
+    *ts = model->ltc;
+    lan8814_ltc_add_ns(ts, elapsed);
+}
+
+// Invalidate the LTC model after the LTC has been loaded or stepped.
+// If the change is applied on the next 1PPS edge, the model is held off until it has settled.
+static void lan8814_ltc_model_step(mepa_device_t *base_dev, mepa_bool_t pps_load)
+{
+    phy_data_t *base_data = (phy_data_t *)base_dev->data;
+    lan8814_ltc_model_t *model = &base_data->ts_state.ltc_model;
+
+    model->valid = FALSE;
+    model->host_ns = pps_load ? (MEPA_UPTIME_NSEC() + LAN8814_LTC_LOAD_SETTLE_NS) : 0;
+}
 
 //Since EP_RD_INCR macro is used in below API, it must be ensured that API must be executed without interruption
 //till its end. No other API should access Lan8814 registers as it may interfere with register addresses.
+// If host_ns is non-NULL, it returns the host time at which the LTC was latched, taken as the middle of the
+// host times sampled before and after the LTC_READ command, and latch_err_ns returns half the difference.
+static mepa_rc lan8814_ltc_hw_read(mepa_device_t *base_dev, mepa_timestamp_t *const ts,
+                                   uint64_t *const host_ns, int64_t *const latch_err_ns)
+{
+    uint16_t val = 0, ns_h = 0, ns_l = 0;
+    uint64_t before = (host_ns ? MEPA_UPTIME_NSEC() : 0), after;
+
+    EP_WRM(base_dev, LAN8814_PTP_CMD_CTL, LAN8814_PTP_CMD_CTL_LTC_READ, LAN8814_PTP_CMD_CTL_LTC_READ);
+    if (host_ns) {
+        after = MEPA_UPTIME_NSEC();
+        *host_ns = (before == 0 ? 0 : before + ((after - before) / 2));
+        *latch_err_ns = (int64_t)((after - before + 1) / 2);
+    }
+    ts->seconds.high = 0;
+    ts->seconds.low = 0;
+    ts->nanoseconds = 0;
+    // Read LTC
+    EP_RD_INCR(base_dev, LAN8814_PTP_LTC_RD_SEC_HI, &val, TRUE);
+    ts->seconds.high = val;
+    val = 0;
+    EP_RD_INCR(base_dev, LAN8814_PTP_LTC_RD_SEC_MID, &val, FALSE);
+    ts->seconds.low = val;
+    ts->seconds.low = ts->seconds.low << 16;
+    val = 0;
+    EP_RD_INCR(base_dev, LAN8814_PTP_LTC_RD_SEC_LO, &val, FALSE);
+    ts->seconds.low = ts->seconds.low | val;
+    EP_RD_INCR(base_dev, LAN8814_PTP_LTC_RD_NS_HI, &ns_h, FALSE);
+    ts->nanoseconds = ns_h;
+    ts->nanoseconds = ts->nanoseconds << 16;
+    EP_RD_INCR(base_dev, LAN8814_PTP_LTC_RD_NS_LO, &ns_l, FALSE);
+    ts->nanoseconds = ts->nanoseconds | ns_l;
+    EP_RD_INCR(base_dev, LAN8814_PTP_LTC_RD_SUBNS_HI, &val, FALSE);
+    EP_RD_INCR(base_dev, LAN8814_PTP_LTC_RD_SUBNS_LO, &val, FALSE);
+
+    return MEPA_RC_OK;
+}
+
+// Estimated model error at host time 'now', from the drift measured at the last hardware read and the
+// host time uncertainty of that read. One ppb is added to cover a drift measured as zero.
+static int64_t lan8814_ltc_model_err_ns(const lan8814_ltc_model_t *model, uint64_t now)
+{
+    int64_t elapsed = (int64_t)(now - model->read_ns);
+
+    if (model->drift_ppb >= LAN8814_LTC_MODEL_DRIFT_UNKNOWN) {
+        return LAN8814_NSEC_PER_SEC;
+    }
+    return MEPA_DIV64(elapsed * (model->drift_ppb + 1), LAN8814_NSEC_PER_SEC) + model->latch_err_ns;
+}
+
+// Answer an LTC read from the LTC model, reading the hardware when the model is stale
+// or its estimated error is too large.
+// The 1PPS capture registers only change once per second, so the model is built on the
+// free running LTC read through LTC_READ.
+static mepa_rc lan8814_ltc_model_get(mepa_device_t *base_dev, mepa_timestamp_t *const ts)
+{
+    phy_data_t *base_data = (phy_data_t *)base_dev->data;
+    lan8814_ltc_model_t *model = &base_data->ts_state.ltc_model;
+    uint64_t now = MEPA_UPTIME_NSEC();
+    mepa_timestamp_t predicted;
+    int64_t err, elapsed, latch_err;
+
+    if (model->valid && now != 0 &&
+        (now - model->read_ns) < ((uint64_t)model->interval_ms * 1000000ULL) &&
+        lan8814_ltc_model_err_ns(model, now) <= LAN8814_LTC_MODEL_MAX_ERR_NS) {
+        lan8814_ltc_model_predict(model, now, ts);
+        model->sw_reads++;
+        return MEPA_RC_OK;
+    }
+
+    // The model is anchored at the host time the LTC was latched, not at 'now'
+    lan8814_ltc_hw_read(base_dev, ts, &now, &latch_err);
+    model->hw_reads++;
+    if (now == 0) {
+        // No host time source
+        return MEPA_RC_OK;
+    }
+    if (model->valid) {
+        lan8814_ltc_model_predict(model, now, &predicted);
+        err = MEPA_LLABS(lan8814_ltc_diff_ns(ts, &predicted));
+        if (err > model->max_err_ns) {
+            model->max_err_ns = err;
+        }
+        // Only the part of the error not explained by the latch time uncertainty of the two reads is drift
+        elapsed = (int64_t)(now - model->read_ns);
+        err -= (latch_err + model->latch_err_ns);
+        if (err < 0) {
+            err = 0;
+        }
+        if (err >= LAN8814_NSEC_PER_SEC || elapsed <= 0) {
+            model->drift_ppb = LAN8814_LTC_MODEL_DRIFT_UNKNOWN;
+        } else {
+            model->drift_ppb = MEPA_DIV64(err * LAN8814_NSEC_PER_SEC, elapsed);
+        }
+        T_D(MEPA_TRACE_GRP_TS, "LTC model error %lld ns, drift %lld ppb", err, model->drift_ppb);
+    } else if (now < model->host_ns) {
+        // LTC load/step may still be pending
+        return MEPA_RC_OK;
+    }
+    model->ltc = *ts;
+    model->host_ns = now;
+    model->read_ns = now;
+    model->latch_err_ns = latch_err;
+    model->rate_adj = base_data->ts_state.ts_port_conf.rate_adj;
+    model->valid = TRUE;
+
+    return MEPA_RC_OK;
+}
+
 static mepa_rc lan8814_ts_ltc_get(mepa_device_t *dev, mepa_timestamp_t *const ts)
 {
     uint16_t val = 0, ns_h = 0, ns_l = 0;;
@@ -451,28 +630,14 @@ static mepa_rc lan8814_ts_ltc_get(mepa_device_t *dev, mepa_timestamp_t *const ts
     MEPA_ENTER(dev);
     if (base_dev == dev) {
         if (ls_pps == FALSE) {
-            EP_WRM(base_dev, LAN8814_PTP_CMD_CTL, LAN8814_PTP_CMD_CTL_LTC_READ, LAN8814_PTP_CMD_CTL_LTC_READ);
-            ts->seconds.high = 0;
-            ts->seconds.low = 0;
-            ts->nanoseconds = 0;
-            // Read LTC
-            EP_RD_INCR(base_dev, LAN8814_PTP_LTC_RD_SEC_HI, &val, TRUE);
-            ts->seconds.high = val;
-            val = 0;
-            EP_RD_INCR(base_dev, LAN8814_PTP_LTC_RD_SEC_MID, &val, FALSE);
-            ts->seconds.low = val;
-            ts->seconds.low = ts->seconds.low << 16;
-            val = 0;
-            EP_RD_INCR(base_dev, LAN8814_PTP_LTC_RD_SEC_LO, &val, FALSE);
-            ts->seconds.low = ts->seconds.low | val;
-            EP_RD_INCR(base_dev, LAN8814_PTP_LTC_RD_NS_HI, &ns_h, FALSE);
-            ts->nanoseconds = ns_h;
-            ts->nanoseconds = ts->nanoseconds << 16;
-            EP_RD_INCR(base_dev, LAN8814_PTP_LTC_RD_NS_LO, &ns_l, FALSE);
-            ts->nanoseconds = ts->nanoseconds | ns_l;
-            EP_RD_INCR(base_dev, LAN8814_PTP_LTC_RD_SUBNS_HI, &val, FALSE);
-            EP_RD_INCR(base_dev, LAN8814_PTP_LTC_RD_SUBNS_LO, &val, FALSE);
+            // Free running LTC, answered by the LTC model when enabled
+            if (data->ts_state.ltc_model.interval_ms) {
+                (void)lan8814_ltc_model_get(base_dev, ts);
+            } else {
+                (void)lan8814_ltc_hw_read(base_dev, ts, NULL, NULL);
+            }
         } else {
+            // LTC latched on the 1PPS edge, always read from the capture registers
 
             ts->seconds.high = 0;
             ts->seconds.low = 0;
@@ -527,6 +692,7 @@ static mepa_rc lan8814_ts_ltc_set(mepa_device_t *dev, const mepa_timestamp_t *co
         val = ts->nanoseconds & 0xFFFF;
         EP_WRM(base_dev, LAN8814_PTP_LTC_SET_NS_LO, val, LAN8814_DEF_MASK);
         EP_WRM(base_dev, LAN8814_PTP_LTC_EXT_ADJ_CFG, LAN8814_PTP_LTC_EXT_ADJ_LOAD_EN, LAN8814_PTP_LTC_EXT_ADJ_LOAD_EN);
+        lan8814_ltc_model_step(base_dev, TRUE);
 
         if (base_data->ts_state.pps.pps_output_enable) {
             // Reload the ltc targets
@@ -607,6 +773,15 @@ static mepa_rc lan8814_ts_clock_rateadj_set(mepa_device_t *dev, const mepa_ts_sc
             val = (0xFFFF & (adj_val));
             EP_WRM(dev, LAN8814_PTP_LTC_RATE_ADJ_LO, val, LAN8814_DEF_MASK);
             data->ts_state.ts_port_conf.rate_adj = *adj;
+            if (data->ts_state.ltc_model.valid) {
+                // Move the model anchor to now and continue with the new rate
+                lan8814_ltc_model_t *model = &data->ts_state.ltc_model;
+                uint64_t now = MEPA_UPTIME_NSEC();
+
+                lan8814_ltc_model_predict(model, now, &model->ltc);
+                model->host_ns = now;
+                model->rate_adj = *adj;
+            }
         }
         T_I(MEPA_TRACE_GRP_TS, "Rate Adjust :: adj_val %llu adj_abs %llu input-adj %lld Port %d\n", adj_val, adj_abs, *adj, data->port_no);
     }
@@ -651,6 +826,7 @@ static mepa_rc lan8814_ts_clock_adj1ns(mepa_device_t *dev, const mepa_bool_t inc
         EP_WRM(dev, LAN8814_PTP_LTC_STEP_ADJ_LO, adj, LAN8814_DEF_MASK);
         EP_WRM(dev, LAN8814_PTP_CMD_CTL, LAN8814_PTP_CMD_CTL_LTC_STEP_NANOSECONDS, LAN8814_PTP_CMD_CTL_LTC_STEP_NANOSECONDS);
         EP_WRM(dev, LAN8814_PTP_CMD_CTL, cmd_org, LAN8814_DEF_MASK);
+        lan8814_ltc_model_step(dev, FALSE);
     }
     MEPA_EXIT(dev);
 
@@ -1191,6 +1367,18 @@ static mepa_rc lan8814_ts_clock_conf_reg_dump(mepa_device_t *dev,
     lan8814_ts_deb_pr_reg(dev,  pr,  "LAN8814_PTP_TSU_SOFT_RESET", LAN8814_PTP_TSU_SOFT_RESET, &val);
     return MEPA_RC_OK;
 }
+static void lan8814_ltc_model_dump(mepa_device_t *dev, const mepa_debug_print_t pr)
+{
+    phy_data_t *data = (phy_data_t *)dev->data;
+    lan8814_ltc_model_t *model = &data->ts_state.ltc_model;
+
+    if (pr != NULL && data->base_dev == dev && model->interval_ms) {
+        pr("LTC model: interval %u ms, hw reads %u, model reads %u, max error %lld ns, drift %lld ppb, latch error %lld ns\n",
+           model->interval_ms, model->hw_reads, model->sw_reads, (long long)model->max_err_ns, (long long)model->drift_ppb,
+           (long long)model->latch_err_ns);
+    }
+}
+
 static mepa_rc lan8814_ts_classifier_ptp_conf_priv(mepa_device_t *dev, mepa_bool_t ing, const mepa_ts_classifier_ptp_t *ptp_hdr_conf)
 {
     uint16_t val = 0, version = 0;
@@ -2505,6 +2693,7 @@ mepa_rc lan8814_ts_debug_info_dump(struct mepa_device *dev,
             MEPA_ENTER(dev);
             lan8814_ts_classifier_conf_reg_dump(dev, pr);
             lan8814_ts_clock_conf_reg_dump(dev, pr);
+            lan8814_ltc_model_dump(dev, pr);
             MEPA_EXIT(dev);
         }
         break;
@@ -106,7 +106,6 @@ static mepa_device_t lan887x_device[LAN887X_PHY_MAX];
 static phy_data_t lan887x_data[LAN887X_PHY_MAX];
 #endif
 
-static mepa_rc lan887x_phy_cable_diag_start(mepa_device_t *dev, mepa_bool_t is_hybrid, mepa_bool_t ms_mode);
 static mepa_rc lan887x_aneg_read_status(mepa_device_t *dev, mepa_status_t *status);
 static mepa_rc lan887x_int_reset(mepa_device_t *dev, const lan887x_reset_typ typ);
 static mepa_rc lan887x_phy_init(mepa_device_t *const dev);
@@ -1136,20 +1135,35 @@ done:
     return sqi_value;
 }
 
-static mepa_rc lan887x_cd_reset(mepa_device_t *dev, mepa_bool_t cd_done)
+// Issue the hard reset that precedes each cable diag phase. The phase itself is
+// run by lan887x_cd_service once the reset has completed.
+static mepa_rc lan887x_cd_reset(mepa_device_t *dev, lan887x_cd_state_t state)
 {
+    phy_data_t *data = (phy_data_t *)dev->data;
+    lan887x_cd_t *cd = &(data->cd);
     mepa_rc rc = MEPA_RC_OK;
-    lan887x_reset_typ typ = LAN887X_RST_HARD_ONLY;
 
+    MEPA_RC_GOTO(rc, lan887x_int_reset(dev, LAN887X_RST_HARD_ONLY));
 
-    if (cd_done) {
-        typ = LAN887X_RST_HARD;
-    }
-    MEPA_RC_GOTO(rc, lan887x_int_reset(dev, typ));
+    // reset must complete within 4 seconds
+    LAN887X_MTIMER_START(&cd->timer, 4000U);
+    cd->state = state;
 
 error:
     return rc;
+}
+
+static mepa_bool_t lan887x_cd_reset_done(mepa_device_t *dev)
+{
+    uint16_t tmp = 0;
 
+    (void) phy_reg_rd(dev, MII_BMCR, &tmp);
+    return ((tmp & BMCR_RESET) == BMCR_RESET ? PHY_FALSE : PHY_TRUE);
+}
+
+static mepa_bool_t lan887x_cd_active(const lan887x_cd_t *cd)
+{
+    return (cd->state != LAN887X_CD_IDLE && cd->state != LAN887X_CD_DONE);
 }
 
 static mepa_rc lan887x_int_reset(mepa_device_t *dev, const lan887x_reset_typ typ)
@@ -1159,8 +1173,10 @@ static mepa_rc lan887x_int_reset(mepa_device_t *dev, const lan887x_reset_typ typ
     T_I( MEPA_TRACE_GRP_GEN, "PHY reset & initialize! \r\n");
 
     //reset PHY
-    if (typ == LAN887X_RST_HARD || typ == LAN887X_RST_HARD_ONLY) { //hard-reset
-        MEPA_RC_GOTO(rc, lan887x_phy_reset(dev, PHY_TRUE));
+    if (typ == LAN887X_RST_HARD || typ == LAN887X_RST_HARD_ONLY || typ == LAN887X_RST_HARD_DONE) { //hard-reset
+        if (typ != LAN887X_RST_HARD_DONE) {
+            MEPA_RC_GOTO(rc, lan887x_phy_reset(dev, PHY_TRUE));
+        }
 
         if (typ == LAN887X_RST_HARD_ONLY) {
             rc = MEPA_RC_OK;
@@ -1178,7 +1194,8 @@ static mepa_rc lan887x_int_reset(mepa_device_t *dev, const lan887x_reset_typ typ
     }
 
     if (typ == LAN887X_RST_SOFT_EXT ||
-            typ == LAN887X_RST_HARD) {
+            typ == LAN887X_RST_HARD ||
+            typ == LAN887X_RST_HARD_DONE) {
         MEPA_RC_GOTO(rc, lan887x_phy_setup(dev));
     }
 
@@ -1202,7 +1219,10 @@ struct cable_test_start {
     uint16_t value;
 };
 
-static mepa_rc lan887x_cable_test_report(mepa_device_t *const dev, mepa_bool_t ms_mode)
+// Called once for each completed measurement. A non-hybrid measurement that
+// detects a fault is followed by a hybrid measurement to find the distance.
+// Otherwise the result is set and the configuration restore is started.
+static mepa_rc lan887x_cable_test_report(mepa_device_t *const dev)
 {
     uint16_t pos_peak_cycle_hybrid = 0, pos_peak_in_phases_hybrid = 0;
     uint16_t pos_peak = 0, neg_peak = 0;
@@ -1220,60 +1240,63 @@ static mepa_rc lan887x_cable_test_report(mepa_device_t *const dev, mepa_bool_t m
     lan887x_cd_status_t detect = LAN87XX_CABLE_TEST_OK;
 
     phy_data_t *data = (phy_data_t *)dev->data;
+    lan887x_cd_t *cd = &(data->cd);
     mepa_cable_diag_result_t *res = &(data->cd_res);
 
-    // read non-hybrid results
-    (void) phy_mmd_reg_rd(dev, MDIO_MMD_VEND1, 0x497U, &gain_idx);
-
-    (void) phy_mmd_reg_rd(dev, MDIO_MMD_VEND1, 0x49AU, &neg_peak);
-
-    (void) phy_mmd_reg_rd(dev, MDIO_MMD_VEND1, 0x49DU, &neg_peak_time);
-
-    (void) phy_mmd_reg_rd(dev, MDIO_MMD_VEND1, 0x499U, &pos_peak);
-
-    (void) phy_mmd_reg_rd(dev, MDIO_MMD_VEND1, 0x49CU, &pos_peak_time);
-
-    // calculate non-hybrid values
-    pos_peak_cycle = (pos_peak_time >> 7) & 0x7FU;
-    pos_peak_phase = pos_peak_time & 0x7FU;
-    pos_peak_in_phases = (pos_peak_cycle * 96U) + pos_peak_phase;
-    neg_peak_cycle = (neg_peak_time >> 7) & 0x7FU;
-    neg_peak_phase = neg_peak_time & 0x7FU;
-    neg_peak_in_phases = (neg_peak_cycle * 96U) + neg_peak_phase;
-
-    /* Deriving the status of cable */
-    if (pos_peak > noise_margin && neg_peak > noise_margin && gain_idx > 0U) {
-        if (pos_peak_in_phases > 0U &&
-                pos_peak_in_phases > neg_peak_in_phases &&
-                ((pos_peak_in_phases - neg_peak_in_phases) >= min_time_diff) &&
-                ((pos_peak_in_phases - neg_peak_in_phases) < max_time_diff)) {
-            detect = LAN87XX_CABLE_TEST_SHORT;
-        } else if (neg_peak_in_phases > 0U &&
-                   neg_peak_in_phases > pos_peak_in_phases &&
-                   ((neg_peak_in_phases - pos_peak_in_phases) >= min_time_diff) &&
-                   ((neg_peak_in_phases - pos_peak_in_phases) < max_time_diff)) {
-            detect = LAN87XX_CABLE_TEST_OPEN;
+    if (cd->state == LAN887X_CD_RUN) {
+        // read non-hybrid results
+        (void) phy_mmd_reg_rd(dev, MDIO_MMD_VEND1, 0x497U, &gain_idx);
+
+        (void) phy_mmd_reg_rd(dev, MDIO_MMD_VEND1, 0x49AU, &neg_peak);
+
+        (void) phy_mmd_reg_rd(dev, MDIO_MMD_VEND1, 0x49DU, &neg_peak_time);
+
+        (void) phy_mmd_reg_rd(dev, MDIO_MMD_VEND1, 0x499U, &pos_peak);
+
+        (void) phy_mmd_reg_rd(dev, MDIO_MMD_VEND1, 0x49CU, &pos_peak_time);
+
+        // calculate non-hybrid values
+        pos_peak_cycle = (pos_peak_time >> 7) & 0x7FU;
+        pos_peak_phase = pos_peak_time & 0x7FU;
+        pos_peak_in_phases = (pos_peak_cycle * 96U) + pos_peak_phase;
+        neg_peak_cycle = (neg_peak_time >> 7) & 0x7FU;
+        neg_peak_phase = neg_peak_time & 0x7FU;
+        neg_peak_in_phases = (neg_peak_cycle * 96U) + neg_peak_phase;
+
+        /* Deriving the status of cable */
+        if (pos_peak > noise_margin && neg_peak > noise_margin && gain_idx > 0U) {
+            if (pos_peak_in_phases > 0U &&
+                    pos_peak_in_phases > neg_peak_in_phases &&
+                    ((pos_peak_in_phases - neg_peak_in_phases) >= min_time_diff) &&
+                    ((pos_peak_in_phases - neg_peak_in_phases) < max_time_diff)) {
+                detect = LAN87XX_CABLE_TEST_SHORT;
+            } else if (neg_peak_in_phases > 0U &&
+                       neg_peak_in_phases > pos_peak_in_phases &&
+                       ((neg_peak_in_phases - pos_peak_in_phases) >= min_time_diff) &&
+                       ((neg_peak_in_phases - pos_peak_in_phases) < max_time_diff)) {
+                detect = LAN87XX_CABLE_TEST_OPEN;
+            } else {
+                detect = LAN87XX_CABLE_TEST_OK;
+            }
         } else {
             detect = LAN87XX_CABLE_TEST_OK;
         }
-    } else {
-        detect = LAN87XX_CABLE_TEST_OK;
-    }
+        cd->detect = detect;
+        cd->pos_peak_in_phases = pos_peak_in_phases;
+        cd->neg_peak_in_phases = neg_peak_in_phases;
 
-
-    if (detect == LAN87XX_CABLE_TEST_OK) {
+        if (detect != LAN87XX_CABLE_TEST_OK) {
+            //For Hybrid values, reported when that measurement completes
+            MEPA_RC_GOTO(rc, lan887x_cd_reset(dev, LAN887X_CD_RESET_HYBRID));
+            goto error;
+        }
         distance = 0.0F;
-        /*** SOFT RESET to restore configuration ***/
-        MEPA_RC_GOTO(rc, lan887x_cd_reset(dev, PHY_TRUE));
     } else {
-        //For Hybrid values
-        MEPA_RC_GOTO(rc, lan887x_phy_cable_diag_start(dev, PHY_TRUE, ms_mode));
+        detect = cd->detect;
+
         /* read hybrid results */
         (void) phy_mmd_reg_rd(dev, MDIO_MMD_VEND1, 0x49CU, &pos_peak_time_hybrid);
 
-        /*** SOFT RESET to restore configuration ***/
-        (void) lan887x_cd_reset(dev, PHY_TRUE);
-
         /* calculate hybrid values */
         pos_peak_cycle_hybrid = (pos_peak_time_hybrid >> 7) & 0x7FU;
         pos_peak_phase_hybrid = pos_peak_time_hybrid & 0x7FU;
@@ -1286,9 +1309,9 @@ static mepa_rc lan887x_cable_test_report(mepa_device_t *const dev, mepa_bool_t m
          * * 0.0159520967437766;
          */
         if (detect == LAN87XX_CABLE_TEST_SHORT) {
-            diff_dist = (neg_peak_in_phases - pos_peak_in_phases_hybrid);
+            diff_dist = (cd->neg_peak_in_phases - pos_peak_in_phases_hybrid);
         } else {
-            diff_dist = (pos_peak_in_phases - pos_peak_in_phases_hybrid);
+            diff_dist = (cd->pos_peak_in_phases - pos_peak_in_phases_hybrid);
         }
         distance = ((((float)diff_dist) * 15953.0F) / 1000000.0F);
     }
@@ -1316,10 +1339,14 @@ static mepa_rc lan887x_cable_test_report(mepa_device_t *const dev, mepa_bool_t m
         break;
     }
 
+    /*** HARD RESET to restore configuration ***/
+    MEPA_RC_GOTO(rc, lan887x_cd_reset(dev, LAN887X_CD_RESTORE));
+
 error:
     return rc;
 }
 
+// Set up the DSP for a measurement, after the reset issued by lan887x_cd_reset
 static mepa_rc lan887x_phy_cable_diag_common(mepa_device_t *dev, mepa_bool_t is_hybrid, mepa_bool_t ms_mode)
 {
     static const struct cable_test_start values[] = {
@@ -1340,9 +1367,6 @@ static mepa_rc lan887x_phy_cable_diag_common(mepa_device_t *dev, mepa_bool_t is_
     //setup master/slave based on ms_mode
     uint16_t ms_val = (ms_mode == PHY_TRUE ? MDIO_PMA_PMD_BT1_CTRL_CFG_MST : 0U);
 
-    /*** SOFT RESET ONLY ***/
-    MEPA_RC_GOTO(rc, lan887x_cd_reset(dev, PHY_FALSE));
-
     /* Forcing DUT to master mode, avoids headaches and
      * we don't care about mode during diagnostics
      */
@@ -1378,49 +1402,101 @@ error:
     return rc;
 }
 
-static mepa_rc lan887x_phy_cable_diag_start(mepa_device_t *dev, mepa_bool_t is_hybrid, mepa_bool_t ms_mode)
+// Set up and start a measurement, without waiting for it to complete
+static mepa_rc lan887x_cd_measure_start(mepa_device_t *dev, mepa_bool_t is_hybrid)
 {
     phy_data_t *data = (phy_data_t *)dev->data;
-    mepa_rc rc = MEPA_RC_INV_STATE;
+    lan887x_cd_t *cd = &(data->cd);
+    mepa_rc rc = MEPA_RC_OK;
 
-    if (data->init_done && data->conf.admin.enable) {
-        mepa_bool_t diagTimeout = PHY_FALSE;
-        mepa_bool_t bDone = PHY_FALSE;
-        mepa_mtimer_t   timer = { 0 };
-        mepa_cable_diag_result_t *res = &(data->cd_res);
+    MEPA_RC_GOTO(rc, lan887x_phy_cable_diag_common(dev, is_hybrid, cd->ms_mode));
 
-        MEPA_RC_GOTO(rc, lan887x_phy_cable_diag_common(dev, is_hybrid, ms_mode));
+    /* start cable diag */
+    MEPA_RC_GOTO(rc, phy_mmd_reg_wr(dev, MDIO_MMD_VEND1,
+                                    LAN887X_DSP_REGS_START_CBL_DIAG_100,
+                                    LAN887X_DSP_REGS_START_CBL_DIAG_EN));
 
-        /* start cable diag */
-        MEPA_RC_GOTO(rc, phy_mmd_reg_wr(dev, MDIO_MMD_VEND1,
-                                        LAN887X_DSP_REGS_START_CBL_DIAG_100,
-                                        LAN887X_DSP_REGS_START_CBL_DIAG_EN));
+    // cable diag must finish within 4 seconds
+    LAN887X_MTIMER_START(&cd->timer, 4000U);
+    cd->state = (is_hybrid ? LAN887X_CD_RUN_HYBRID : LAN887X_CD_RUN);
 
-        LAN887X_MTIMER_START(&timer, 4000U);
+error:
+    return rc;
+}
 
-        // wait for cable diag to finish or timeout (4 seconds)
-        while (bDone == PHY_FALSE && diagTimeout == PHY_FALSE) {
-            uint16_t tmp = 0;
+// Start a cable diag with the reset before the non-hybrid measurement
+static mepa_rc lan887x_phy_cable_diag_start(mepa_device_t *dev, mepa_bool_t ms_mode)
+{
+    phy_data_t *data = (phy_data_t *)dev->data;
+    mepa_rc rc = MEPA_RC_INV_STATE;
+
+    if (data->init_done && data->conf.admin.enable) {
+        data->cd.ms_mode = ms_mode;
+        MEPA_RC_GOTO(rc, lan887x_cd_reset(dev, LAN887X_CD_RESET));
+    }
+
+error:
+    return rc;
+}
 
-            diagTimeout = MEPA_MTIMER_TIMEOUT(&timer);
-            (void) phy_mmd_reg_rd(dev, MDIO_MMD_VEND1, LAN887X_DSP_REGS_START_CBL_DIAG_100, &tmp);
-            if ((tmp & LAN887X_DSP_REGS_START_CBL_DIAG_DONE) == LAN887X_DSP_REGS_START_CBL_DIAG_DONE) {
-                bDone = PHY_TRUE;
+// Advance a running cable diag by at most one phase. Called with the lock held.
+static mepa_rc lan887x_cd_service(mepa_device_t *dev)
+{
+    phy_data_t *data = (phy_data_t *)dev->data;
+    lan887x_cd_t *cd = &(data->cd);
+    mepa_rc rc = MEPA_RC_OK;
+    uint16_t tmp = 0;
+
+    switch (cd->state) {
+    case LAN887X_CD_RESET:
+    case LAN887X_CD_RESET_HYBRID:
+    case LAN887X_CD_RESTORE:
+        if (lan887x_cd_reset_done(dev) == PHY_FALSE) {
+            if (MEPA_MTIMER_TIMEOUT(&cd->timer)) {
+                T_E( MEPA_TRACE_GRP_GEN, "PHY cable_diag reset timed out\r\n");
+                rc = MEPA_RC_INCOMPLETE;
             }
+        } else if (cd->state == LAN887X_CD_RESTORE) {
+            cd->state = LAN887X_CD_DONE;
+            rc = lan887x_int_reset(dev, LAN887X_RST_HARD_DONE);
+        } else {
+            rc = lan887x_cd_measure_start(dev, (cd->state == LAN887X_CD_RESET_HYBRID ? PHY_TRUE : PHY_FALSE));
         }
-        if (bDone == PHY_FALSE) {
+        break;
+
+    case LAN887X_CD_RUN:
+    case LAN887X_CD_RUN_HYBRID:
+        (void) phy_mmd_reg_rd(dev, MDIO_MMD_VEND1, LAN887X_DSP_REGS_START_CBL_DIAG_100, &tmp);
+        if ((tmp & LAN887X_DSP_REGS_START_CBL_DIAG_DONE) == LAN887X_DSP_REGS_START_CBL_DIAG_DONE) {
+            /* stop cable diag */
+            (void) phy_mmd_reg_clear_bits(dev, MDIO_MMD_VEND1, LAN887X_DSP_REGS_START_CBL_DIAG_100,
+                                          LAN887X_DSP_REGS_START_CBL_DIAG_EN);
+            rc = lan887x_cable_test_report(dev);
+        } else if (MEPA_MTIMER_TIMEOUT(&cd->timer)) {
+            T_E( MEPA_TRACE_GRP_GEN, "PHY cable_diag timed out\r\n");
             rc = MEPA_RC_INCOMPLETE;
-            res->status[0] = MESA_VERIPHY_STATUS_ABNORM;
-            T_E( MEPA_TRACE_GRP_GEN, "PHY cable_diag failed to start\r\n");
+        }
+        break;
+
+    default:
+        break;
+    }
+
+    if (rc != MEPA_RC_OK) {
+        data->cd_res.length[0] = 0;
+        data->cd_res.status[0] = MESA_VERIPHY_STATUS_ABNORM;
+        if (cd->state == LAN887X_CD_RESTORE || cd->state == LAN887X_CD_DONE) {
+            cd->state = LAN887X_CD_DONE;
         } else {
-            /* stop cable diag */
+            /* stop cable diag and restore configuration */
             (void) phy_mmd_reg_clear_bits(dev, MDIO_MMD_VEND1, LAN887X_DSP_REGS_START_CBL_DIAG_100,
                                           LAN887X_DSP_REGS_START_CBL_DIAG_EN);
-            rc = MEPA_RC_OK;
+            if (lan887x_cd_reset(dev, LAN887X_CD_RESTORE) != MEPA_RC_OK) {
+                cd->state = LAN887X_CD_DONE;
+            }
         }
     }
 
-error:
     return rc;
 }
 
@@ -1618,6 +1694,7 @@ static void lan887x_fill_probe_data(mepa_driver_t *drv,
     data->cd_res.link = PHY_LINKDOWN;
     data->cd_res.length[0] = 0;
     data->cd_res.status[0] = MESA_VERIPHY_STATUS_UNKNOWN;
+    data->cd.state = LAN887X_CD_IDLE;
 
     (void) lan887x_phy_setup(dev);
 
@@ -1769,6 +1846,16 @@ static mepa_rc lan887x_poll(struct mepa_device *dev, mepa_status_t *status)
         rc = MEPA_RC_OK;
         MEPA_ENTER(dev);
 
+        // Advance a running cable diag, so diagnostics on all ports overlap
+        (void) lan887x_cd_service(dev);
+
+        // The PHY is reset and reconfigured by the cable diag, so the link is down until it is done
+        if (lan887x_cd_active(&data->cd)) {
+            data->link_status = PHY_FALSE;
+            status->link = PHY_FALSE;
+            goto error;
+        }
+
         //Current link status
         data->link_status = PHY_FALSE;
 
@@ -2211,6 +2298,8 @@ static mepa_rc lan887x_debug_info(struct mepa_device *dev,
 
 // Mode is assumed as Masetr mode always
 // Slave mode to be supported in future
+// Only the first reset is issued here. The following phases are advanced by
+// lan887x_cable_diag_get and lan887x_poll, and the result is read with lan887x_cable_diag_get.
 static mepa_rc lan887x_cable_diag_start(mepa_device_t *dev, int32_t mode)
 {
     mepa_rc rc = MEPA_RC_ERROR;
@@ -2224,6 +2313,11 @@ static mepa_rc lan887x_cable_diag_start(mepa_device_t *dev, int32_t mode)
 
         MEPA_ENTER(dev);
 
+        if (lan887x_cd_active(&data->cd)) {
+            T_I( MEPA_TRACE_GRP_GEN, "PHY cable_diag already running\r\n");
+            goto error;
+        }
+
         (void)  phy_c45_get_link_status(dev, &link_status);
         /* read cable diag status*/
         data->cd_res.link = data->link_status;
@@ -2233,24 +2327,17 @@ static mepa_rc lan887x_cable_diag_start(mepa_device_t *dev, int32_t mode)
         if (data->link_status == PHY_LINKUP) { /* Link is up*/
 
             data->cd_res.status[0] = MESA_VERIPHY_STATUS_OK;
+            data->cd.state = LAN887X_CD_DONE;
             (void) phy_mmd_reg_clear_bits(dev, MDIO_MMD_VEND1, LAN887X_DSP_REGS_START_CBL_DIAG_100,
                                           LAN887X_DSP_REGS_START_CBL_DIAG_EN);
-            /*** SOFT RESET to restore configuration ***/
-            MEPA_RC_GOTO(rc, lan887x_cd_reset(dev, PHY_TRUE));
+            /*** HARD RESET to restore configuration, completed by poll or cable_diag_get ***/
+            MEPA_RC_GOTO(rc, lan887x_cd_reset(dev, LAN887X_CD_RESTORE));
 
         } else { /* Link is down. Start cable diag */
 
-            MEPA_RC_GOTO(rc, lan887x_phy_cable_diag_start(dev, PHY_FALSE, is_master));
-
-            //Update current link status
-            (void)  phy_c45_get_link_status(dev, &link_status);
-
-            MEPA_RC_GOTO(rc, lan887x_cable_test_report(dev, is_master));
+            MEPA_RC_GOTO(rc, lan887x_phy_cable_diag_start(dev, is_master));
         }
 
-        //Update current link status
-        (void)  phy_c45_get_link_status(dev, &link_status);
-
 error:
         MEPA_EXIT(dev);
     }
@@ -2258,6 +2345,7 @@ error:
     return rc;
 }
 
+// Returns MEPA_RC_INCOMPLETE while the measurement is running
 static mepa_rc lan887x_cable_diag_get(struct mepa_device *dev, mepa_cable_diag_result_t *res)
 {
     mepa_rc rc = MEPA_RC_ERROR;
@@ -2268,9 +2356,18 @@ static mepa_rc lan887x_cable_diag_get(struct mepa_device *dev, mepa_cable_diag_r
         rc = MEPA_RC_OK;
 
         MEPA_ENTER(dev);
-        *res = data->cd_res;
-        data->cd_res.length[0] = 0;
-        data->cd_res.status[0] = MESA_VERIPHY_STATUS_UNKNOWN;
+
+        // A failed measurement is reported as MESA_VERIPHY_STATUS_ABNORM
+        (void) lan887x_cd_service(dev);
+
+        if (lan887x_cd_active(&data->cd)) {
+            rc = MEPA_RC_INCOMPLETE;
+        } else {
+            *res = data->cd_res;
+            data->cd_res.length[0] = 0;
+            data->cd_res.status[0] = MESA_VERIPHY_STATUS_UNKNOWN;
+            data->cd.state = LAN887X_CD_IDLE;
+        }
 
         MEPA_EXIT(dev);
     }
@@ -104,6 +104,34 @@ typedef struct {
     mepa_gpio_mode_t                inh_mode;
 } lan887x_tc10_data_t;
 
+typedef enum {
+    LAN87XX_CABLE_TEST_OK,
+    LAN87XX_CABLE_TEST_OPEN,
+    LAN87XX_CABLE_TEST_SHORT,
+} lan887x_cd_status_t;
+
+typedef enum {
+    LAN887X_CD_IDLE,            // no cable diag, or result read
+    LAN887X_CD_RESET,           // reset before measuring non-hybrid values
+    LAN887X_CD_RUN,             // measuring non-hybrid values
+    LAN887X_CD_RESET_HYBRID,    // reset before measuring hybrid values
+    LAN887X_CD_RUN_HYBRID,      // measuring hybrid values
+    LAN887X_CD_RESTORE,         // reset before restoring the configuration, result in cd_res
+    LAN887X_CD_DONE,            // result ready in cd_res
+} lan887x_cd_state_t;
+
+// Cable diag in progress. The resets and measurements run in the PHY, and each
+// phase is advanced by cable_diag_get and poll, so no call waits for them and
+// diagnostics on several ports can overlap.
+typedef struct {
+    lan887x_cd_state_t      state;
+    mepa_bool_t             ms_mode;
+    mepa_mtimer_t           timer;              // reset or measurement timeout
+    lan887x_cd_status_t     detect;             // result of non-hybrid measurement
+    uint16_t                pos_peak_in_phases;
+    uint16_t                neg_peak_in_phases;
+} lan887x_cd_t;
+
 typedef struct {
     mepa_bool_t             init_done;
     mepa_bool_t             link_status;
@@ -116,6 +144,7 @@ typedef struct {
     phy_dev_info_t          dev;
     mepa_bool_t             ctx_status;
     mepa_cable_diag_result_t cd_res;
+    lan887x_cd_t            cd;
     lan887x_tc10_data_t         tc10_cfg;
     mepa_gpio_conf_t        led_conf[4];
     /* Pointer to the device of base port on the phy chip */
@@ -141,16 +170,11 @@ typedef enum  {
     LAN887X_RST_HARD_ONLY,      // hard-reset only
     LAN887X_RST_HARD,           // hard-reset, phy_setup and re-configure
     LAN887X_RST_SKIP_TO_CONF,   // no reset. proceed to re-configure
+    LAN887X_RST_HARD_DONE,      // hard-reset already done, phy_setup and re-configure
     //Anything new above this line
     LAN887X_RST_MAX
 } lan887x_reset_typ;
 
-typedef enum {
-    LAN87XX_CABLE_TEST_OK,
-    LAN87XX_CABLE_TEST_OPEN,
-    LAN87XX_CABLE_TEST_SHORT,
-} lan887x_cd_status_t;
-
 extern mepa_tc10_driver_t lan887x_tc10_drivers;
 mepa_rc lan887x_phy_tc10_set_config(struct mepa_device *dev, lan887x_tc10_data_t *cfg);
 
@@ -1144,6 +1144,31 @@ vtss_rc vtss_macsec_pattern_get(const vtss_inst_t                  inst,
                                 const vtss_macsec_match_action_t   action,
                                 vtss_macsec_match_pattern_t       *const pattern);
 
+#define VTSS_MACSEC_TXN_PATTERN_MAX MEPA_MACSEC_TXN_PATTERN_MAX
+#define VTSS_MACSEC_TXN_RX_SC_MAX   MEPA_MACSEC_TXN_RX_SC_MAX
+
+typedef mepa_macsec_txn_pattern_t vtss_macsec_txn_pattern_t;
+typedef mepa_macsec_txn_sa_t vtss_macsec_txn_sa_t;
+typedef mepa_macsec_txn_rx_sc_t vtss_macsec_txn_rx_sc_t;
+typedef mepa_macsec_txn_secy_t vtss_macsec_txn_secy_t;
+
+/** \brief Create a number of SecYs including their patterns, SCs and SAs as one transaction.
+ * The transaction is validated before any register is written. On 1G PHYs the MACsec
+ * registers are accessed in batch mode while the transaction is written. If any step
+ * fails, the SecYs created by the transaction are deleted again.
+ *
+ * \param inst   [IN]  VTSS-API instance.
+ * \param cnt    [IN]  Number of SecYs.
+ * \param secy   [IN]  SecY configurations.
+ * \param failed [OUT] Index of the failing SecY, or cnt if all were created. May be NULL.
+ *
+ * \return VTSS_RC_OK when successful; otherwise the error code of the failing step.
+ */
+vtss_rc vtss_macsec_txn_commit(const vtss_inst_t            inst,
+                               const u32                    cnt,
+                               const vtss_macsec_txn_secy_t *const secy,
+                               u32                          *const failed);
+
 #define VTSS_MACSEC_DEFAULT_ACTION_DROP MEPA_MACSEC_DEFAULT_ACTION_DROP
 #define VTSS_MACSEC_DEFAULT_ACTION_BYPASS MEPA_MACSEC_DEFAULT_ACTION_BYPASS
 
@@ -1314,6 +1339,23 @@ vtss_rc vtss_macsec_frame_get(const vtss_inst_t             inst,
                               u32                           *const return_length,
                               u8                            *const frame);
 
+typedef mepa_macsec_capture_frame_t vtss_macsec_capture_frame_t;
+typedef mepa_macsec_capture_ring_t vtss_macsec_capture_ring_t;
+
+/** \brief Move all frames in the capture buffer into a ring and re-arm capturing. Used for test/debugging.
+ *
+ * \param inst          [IN]     VTSS-API instance.
+ * \param port_no       [IN]     VTSS-API port no
+ * \param ring          [IN/OUT] Ring to add the frames to.
+ * \param cnt           [OUT]    Number of frames read from the capture buffer, including dropped ones.
+ *
+ * \return VTSS_RC_OK when successful; VTSS_RC_ERROR if parameters are invalid.
+ */
+vtss_rc vtss_macsec_frame_ring_get(const vtss_inst_t             inst,
+                                   const vtss_port_no_t          port_no,
+                                   vtss_macsec_capture_ring_t    *const ring,
+                                   u32                           *const cnt);
+
 #define VTSS_MACSEC_SEQ_NONE MEPA_MACSEC_SEQ_NONE
 #define VTSS_MACSEC_SEQ_THRESHOLD_EVENT MEPA_MACSEC_SEQ_THRESHOLD_EVENT
 #define VTSS_MACSEC_SEQ_ROLLOVER_EVENT MEPA_MACSEC_SEQ_ROLLOVER_EVENT
@@ -1407,6 +1449,23 @@ vtss_rc vtss_macsec_egr_intr_sa_get(const vtss_inst_t    inst,
                                     vtss_macsec_port_t   *const port,
                                     u16                  *const an);
 
+typedef mepa_macsec_sa_event_t vtss_macsec_sa_event_t;
+
+/**
+ * \brief Get the Tx SAs with active sequence number events on all MACsec ports
+ *
+ * \param inst    [IN]   Target instance reference.
+ * \param max_cnt [IN]   Size of the events array
+ * \param events  [OUT]  SA events
+ * \param cnt     [OUT]  Number of SA events returned
+ *
+ * \return VTSS_RC_OK when all events are returned, VTSS_RC_INCOMPLETE when more events are pending.
+ **/
+vtss_rc vtss_macsec_sa_event_poll(const vtss_inst_t      inst,
+                                  const u32              max_cnt,
+                                  vtss_macsec_sa_event_t *const events,
+                                  u32                    *const cnt);
+
 /**
  * \brief Chip register read
  *
@@ -1136,6 +1136,24 @@ vtss_rc vtss_phy_10g_debug_register_dump (const vtss_inst_t inst,
                                           BOOL clear,
                                           const vtss_port_no_t port_no);
 
+/**
+ * \brief Binary snapshot of the registers printed by vtss_phy_10g_debug_register_dump().
+ * Avaliable for PHY family Venice & Malibu \n
+ * Registers at consecutive addresses are read in one burst, using the SPI batch callout when available.
+ * The API lock is only held while reading one burst.
+ *
+ * \param inst [IN]          Target instance reference.
+ * \param port_no [IN]       Port number.
+ * \param snap [IN/OUT]      Snapshot buffer and position, see mepa_reg_snapshot_get(). The entry block is the MMD.
+ *
+ * \return
+ *   VTSS_RC_OK on success.\n
+ *   VTSS_RC_ERR_PARM if the buffer is empty.
+ **/
+vtss_rc vtss_phy_10g_reg_snapshot_get(const vtss_inst_t             inst,
+                                      const vtss_port_no_t          port_no,
+                                      vtss_phy_reg_snapshot_t *const snap);
+
 /** \brief 10G Phy OB status*/
 typedef struct {
     u8 r_ctrl;  /**< slew rate r active value */
@@ -1819,6 +1837,7 @@ typedef enum {
 	VTSS_PHY_10G_FAST_SCAN_PLUS, /**<selects the fast scan feature with diagonal points */
 	VTSS_PHY_10G_QUICK_SCAN, /**<selects the quick scan feature */
 	VTSS_PHY_10G_FULL_SCAN, /**<selects the full scan freature */
+	VTSS_PHY_10G_ADAPTIVE_SCAN, /**<selects the adaptive coarse-to-fine scan feature (Malibu only) */
 } vtss_phy_10g_vscope_scan_t;
 
 /** \ brief VSCOPE scan configuration */
@@ -1879,6 +1898,9 @@ typedef struct{
 	u32 x_count;	/**<max value for x ( upto which scan is to be performed) */
 	u32 y_count;	/**<max value for y ( upto which scan is to be performed) */
 	u32 ber;		/**<bit error rate */
+	u32 coarse_step;	/**<adaptive scan: coarse grid step in scan points, 0 selects 4 */
+	u32 min_eye_x;	/**<adaptive scan: stop refining once the error free phase opening reaches this, 0 to refine the whole eye boundary */
+	u32 min_eye_y;	/**<adaptive scan: stop refining once the error free amplitude opening reaches this */
 } vtss_phy_10g_vscope_scan_conf_t;
 
 #define PHASE_POINTS 128 /**<phase points range from 0-127 */
@@ -1890,7 +1912,9 @@ typedef struct {
 	i32 error_free_x;	/**<error free x values in case of fast eye scan */
 	i32 error_free_y;	/**<error free y values in case of fast eye scan */
 	i32 amp_range;		/**<amp range in case of fast eye scan */
-	u32 errors[PHASE_POINTS][AMPLITUDE_POINTS];	/**<error matrix in full scan mode */
+	u32 errors[PHASE_POINTS][AMPLITUDE_POINTS];	/**<error matrix in full and adaptive scan mode */
+	u32 samples;		/**<number of points measured in full and adaptive scan mode */
+	u32 full_samples;	/**<number of points a full scan of the same grid measures */
 } vtss_phy_10g_vscope_scan_status_t;
 
 /** \brief VSCOPE fast scan status
@@ -1907,6 +1931,23 @@ vtss_rc vtss_phy_10g_vscope_scan_status_get(const vtss_inst_t inst,
 		const vtss_port_no_t port_no,
 		vtss_phy_10g_vscope_scan_status_t *const conf);
 
+/** \brief VSCOPE adaptive scan of several lanes of the same Malibu chip.
+ * The coarse pass is interleaved across the lanes, so all lanes must use
+ * VTSS_PHY_10G_ADAPTIVE_SCAN and the same scan grid.
+ * \param inst      [IN]     Target instance reference.
+ * \param port_cnt  [IN]     Number of ports (1-4)
+ * \param port_list [IN]     Ports to scan
+ * \param conf_list [IN/OUT] Scan configuration and status per port
+ *
+ * \return
+ *   VTSS_RC_OK on success.\n
+ *   VTSS_RC_ERROR on error.
+ **/
+vtss_rc vtss_phy_10g_vscope_scan_status_multi_get(const vtss_inst_t inst,
+		const u32 port_cnt,
+		const vtss_port_no_t *const port_list,
+		vtss_phy_10g_vscope_scan_status_t *const conf_list);
+
 /* 10G PHY PRBS implementation */
 
 /** \brief 10G PHY direction */
@@ -2901,6 +2942,30 @@ vtss_rc vtss_phy_10g_event_poll(const vtss_inst_t     inst,
                                 const vtss_port_no_t  port_no,
                                 vtss_phy_10g_event_t  *const ev_mask);
 
+/** \brief Chip level interrupt summary */
+typedef struct {
+    u32            chan_pending;   /**< Bit n set: channel n has a pending channel or 1588 interrupt */
+    BOOL           gpio_pending;   /**< GPIO interrupt pending (e.g. SFP module detect). Not tied to a single channel */
+    vtss_port_no_t port_no[4];     /**< API port number of channel n, VTSS_PORT_NO_NONE if the channel is not in use */
+} vtss_phy_10g_event_summary_t;
+
+/**
+ * \brief Get the interrupt summary of the PHY chip that a port belongs to.
+ *
+ * The aggregated interrupt status is read once for the whole chip, so an interrupt handler
+ * only needs to call vtss_phy_10g_event_poll() for the ports that have pending interrupts.
+ * Supported on Malibu. Other PHYs return VTSS_RC_ERROR, and all ports must be polled.
+ *
+ * \param inst [IN]     Target instance reference.
+ * \param port_no [IN]  Any port number of the PHY chip.
+ * \param summary [OUT] Pending channels and their port numbers.
+ *
+ * \return Return code.
+ **/
+vtss_rc vtss_phy_10g_event_summary_get(const vtss_inst_t            inst,
+                                       const vtss_port_no_t         port_no,
+                                       vtss_phy_10g_event_summary_t *const summary);
+
 /**
  * \brief poll and clear PCS STICKY Register
  *
@@ -2951,6 +3016,17 @@ vtss_rc vtss_phy_10g_extended_event_enable_set(const vtss_inst_t
  **/
 vtss_rc vtss_phy_10g_poll_1sec(const vtss_inst_t  inst);
 
+/**
+ * \brief Do the one second work of a single port.
+ * Alternative to vtss_phy_10g_poll_1sec(), which allows the application to spread the work over the second.
+ *
+ * \param inst [IN]     Target instance reference.
+ * \param port_no [IN]  Port number.
+ * \return Return code.
+ **/
+vtss_rc vtss_phy_10g_poll_1sec_port(const vtss_inst_t     inst,
+                                    const vtss_port_no_t  port_no);
+
 /** \brief Firmware status */
 typedef struct {
     u16             edc_fw_rev;      /**< FW revision */
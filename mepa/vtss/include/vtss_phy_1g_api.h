@@ -455,6 +455,51 @@ vtss_rc vtss_phy_chip_temp_get(const vtss_inst_t inst,
 vtss_rc vtss_phy_chip_temp_init(const vtss_inst_t inst,
                                 const vtss_port_no_t port_no);
 
+#define VTSS_PHY_CHIP_TEMP_PERIOD_DEFAULT 1 /**< Default chip temperature sampling period in seconds */
+
+/**
+ * \brief Set the chip temperature sampling period.
+ *
+ * vtss_phy_chip_temp_get() returns the last sampled temperature until it is older than the
+ * period. It then collects the conversion started by the previous call and starts the next,
+ * so it does not wait for the sensor.
+ *
+ * \param inst [IN]        Target instance reference
+ * \param port_no [IN]     Port number (Any port within the chip can be used).
+ * \param period_sec [IN]  Sampling period in seconds, 0 waits for a new conversion on every call.
+ *
+ * \return Return code.
+ **/
+vtss_rc vtss_phy_chip_temp_period_set(const vtss_inst_t    inst,
+                                      const vtss_port_no_t port_no,
+                                      const u32            period_sec);
+
+/**
+ * \brief Get the chip temperature sampling period.
+ *
+ * \param inst [IN]         Target instance reference
+ * \param port_no [IN]      Port number (Any port within the chip can be used).
+ * \param period_sec [OUT]  Sampling period in seconds.
+ *
+ * \return Return code.
+ **/
+vtss_rc vtss_phy_chip_temp_period_get(const vtss_inst_t    inst,
+                                      const vtss_port_no_t port_no,
+                                      u32                  *const period_sec);
+
+/**
+ * \brief Get the age of the temperature returned by vtss_phy_chip_temp_get().
+ *
+ * \param inst [IN]      Target instance reference
+ * \param port_no [IN]   Port number (Any port within the chip can be used).
+ * \param age_sec [OUT]  Seconds since the conversion was started, 0 if the sampling period is 0.
+ *
+ * \return Return code.
+ **/
+vtss_rc vtss_phy_chip_temp_age_get(const vtss_inst_t    inst,
+                                   const vtss_port_no_t port_no,
+                                   u32                  *const age_sec);
+
 
 /**
  * \brief Get PHY configuration.
@@ -494,6 +539,50 @@ vtss_rc vtss_phy_conf_set(const vtss_inst_t     inst,
 vtss_rc vtss_phy_status_get(const vtss_inst_t    inst,
                             const vtss_port_no_t port_no,
                             vtss_port_status_t   *const status);
+
+#define VTSS_PHY_STATUS_REFRESH_DEFAULT 10 /**< Default status refresh interval in seconds */
+
+/**
+ * \brief Set the PHY status refresh interval.
+ * While link is up and unchanged, vtss_phy_status_get() only reads the latched link status and the
+ * auxiliary control and status register (speed/duplex). The aneg result, link partner ability and media
+ * type are read again on a link transition, a latched link down event or when the refresh interval expires.
+ *
+ * \param inst [IN]        Target instance reference.
+ * \param port_no [IN]     Port number.
+ * \param refresh_sec [IN] Refresh interval in seconds, 0 reads all status registers on every call.
+ *
+ * \return Return code.
+ **/
+vtss_rc vtss_phy_status_refresh_set(const vtss_inst_t    inst,
+                                    const vtss_port_no_t port_no,
+                                    const u32            refresh_sec);
+
+/**
+ * \brief Get the PHY status refresh interval.
+ *
+ * \param inst [IN]         Target instance reference.
+ * \param port_no [IN]      Port number.
+ * \param refresh_sec [OUT] Refresh interval in seconds.
+ *
+ * \return Return code.
+ **/
+vtss_rc vtss_phy_status_refresh_get(const vtss_inst_t    inst,
+                                    const vtss_port_no_t port_no,
+                                    u32                  *const refresh_sec);
+
+/**
+ * \brief Get the number of vtss_phy_status_get() calls, which skipped the aneg and link partner registers.
+ *
+ * \param inst [IN]     Target instance reference.
+ * \param port_no [IN]  Port number.
+ * \param cnt [OUT]     Number of status reads done by the fast path.
+ *
+ * \return Return code.
+ **/
+vtss_rc vtss_phy_status_fast_cnt_get(const vtss_inst_t    inst,
+                                     const vtss_port_no_t port_no,
+                                     u32                  *const cnt);
 /**
  * \brief Get Clause37 Link pArtner's ability
  *
@@ -1451,6 +1540,11 @@ typedef struct
 /**
  * \brief debug function for getting phy statistics.
  *
+ * By default the counter registers are read on every call, so the clear-on-read counters hold the
+ * increments since the previous read. With a statistics period set (see vtss_phy_statistic_period_set()),
+ * the values come from the last read within the period, and calls inside the same period return the
+ * same increments again.
+ *
  * \param inst [IN]     Target instance reference.
  * \param port_no [IN]  Any phy port with the chip
  * \param statistics  [OUT]  Pointer to where to put the statistics.
@@ -1462,6 +1556,82 @@ vtss_rc vtss_phy_statistic_get(const vtss_inst_t    inst,
                                const vtss_port_no_t port_no,
                                vtss_phy_statistic_t *statistics);
 
+/** \brief Default number of seconds between reads of the PHY counters (read on every request), see vtss_phy_statistic_period_set() */
+#define VTSS_PHY_STATISTIC_PERIOD_DEFAULT 0
+
+/**
+ * \brief Phy statistics extended to 64 bits.
+ *
+ * The CRC error and receive error counter registers saturate at 255 and clear when read, so their
+ * totals are exact as long as fewer than 255 errors occur per statistics period.
+ * The good packet counter registers wrap at 10000 and are not cleared, so only the increment
+ * modulo 10000 is added per period. At line rate they wrap within milliseconds, and the totals
+ * are then lower than the actual packet count.
+ **/
+typedef struct {
+    u64 cu_good;               /**< Cu media CRC good packets received */
+    u64 cu_bad;                /**< Cu media CRC error packets received */
+    u64 serdes_tx_good;        /**< SerDes transmit good packets */
+    u64 serdes_tx_bad;         /**< SerDes transmit CRC error packets */
+    u64 rx_err_cnt_base_tx;    /**< 100/1000BASE-TX receive errors */
+    u64 media_mac_serdes_good; /**< Fiber media or MAC SerDes packets received with valid CRC */
+    u64 media_mac_serdes_crc;  /**< Fiber media or MAC SerDes CRC error packets received */
+} vtss_phy_statistic64_t;
+
+/**
+ * \brief Get the phy statistics extended to 64 bits.
+ *
+ * Every read of the counter registers adds to the totals, also the reads done by
+ * vtss_phy_statistic_get(), so any number of callers can poll without disturbing each other.
+ * With a statistics period set, the registers are read at most once per period.
+ *
+ * \param inst [IN]         Target instance reference.
+ * \param port_no [IN]      Port number.
+ * \param statistics [OUT]  Counters since the port was initialized or cleared.
+ *
+ * \return Return code.
+ **/
+vtss_rc vtss_phy_statistic64_get(const vtss_inst_t            inst,
+                                 const vtss_port_no_t         port_no,
+                                 vtss_phy_statistic64_t *const statistics);
+
+/**
+ * \brief Clear the 64 bit phy statistics.
+ *
+ * \param inst [IN]     Target instance reference.
+ * \param port_no [IN]  Port number.
+ *
+ * \return Return code.
+ **/
+vtss_rc vtss_phy_statistic64_clear(const vtss_inst_t    inst,
+                                   const vtss_port_no_t port_no);
+
+/**
+ * \brief Set the period between reads of the phy counter registers.
+ *
+ * \param inst [IN]        Target instance reference.
+ * \param port_no [IN]     Port number.
+ * \param period_sec [IN]  Period in seconds, 0 reads the counters on every request (default).
+ *
+ * \return Return code.
+ **/
+vtss_rc vtss_phy_statistic_period_set(const vtss_inst_t    inst,
+                                      const vtss_port_no_t port_no,
+                                      const u32            period_sec);
+
+/**
+ * \brief Get the period between reads of the phy counter registers.
+ *
+ * \param inst [IN]         Target instance reference.
+ * \param port_no [IN]      Port number.
+ * \param period_sec [OUT]  Period in seconds.
+ *
+ * \return Return code.
+ **/
+vtss_rc vtss_phy_statistic_period_get(const vtss_inst_t    inst,
+                                      const vtss_port_no_t port_no,
+                                      u32                  *const period_sec);
+
 
 
 /** \brief Internal loop-back type */
@@ -1670,6 +1840,20 @@ vtss_rc vtss_phy_debug_phyinfo_print(const vtss_inst_t         inst,
 vtss_rc vtss_phy_debug_register_dump(const vtss_inst_t inst,
                                        const vtss_debug_printf_t pr,
                                        BOOL clear, const vtss_port_no_t port_no);
+
+/** \brief Register snapshot buffer. The entry block is the register page. */
+typedef mepa_reg_snapshot_t vtss_phy_reg_snapshot_t;
+
+/**
+ * \brief Binary snapshot of the registers printed by vtss_phy_debug_register_dump().
+ *        The API lock is only held while reading one register page.
+ * \param inst      [IN]     Target instance reference.
+ * \param port_no   [IN]     Port in question
+ * \param snap      [IN/OUT] Snapshot buffer and position, see mepa_reg_snapshot_get().
+ * \return Return code. VTSS_RC_ERR_PARM if the buffer cannot hold one register page.*/
+vtss_rc vtss_phy_reg_snapshot_get(const vtss_inst_t             inst,
+                                  const vtss_port_no_t          port_no,
+                                  vtss_phy_reg_snapshot_t *const snap);
 /**
  * \brief Function for making getting the API updated with base port number for all ports. MUST not be called unless all ports are detected.
  * \param inst      [IN] Target instance reference.
@@ -1730,6 +1914,14 @@ vtss_rc vtss_phy_debug_regdump_print(const vtss_inst_t         inst,
                                      const vtss_port_no_t      page_no,
                                      const BOOL                print_hdr);
 
+/**
+ * \brief debug function for printing the register accesses done by the table driven chip init scripts
+ * \param inst      [IN] Target instance reference.
+ * \param pr        [IN] Function pointer to print function e.g. CPRINTF
+ * \return Return code. VTSS_RC_OK if the scripts were printed else error code.*/
+vtss_rc vtss_phy_debug_script_print(const vtss_inst_t         inst,
+                                    const vtss_debug_printf_t pr);
+
 
 
 /****************************************************************************
@@ -51,6 +51,16 @@
 #define VTSS_OPT_PHY_TRACE 1
 #endif
 
+// Cache of SD10G65 serdes setup calculations, included by default
+#if !defined(VTSS_OPT_PHY_SD10G65_CALC_CACHE)
+#define VTSS_OPT_PHY_SD10G65_CALC_CACHE 1
+#endif
+
+// Compare SD10G65 setup cache hits against a fresh calculation, excluded by default
+#if !defined(VTSS_OPT_PHY_SD10G65_CALC_CACHE_CHECK)
+#define VTSS_OPT_PHY_SD10G65_CALC_CACHE_CHECK 0
+#endif
+
 // VeriPHY, included by default */
 #if !defined(VTSS_PHY_OPT_VERIPHY)
 #define VTSS_PHY_OPT_VERIPHY 1
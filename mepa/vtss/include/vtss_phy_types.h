@@ -416,6 +416,32 @@ typedef vtss_rc (*vtss_spi_32bit_read_write_t)(const vtss_inst_t inst,
                                                u16            reg_num,
                                                u32            *const data);
 
+/** \brief Maximum number of operations in one SPI batch call */
+#define VTSS_SPI_BATCH_MAX 16
+
+/** \brief SPI 32 bit register operation */
+typedef struct {
+    BOOL read;     /**< Read (TRUE) or write (FALSE) */
+    u8   dev;      /**< MMD device number */
+    u16  reg_num;  /**< Register offset */
+    u32  *data;    /**< Read: Data read, write: Data to write */
+} vtss_spi_32bit_op_t;
+
+/**
+ * \brief SPI 32 bit batch read/write function
+ *
+ * \param inst    [IN]    Vitesse API instance.
+ * \param port_no [IN]    Port number.
+ * \param cnt     [IN]    Number of operations (1-VTSS_SPI_BATCH_MAX).
+ * \param ops     [INOUT] Operations, executed in order.
+ *
+ * \return Return code.
+ **/
+typedef vtss_rc (*vtss_spi_32bit_batch_t)(const vtss_inst_t   inst,
+                                          vtss_port_no_t      port_no,
+                                          u32                 cnt,
+                                          vtss_spi_32bit_op_t *const ops);
+
 /**
  * \brief SPI 64 bit read/write function
  *
@@ -597,6 +623,7 @@ typedef struct {
     vtss_spi_read_write_t    spi_read_write;    /**< Board specific SPI read/write callout function */
     vtss_spi_32bit_read_write_t spi_32bit_read_write; /**< Board specific SPI read/write callout function for 32 bit data */
     vtss_spi_64bit_read_write_t spi_64bit_read_write; /**< Board specific SPI read/write callout function for 64 bit data*/
+    vtss_spi_32bit_batch_t   spi_32bit_batch;   /**< Optional board specific SPI callout executing several 32 bit operations at once */
 #if defined(VTSS_FEATURE_WARM_START)
     BOOL                     warm_start_enable; /**< Allow warm start */
     vtss_restart_info_src_t  restart_info_src;  /**< Source of restart information */
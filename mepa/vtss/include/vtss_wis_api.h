@@ -174,6 +174,31 @@ typedef struct vtss_ewis_counter_s {
     u16 pn_ebc_s;       /**< Section BIP error count */
 } vtss_ewis_counter_t;
 
+/** \brief eWIS performance monitoring bin.
+ *  Accumulated performance primitives and errored seconds over a 15 minute or 24 hour interval.
+ */
+typedef struct vtss_ewis_pm_bin_s {
+    vtss_ewis_perf_t perf;     /**< Accumulated performance primitives */
+    u32              es_s;     /**< Section errored seconds (B1 error, LOS or LOF) */
+    u32              es_l;     /**< Near end line errored seconds (B2 error or AIS-L) */
+    u32              es_p;     /**< Near end path errored seconds (B3 error or path defect) */
+    u32              fes_l;    /**< Far end line errored seconds (REI-L or RDI-L) */
+    u32              fes_p;    /**< Far end path errored seconds (REI-P or far end path defect) */
+    u32              secs;     /**< Number of seconds accumulated in the bin */
+    u32              skipped;  /**< Number of seconds where the port was idle and the counters were not read */
+} vtss_ewis_pm_bin_t;
+
+/** \brief eWIS performance monitoring data */
+typedef struct vtss_ewis_pm_s {
+    BOOL                enable;      /**< Performance monitoring engine enabled */
+    vtss_ewis_perf_t    last;        /**< Performance primitives of the last second */
+    vtss_ewis_defects_t defects;     /**< Defects sampled in the last second */
+    vtss_ewis_pm_bin_t  cur_15min;   /**< Current 15 minute bin */
+    vtss_ewis_pm_bin_t  prev_15min;  /**< Previous (completed) 15 minute bin */
+    vtss_ewis_pm_bin_t  cur_24h;     /**< Current 24 hour bin */
+    vtss_ewis_pm_bin_t  prev_24h;    /**< Previous (completed) 24 hour bin */
+} vtss_ewis_pm_t;
+
 /** \brief eWIS test pattern mode types.
  */
 typedef enum vtss_ewis_test_pattern_s {
@@ -910,6 +935,52 @@ vtss_rc vtss_ewis_perf_mode_get(const vtss_inst_t inst,
                                 const vtss_port_no_t port_no,
                                 vtss_ewis_perf_mode_t *const perf_mode);
 
+/**
+ * \brief Enable or disable the eWIS performance monitoring engine.
+ * Enabling the engine clears all bins. While the engine is enabled vtss_ewis_perf_get()
+ * returns the primitives read by the last vtss_ewis_pm_tick() instead of reading the PHY.
+ *
+ * \param inst    [IN] Target instance reference.
+ * \param port_no [IN] Port number.
+ * \param enable  [IN] TRUE to enable the engine.
+ *
+ * \return Return code.
+ **/
+vtss_rc vtss_ewis_pm_enable_set(const vtss_inst_t inst,
+                                const vtss_port_no_t port_no,
+                                const BOOL enable);
+
+/**
+ * \brief Run the eWIS performance monitoring engine for one second.
+ * Must be called once per second (aligned with PMTICK). The performance primitives and defects
+ * are read in one pass and accumulated in the 15 minute and 24 hour bins.
+ * The defects are read every second. If all eWIS threshold events (VTSS_PHY_EWIS_xx_THRESH_EV)
+ * are enabled, the previous second was error free, no defect is present and no event has been
+ * returned by vtss_phy_10g_event_poll() since the previous tick, the port is considered idle and
+ * the counter reads are skipped. Errors below the configured thresholds are then not counted,
+ * so use thresholds of 0 for exact accounting.
+ *
+ * \param inst    [IN] Target instance reference.
+ * \param port_no [IN] Port number.
+ *
+ * \return Return code.
+ **/
+vtss_rc vtss_ewis_pm_tick(const vtss_inst_t inst,
+                          const vtss_port_no_t port_no);
+
+/**
+ * \brief Get the eWIS performance monitoring data.
+ *
+ * \param inst    [IN]  Target instance reference.
+ * \param port_no [IN]  Port number.
+ * \param pm      [OUT] Pointer to performance monitoring data.
+ *
+ * \return Return code.
+ **/
+vtss_rc vtss_ewis_pm_get(const vtss_inst_t inst,
+                         const vtss_port_no_t port_no,
+                         vtss_ewis_pm_t *const pm);
+
 #ifdef __cplusplus
 }
 #endif
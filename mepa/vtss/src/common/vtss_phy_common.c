@@ -60,6 +60,18 @@ vtss_rc vtss_phy_inst_create(const mepa_callout_t    *callout,
     vtss_state->cookie = VTSS_STATE_COOKIE;
     vtss_state->port_count = VTSS_PORTS;
 
+#if defined(VTSS_CHIP_CU_PHY)
+    {
+        vtss_port_no_t port_no;
+
+        for (port_no = VTSS_PORT_NO_START; port_no < VTSS_PORT_NO_END; port_no++) {
+            vtss_state->phy_state[port_no].status_refresh = VTSS_PHY_STATUS_REFRESH_DEFAULT;
+            vtss_state->phy_state[port_no].temp_period = VTSS_PHY_CHIP_TEMP_PERIOD_DEFAULT;
+            vtss_state->phy_state[port_no].stat_period = VTSS_PHY_STATISTIC_PERIOD_DEFAULT;
+        }
+    }
+#endif
+
 #if defined(VTSS_CHIP_10G_PHY)
     {
         vtss_port_no_t port_no;
@@ -1108,6 +1120,82 @@ vtss_rc _csr_wrm(vtss_state_t *vtss_state, vtss_port_no_t port_no, ioreg_blk *io
     return csr_wrm(vtss_state, port_no, io->mmd, io->is32, io->addr, value, mask);
 }
 
+#if defined(VTSS_CHIP_10G_PHY)
+/* Return TRUE and the SPI port to use, if accesses to 'mmd' on 'port_no' can use the SPI batch callout */
+static BOOL csr_spi_batch_port(vtss_state_t *vtss_state, vtss_port_no_t port_no, u16 mmd, vtss_port_no_t *port)
+{
+    vtss_phy_10g_family_t family = vtss_state->phy_10g_state[port_no].family;
+    BOOL                  clause45 = FALSE;
+
+    if (vtss_state->init_conf.spi_32bit_batch == NULL || vtss_state->init_conf.spi_32bit_read_write == NULL ||
+        (family != VTSS_PHY_FAMILY_VENICE && family != VTSS_PHY_FAMILY_MALIBU) ||
+        vtss_state->phy_10g_state[port_no].mode.alternate_port_ena ||
+        phy_type_get(vtss_state, port_no, &clause45) != VTSS_RC_OK || !clause45) {
+        return FALSE;
+    }
+    *port = (mmd == 0x1e) ? PHY_BASE_PORT(port_no) : port_no;
+    return TRUE;
+}
+#endif /* VTSS_CHIP_10G_PHY */
+
+/* Read 'cnt' consecutive registers starting at 'addr' */
+vtss_rc csr_rd_multi(vtss_state_t *vtss_state, vtss_port_no_t port_no, u16 mmd, BOOL is32, u32 addr, u32 cnt, u32 *value)
+{
+    u32 i;
+#if defined(VTSS_CHIP_10G_PHY)
+    vtss_spi_32bit_op_t ops[VTSS_SPI_BATCH_MAX];
+    vtss_port_no_t      port;
+    u32                 n;
+
+    if (csr_spi_batch_port(vtss_state, port_no, mmd, &port)) {
+        for (; cnt > 0; cnt -= n, addr += n, value += n) {
+            n = (cnt < VTSS_SPI_BATCH_MAX ? cnt : VTSS_SPI_BATCH_MAX);
+            for (i = 0; i < n; i++) {
+                ops[i].read = TRUE;
+                ops[i].dev = (u8)mmd;
+                ops[i].reg_num = (u16)(addr + i);
+                ops[i].data = &value[i];
+            }
+            VTSS_RC(vtss_state->init_conf.spi_32bit_batch(vtss_state, port, n, ops));
+        }
+        return VTSS_RC_OK;
+    }
+#endif /* VTSS_CHIP_10G_PHY */
+    for (i = 0; i < cnt; i++) {
+        VTSS_RC(csr_rd(vtss_state, port_no, mmd, is32, addr + i, &value[i]));
+    }
+    return VTSS_RC_OK;
+}
+
+/* Write 'cnt' consecutive registers starting at 'addr' */
+vtss_rc csr_wr_multi(vtss_state_t *vtss_state, vtss_port_no_t port_no, u16 mmd, BOOL is32, u32 addr, u32 cnt, const u32 *value)
+{
+    u32 i;
+#if defined(VTSS_CHIP_10G_PHY)
+    vtss_spi_32bit_op_t ops[VTSS_SPI_BATCH_MAX];
+    vtss_port_no_t      port;
+    u32                 n;
+
+    if (csr_spi_batch_port(vtss_state, port_no, mmd, &port)) {
+        for (; cnt > 0; cnt -= n, addr += n, value += n) {
+            n = (cnt < VTSS_SPI_BATCH_MAX ? cnt : VTSS_SPI_BATCH_MAX);
+            for (i = 0; i < n; i++) {
+                ops[i].read = FALSE;
+                ops[i].dev = (u8)mmd;
+                ops[i].reg_num = (u16)(addr + i);
+                ops[i].data = (u32 *)&value[i];
+            }
+            VTSS_RC(vtss_state->init_conf.spi_32bit_batch(vtss_state, port, n, ops));
+        }
+        return VTSS_RC_OK;
+    }
+#endif /* VTSS_CHIP_10G_PHY */
+    for (i = 0; i < cnt; i++) {
+        VTSS_RC(csr_wr(vtss_state, port_no, mmd, is32, addr + i, value[i]));
+    }
+    return VTSS_RC_OK;
+}
+
 vtss_rc _csr_warm_wrm(vtss_state_t *vtss_state, vtss_port_no_t port_no, ioreg_blk *io, u32 value,
                              u32 mask, u32 chk_mask, const char *function, const u16 line)
 {
@@ -139,6 +139,11 @@ typedef struct {
                                                     const vtss_port_no_t port_no,
                                                     vtss_phy_10g_vscope_scan_status_t  *const conf);
 
+    vtss_rc (* malibu_phy_10g_vscope_scan_status_multi_get)(struct vtss_state_s *vtss_state,
+                                                    u32 port_cnt,
+                                                    const vtss_port_no_t *const port_list,
+                                                    vtss_phy_10g_vscope_scan_status_t  *const conf_list);
+
     vtss_rc (* venice_phy_10g_apc_restart)(struct vtss_state_s *vtss_state,
                                            const vtss_port_no_t port_no,
                                            const BOOL is_host);
@@ -252,6 +257,9 @@ typedef struct {
    vtss_rc (* malibu_phy_10g_extended2_event_poll) (struct vtss_state_s     *vtss_state,
                                            const vtss_port_no_t             port_no,
                                            vtss_phy_10g_extnd2_event_t     *const ex_events);
+   vtss_rc (* malibu_phy_10g_event_summary_get) (struct vtss_state_s       *vtss_state,
+                                           const vtss_port_no_t             port_no,
+                                           u32                              *const aggr_int);
    vtss_rc (* malibu_phy_10g_host_recvrd_clk_set) (struct vtss_state_s *vtss_state,
                                        vtss_port_no_t port_no);
    vtss_rc (* malibu_phy_10g_pcs_status_get) (struct vtss_state_s *vtss_state,
@@ -280,6 +288,12 @@ typedef struct {
     vtss_rc (* malibu_phy_10g_debug_reg_dump) (struct vtss_state_s *vtss_state,
                                              const vtss_debug_printf_t pr,
                                              BOOL clear, vtss_port_no_t port_no);
+    vtss_rc (* vtss_phy_10g_snapshot_reg_get) (struct vtss_state_s *vtss_state,
+                                               vtss_port_no_t port_no, u32 idx,
+                                               ioreg_blk *const reg, u32 *const cnt);
+    vtss_rc (* malibu_phy_10g_snapshot_reg_get) (struct vtss_state_s *vtss_state,
+                                                 vtss_port_no_t port_no, u32 idx,
+                                                 ioreg_blk *const reg, u32 *const cnt);
 
     vtss_rc (* phy_10g_lane_sync_set)   (struct vtss_state_s *vtss_state,
                                           vtss_port_no_t port_no);
@@ -340,9 +354,21 @@ typedef struct {
                                            vtss_port_no_t port_no);
     vtss_rc (* ewis_perf_mode_set)(struct vtss_state_s *vtss_state,
                                    vtss_port_no_t port_no);
+    vtss_rc (* ewis_pm_tick)(struct vtss_state_s *vtss_state,
+                             vtss_port_no_t port_no);
 #endif /* VTSS_FEATURE_WIS */
 } vtss_cil_func_t;
 
+#if defined(VTSS_FEATURE_WIS)
+/* eWIS performance monitoring engine state */
+typedef struct {
+    vtss_ewis_pm_t       pm;        /* Bins and last second data */
+    vtss_phy_10g_event_t ev_latch;  /* Events returned by event poll since the last tick */
+    BOOL                 errored;   /* Errors or defects seen in the last second */
+    u32                  skip_cnt;  /* Number of consecutive skipped ticks */
+} vtss_ewis_pm_state_t;
+#endif /* VTSS_FEATURE_WIS */
+
 #if defined(VTSS_OPT_PHY_TIMESTAMP)
 typedef struct {
     BOOL                            eng_used; /* allocated the engine to application */
@@ -353,6 +379,8 @@ typedef struct {
     vtss_phy_ts_engine_flow_conf_t  flow_conf; /* engine flow config */
     vtss_phy_ts_engine_action_t     action_conf; /* engine action */
     u8                              action_flow_map[6]; /* action map to flow */
+    u8                              vlan_prog_mask; /* flows whose VLAN match registers hold flow_conf */
+    u32                             ptp_action_wr_cnt[2]; /* CSR writes used the last time each PTP action was programmed */
 } vtss_phy_ts_eng_conf_t;
 
 #if defined(VTSS_CHIP_CU_PHY) && defined(VTSS_PHY_TS_SPI_CLK_THRU_PPS0)
@@ -418,6 +446,8 @@ typedef struct {
     BOOL                             one_step_txfifo;
     u8                               ip1_nxt_cmp[4]; /* IP1 comparator is available only in blocks 0,1,2,3. */
     u8                               ip2_nxt_cmp[4]; /* IP2 comparator is available only in blocks 0,1,2,3. */
+    u32                              csr_wr_cnt;    /* CSR writes issued on the port */
+    u32                              csr_wr_saved;  /* CSR writes skipped by analyzer delta programming */
 } vtss_phy_ts_port_conf_t;
 
 typedef struct {
@@ -470,6 +500,7 @@ typedef struct vtss_state_s {
 
 #if defined(VTSS_FEATURE_WIS)
     vtss_ewis_conf_t              ewis_conf[VTSS_PORT_ARRAY_SIZE];
+    vtss_ewis_pm_state_t          ewis_pm[VTSS_PORT_ARRAY_SIZE];
 #endif
     ioreg_blk              io_var;   /* temporary structures used in register read/write in phys */
 #if defined(VTSS_CHIP_10G_PHY)
@@ -84,6 +84,8 @@ typedef struct {
     BOOL                                   spd_change_macsec_recfg; /** MACsec Reconfig flag for speed change */
     u64                                    ingr_flow_map; /** ingress flow map */
     u8                                     recfg_speed;
+    vtss_macsec_event_t                    ev_pending; /** Egress events read from the chip, but not yet resolved to SAs */
+    vtss_macsec_frame_capture_t            capture; /** Frame capture direction */
 } vtss_macsec_internal_glb_t;
 
 /* Memory is allocated for this structure during probe depending
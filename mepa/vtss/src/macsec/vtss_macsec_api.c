@@ -4282,6 +4282,24 @@ static vtss_rc vtss_macsec_tx_sc_del_priv(vtss_state_t              *vtss_state,
     return VTSS_RC_OK;
 }
 
+// Store the matching pattern of a SecY. The DROP and UNCONTROLLED_PORT actions acquire their matching slot here,
+// the CONTROLLED_PORT pattern is programmed for every SA added.
+static vtss_rc vtss_macsec_pattern_conf_set_priv(vtss_state_t                       *vtss_state,
+                                                 const vtss_macsec_port_t           port,
+                                                 const u32                          secy_id,
+                                                 const vtss_macsec_direction_t      direction,
+                                                 const vtss_macsec_match_action_t   action,
+                                                 const vtss_macsec_match_pattern_t  *const pattern)
+{
+    vtss_macsec_internal_secy_t *secy = &vtss_state->macsec_conf[port.port_no].secy[secy_id];
+
+    if (action == VTSS_MACSEC_MATCH_ACTION_DROP || action == VTSS_MACSEC_MATCH_ACTION_UNCONTROLLED_PORT) {
+        VTSS_RC(VTSS_RC_COLD(vtss_macsec_pattern_set_priv(vtss_state, port.port_no, secy_id, direction, action, pattern, 0)));
+    }
+    secy->pattern[action][direction] = *pattern;
+    return VTSS_RC_OK;
+}
+
 static vtss_rc vtss_macsec_pattern_del_priv(vtss_state_t                       *vtss_state,
                                             const vtss_macsec_port_t           port,
                                             const u32                          secy_id,
@@ -4331,6 +4349,58 @@ static vtss_rc vtss_macsec_pattern_del_priv(vtss_state_t                       *
 }
 
 
+static vtss_rc vtss_macsec_secy_conf_add_priv(vtss_state_t                  *vtss_state,
+                                              const vtss_macsec_port_t      port,
+                                              const vtss_macsec_secy_conf_t *const conf,
+                                              const u32                     secy_id)
+{
+    vtss_macsec_internal_secy_t *secy = &vtss_state->macsec_conf[port.port_no].secy[secy_id];
+    vtss_rc rc;
+    u32 i;
+
+    if (!check_resources(vtss_state, port.port_no, 0, 0)) {
+        VTSS_E("HW resources exhausted");
+        return dbg_counter_incr(vtss_state, port.port_no, VTSS_RC_ERR_MACSEC_HW_RESOURCE_EXHUSTED);
+    }
+
+    if (vtss_state->macsec_conf[port.port_no].glb.macsec_revb != TRUE) {
+        if (conf->current_cipher_suite == VTSS_MACSEC_CIPHER_SUITE_GCM_AES_XPN_128 ||
+            conf->current_cipher_suite == VTSS_MACSEC_CIPHER_SUITE_GCM_AES_XPN_256) {
+            VTSS_E("Extended packet numbering not supported on Macsec Rev A");
+            return VTSS_RC_ERROR;
+        }
+    }
+    if (vtss_state->macsec_conf[port.port_no].glb.macsec_revb == TRUE) {
+        if ((conf->current_cipher_suite == VTSS_MACSEC_CIPHER_SUITE_GCM_AES_XPN_128 ||
+             conf->current_cipher_suite == VTSS_MACSEC_CIPHER_SUITE_GCM_AES_XPN_256) &&
+            conf->replay_window > MACSEC_REVB_REPLAY_WINDOW_SIZE) {
+            VTSS_E("Replay window size cannot be greater than 2^30 for extended packet numbering");
+            return VTSS_RC_ERROR;
+        }
+    }
+    secy->conf = *conf;
+    secy->sci.port_id = port.port_id;
+    secy->service_id = port.service_id;
+    for (i = 0; i < 6; ++i) {
+        secy->sci.mac_addr.addr[i] = secy->conf.mac_addr.addr[i];
+    }
+
+    for (i = 0; i < 3; ++i) {
+        secy->pattern_record[i][0] = MACSEC_NOT_IN_USE;
+        secy->pattern_record[i][1] = MACSEC_NOT_IN_USE;
+        secy->pattern[i][0].match = VTSS_MACSEC_MATCH_DISABLE;
+        secy->pattern[i][1].match = VTSS_MACSEC_MATCH_DISABLE;
+    }
+    secy->pattern[VTSS_MACSEC_MATCH_ACTION_CONTROLLED_PORT][VTSS_MACSEC_DIRECTION_EGRESS].priority = VTSS_MACSEC_MATCH_PRIORITY_LOWEST;
+    secy->pattern[VTSS_MACSEC_MATCH_ACTION_CONTROLLED_PORT][VTSS_MACSEC_DIRECTION_INGRESS].priority = VTSS_MACSEC_MATCH_PRIORITY_LOWEST;
+    if ((rc = is_sci_valid(vtss_state, port.port_no, &secy->sci)) == VTSS_RC_OK) {  // Update rc to return error code if sci is not valid
+        secy->in_use = 1;
+    } else {
+        secy->in_use = 0;
+    }
+    return rc;
+}
+
 static vtss_rc vtss_macsec_secy_conf_del_priv(vtss_state_t *vtss_state,
                                               const vtss_macsec_port_t port, const u32 secy_id)
 {
@@ -5504,6 +5574,7 @@ static vtss_rc vtss_macsec_frame_capture_set_priv(vtss_state_t
     BOOL  phy10g;
 
     VTSS_RC(phy_type_get(vtss_state, port_no, &phy10g));
+    vtss_state->macsec_conf[port_no].glb.capture = capture;
     /* VTSS_MACSEC_EGR_CAPT_DEBUG_REGS_CAPT_DEBUG_TRIGGER_SA2 does not exist for 1G devices,
      this offset in 1G corresponds to VTSS_MACSEC_EGR_CAPT_DEBUG_REGS_CAPT_DEBUG_TRIGGER for 1G devices*/
 
@@ -5543,6 +5614,29 @@ static vtss_rc vtss_macsec_frame_capture_set_priv(vtss_state_t
     return VTSS_RC_OK;
 }
 
+// Disable the triggers of all SAs, which gives SW access to the capture FIFO, or re-enable them to capture the next frames.
+static vtss_rc vtss_macsec_frame_capture_trigger_set(vtss_state_t         *vtss_state,
+                                                     const vtss_port_no_t port_no,
+                                                     const BOOL           phy10g,
+                                                     const BOOL           enable)
+{
+    if (!enable) {
+        if (phy10g) {
+            CSR_WR(port_no, VTSS_MACSEC_EGR_CAPT_DEBUG_REGS_CAPT_DEBUG_TRIGGER, 0);
+        }
+        CSR_WR(port_no, VTSS_MACSEC_EGR_CAPT_DEBUG_REGS_CAPT_DEBUG_TRIGGER_SA2, 0);
+        CSR_WR(port_no, VTSS_MACSEC_EGR_CAPT_DEBUG_REGS_CAPT_DEBUG_TRIGGER_SA1, 0);
+    } else if (phy10g) {
+        CSR_WR(port_no, VTSS_MACSEC_EGR_CAPT_DEBUG_REGS_CAPT_DEBUG_TRIGGER, VTSS_F_MACSEC_EGR_CAPT_DEBUG_REGS_CAPT_DEBUG_TRIGGER_ENABLE);
+        CSR_WR(port_no, VTSS_MACSEC_EGR_CAPT_DEBUG_REGS_CAPT_DEBUG_TRIGGER_SA2, 0xFFFFFFFF);
+        CSR_WR(port_no, VTSS_MACSEC_EGR_CAPT_DEBUG_REGS_CAPT_DEBUG_TRIGGER_SA1, 0xFFFFFFFF);
+    } else {
+        CSR_WR(port_no, VTSS_MACSEC_EGR_CAPT_DEBUG_REGS_CAPT_DEBUG_TRIGGER_SA2, VTSS_F_MACSEC_EGR_CAPT_DEBUG_REGS_CAPT_DEBUG_TRIGGER_ENABLE);
+        CSR_WR(port_no, VTSS_MACSEC_EGR_CAPT_DEBUG_REGS_CAPT_DEBUG_TRIGGER_SA1, 0xFFFF);
+    }
+    return VTSS_RC_OK;
+}
+
 // Function for getting one frame from the capture FIFO
 // In/out - Same as vtss_macsec_frame_get (except inst), See vtss_macsec_api.h
 static vtss_rc vtss_macsec_frame_get_priv(vtss_state_t                  *vtss_state,
@@ -5583,11 +5677,7 @@ static vtss_rc vtss_macsec_frame_get_priv(vtss_state_t                  *vtss_st
 
 
     // Disable the triggers in order to be able to read the FIFO.
-    if (phy10g) {
-        CSR_WR(port_no, VTSS_MACSEC_EGR_CAPT_DEBUG_REGS_CAPT_DEBUG_TRIGGER, 0);
-    }
-    CSR_WR(port_no, VTSS_MACSEC_EGR_CAPT_DEBUG_REGS_CAPT_DEBUG_TRIGGER_SA2, 0);
-    CSR_WR(port_no, VTSS_MACSEC_EGR_CAPT_DEBUG_REGS_CAPT_DEBUG_TRIGGER_SA1, 0);
+    VTSS_RC(vtss_macsec_frame_capture_trigger_set(vtss_state, port_no, phy10g, FALSE));
 
 
     // The first 64bits of the frame captured is an administration header with consist of two 32bits words, namde ADM_HDR0 and ADM_HDR1
@@ -5626,15 +5716,7 @@ static vtss_rc vtss_macsec_frame_get_priv(vtss_state_t                  *vtss_st
     }
 
     // Re-enable capture in order to capture next frame.
-
-    if (phy10g) {
-        CSR_WR(port_no, VTSS_MACSEC_EGR_CAPT_DEBUG_REGS_CAPT_DEBUG_TRIGGER, VTSS_F_MACSEC_EGR_CAPT_DEBUG_REGS_CAPT_DEBUG_TRIGGER_ENABLE);
-        CSR_WR(port_no, VTSS_MACSEC_EGR_CAPT_DEBUG_REGS_CAPT_DEBUG_TRIGGER_SA2, 0xFFFFFFFF);
-        CSR_WR(port_no, VTSS_MACSEC_EGR_CAPT_DEBUG_REGS_CAPT_DEBUG_TRIGGER_SA1, 0xFFFFFFFF);
-    } else {
-        CSR_WR(port_no, VTSS_MACSEC_EGR_CAPT_DEBUG_REGS_CAPT_DEBUG_TRIGGER_SA2, VTSS_F_MACSEC_EGR_CAPT_DEBUG_REGS_CAPT_DEBUG_TRIGGER_ENABLE);
-        CSR_WR(port_no, VTSS_MACSEC_EGR_CAPT_DEBUG_REGS_CAPT_DEBUG_TRIGGER_SA1, 0xFFFF);
-    }
+    VTSS_RC(vtss_macsec_frame_capture_trigger_set(vtss_state, port_no, phy10g, TRUE));
 
     // We use error state to signal that frame is not valid
     if (truncated) {
@@ -5645,6 +5727,96 @@ static vtss_rc vtss_macsec_frame_get_priv(vtss_state_t                  *vtss_st
     return VTSS_RC_OK;
 }
 
+// Read the frames in the capture FIFO into the ring. The triggers must be disabled.
+// The frames are stored back to back, each starting on a 64 bit boundary with the administration header, see vtss_macsec_frame_get_priv.
+static vtss_rc vtss_macsec_frame_ring_fill(vtss_state_t                *vtss_state,
+                                           const vtss_port_no_t        port_no,
+                                           const u32                   frm_cnt,
+                                           const u32                   data_cnt,
+                                           vtss_macsec_capture_ring_t  *const ring,
+                                           u32                         *const cnt)
+{
+    const u32                   header_size = 2; // Header size (in 32bits)
+    vtss_macsec_capture_frame_t *entry;
+    u32                         offset = 0, adm_hdr0, adm_hdr1, length, copy, words, value, i, j;
+    u64                         now = MEPA_UPTIME_NSEC();
+
+    while (*cnt < frm_cnt && offset + header_size <= data_cnt) {
+        CSR_RD(port_no, VTSS_MACSEC_EGR_CAPT_DEBUG_REGS_CAPT_DEBUG_DATA(offset), &adm_hdr0);
+        CSR_RD(port_no, VTSS_MACSEC_EGR_CAPT_DEBUG_REGS_CAPT_DEBUG_DATA(offset + 1), &adm_hdr1);
+        length = (adm_hdr0 & 0x1FF);
+        words = (length + 3) / 4;
+        if (offset + header_size + words > data_cnt) {
+            VTSS_E("port_no:%u, frame %u at word %u: length %u exceeds the fifo data (%u words)", port_no, *cnt, offset, length, data_cnt);
+            return dbg_counter_incr(vtss_state, port_no, VTSS_RC_ERR_MACSEC_FRAME_TOO_LONG);
+        }
+        (*cnt)++;
+
+        if (ring->head - ring->tail >= ring->size) {
+            // Ring full, skip the frame data
+            ring->dropped++;
+        } else {
+            entry = &ring->frame[ring->head % ring->size];
+            // The 9 bit packet size can exceed the frame array, only the first part is kept
+            copy = (length > sizeof(entry->frame) ? sizeof(entry->frame) : length);
+            entry->port_no = port_no;
+            entry->direction = vtss_state->macsec_conf[port_no].glb.capture;
+            entry->timestamp = now;
+            entry->truncated = ((adm_hdr0 & 0x200) || copy < length) ? TRUE : FALSE;
+            entry->debug_code = adm_hdr1;
+            entry->length = copy;
+            for (i = 0, j = 0; i < (copy + 3) / 4; i++) {
+                CSR_RD(port_no, VTSS_MACSEC_EGR_CAPT_DEBUG_REGS_CAPT_DEBUG_DATA(offset + header_size + i), &value);
+                for (; j < copy && j < (i + 1) * 4; j++, value >>= 8) {
+                    entry->frame[j] = (value & 0xFF);
+                }
+            }
+            ring->head++;
+        }
+        offset += header_size + 2 * ((length + 7) / 8);
+    }
+    return VTSS_RC_OK;
+}
+
+// Function for moving all frames in the capture FIFO into a ring
+// In/out - Same as vtss_macsec_frame_ring_get (except inst), See vtss_macsec_api.h
+static vtss_rc vtss_macsec_frame_ring_get_priv(vtss_state_t                *vtss_state,
+                                               const vtss_port_no_t        port_no,
+                                               vtss_macsec_capture_ring_t  *const ring,
+                                               u32                         *const cnt)
+{
+    u32     value, frm_cnt, wr_ptr;
+    BOOL    phy10g;
+    vtss_rc rc;
+
+    *cnt = 0;
+    if (ring->frame == NULL || ring->size == 0) {
+        VTSS_E("port_no:%u, no frame ring", port_no);
+        return VTSS_RC_ERROR;
+    }
+
+    VTSS_RC(phy_type_get(vtss_state, port_no, &phy10g));
+
+    // Get the amount of data in the FIFO
+    CSR_RD(port_no, VTSS_MACSEC_EGR_CAPT_DEBUG_REGS_CAPT_DEBUG_STATUS, &value);
+    wr_ptr = VTSS_X_MACSEC_EGR_CAPT_DEBUG_REGS_CAPT_DEBUG_STATUS_WR_PTR(value);
+    frm_cnt = VTSS_X_MACSEC_EGR_CAPT_DEBUG_REGS_CAPT_DEBUG_STATUS_PKT_COUNT(value);
+    if (frm_cnt == 0) { // No frames captured
+        return VTSS_RC_OK;
+    }
+
+    // Disable the triggers in order to be able to read the FIFO, wr_ptr uses step of 8 bytes
+    VTSS_RC(vtss_macsec_frame_capture_trigger_set(vtss_state, port_no, phy10g, FALSE));
+    rc = vtss_macsec_frame_ring_fill(vtss_state, port_no, frm_cnt, wr_ptr * 2, ring, cnt);
+    VTSS_I("port_no:%u, frm_cnt:%u, wr_ptr:%u, read:%u, dropped:%u", port_no, frm_cnt, wr_ptr, *cnt, ring->dropped);
+
+    // Re-enable capture, also if reading failed, in order to capture the next frames
+    if (vtss_state->macsec_conf[port_no].glb.capture != VTSS_MACSEC_FRAME_CAPTURE_DISABLE) {
+        VTSS_RC(vtss_macsec_frame_capture_trigger_set(vtss_state, port_no, phy10g, TRUE));
+    }
+    return rc;
+}
+
 static vtss_rc vtss_macsec_controlled_counters_get_priv(vtss_state_t                      *vtss_state,
                                                         const vtss_macsec_port_t          port,
                                                         vtss_macsec_secy_port_counters_t  *const counters,
@@ -6970,6 +7142,81 @@ static vtss_rc vtss_macsec_egr_intr_sa_get_priv(vtss_state_t         *vtss_state
     return VTSS_RC_OK;
 }
 
+// Resolve the pending egress PN events of a port to SAs.
+// Only the active Tx SA of a SecY transmits, so that is the only SA where the PN
+// can pass the threshold or roll over. The PN of each of these SAs is read once.
+static vtss_rc vtss_macsec_sa_event_port_poll_priv(vtss_state_t           *vtss_state,
+                                                   const vtss_port_no_t   port_no,
+                                                   const u32              max_cnt,
+                                                   vtss_macsec_sa_event_t *const events,
+                                                   u32                    *const cnt)
+{
+    vtss_macsec_internal_glb_t *glb = &vtss_state->macsec_conf[port_no].glb;
+    vtss_macsec_internal_secy_t *secy;
+    vtss_macsec_internal_tx_sa_t *sa;
+    vtss_macsec_event_t ev_mask = 0, event;
+    vtss_macsec_sa_event_t *ev;
+    vtss_macsec_port_t mport;
+    u32 threshold = 0;
+    BOOL xpn, exhausted;
+    u16 an;
+    u8 secy_idx;
+
+    VTSS_RC(vtss_macsec_event_poll_priv(vtss_state, port_no, &ev_mask));
+    glb->ev_pending |= ev_mask;
+    if (glb->ev_pending == 0) {
+        return VTSS_RC_OK;
+    }
+    if (glb->ev_pending & VTSS_MACSEC_SEQ_THRESHOLD_EVENT) {
+        VTSS_RC(vtss_macsec_event_seq_threshold_get_priv(vtss_state, port_no, &threshold));
+    }
+
+    mport.port_no = port_no;
+    for (secy_idx = 0; secy_idx < vtss_state->macsec_capability[port_no].max_secy_cnt; secy_idx++) {
+        secy = &vtss_state->macsec_conf[port_no].secy[secy_idx];
+        if (!secy->in_use || !secy->tx_sc.in_use) {
+            continue;
+        }
+        an = secy->tx_sc.status.encoding_sa;
+        sa = (an < VTSS_MACSEC_SA_PER_SC_MAX ? secy->tx_sc.sa[an] : NULL);
+        if (sa == NULL || !sa->enabled) {
+            continue;
+        }
+        if (*cnt >= max_cnt) {
+            // No room, the events stay pending and are resolved by the next poll
+            return VTSS_RC_INCOMPLETE;
+        }
+        mport.port_id = secy->sci.port_id;
+        mport.service_id = secy->service_id;
+        VTSS_RC(vtss_macsec_tx_sa_status_get_priv(vtss_state, secy_idx, mport, an));
+
+        xpn = (secy->conf.current_cipher_suite == VTSS_MACSEC_CIPHER_SUITE_GCM_AES_XPN_128 ||
+               secy->conf.current_cipher_suite == VTSS_MACSEC_CIPHER_SUITE_GCM_AES_XPN_256);
+        exhausted = (xpn ? sa->status.pn_status.next_pn.xpn == 0 : sa->status.pn_status.next_pn.pn == 0);
+        event = VTSS_MACSEC_SEQ_NONE;
+        if ((glb->ev_pending & VTSS_MACSEC_SEQ_ROLLOVER_EVENT) && exhausted) {
+            event = VTSS_MACSEC_SEQ_ROLLOVER_EVENT;
+        } else if ((glb->ev_pending & VTSS_MACSEC_SEQ_THRESHOLD_EVENT) &&
+                   ((threshold != 0 && sa->status.pn_status.next_pn.pn >= threshold) ||
+                    (threshold == 0 && exhausted))) {
+            // Same check as vtss_macsec_egr_intr_sa_get_priv()
+            event = VTSS_MACSEC_SEQ_THRESHOLD_EVENT;
+        }
+        if (event == VTSS_MACSEC_SEQ_NONE) {
+            continue;
+        }
+        ev = &events[(*cnt)++];
+        ev->port = mport;
+        ev->sci = secy->sci;
+        ev->an = an;
+        ev->event = event;
+        ev->next_pn = sa->status.pn_status.next_pn;
+        VTSS_I("port_no:%u, port_id:%u, an:%u, event:0x%x", port_no, mport.port_id, an, event);
+    }
+    glb->ev_pending = 0;
+    return VTSS_RC_OK;
+}
+
 static vtss_rc vtss_macsec_lmac_counters_clear_priv(vtss_state_t        *vtss_state,
                                                     const vtss_port_no_t  port_no)
 
@@ -7416,8 +7663,7 @@ vtss_rc vtss_macsec_secy_conf_add(const vtss_inst_t                 inst,
 {
     vtss_state_t *vtss_state;
     vtss_rc rc = VTSS_RC_ERROR;
-    u32 secy_id = 0, i = 0;
-    vtss_macsec_internal_secy_t *secy;
+    u32 secy_id = 0;
 
     VTSS_I("Port: %u/%u/%u. TxMAC:"MACADDRESS_FMT, MACSEC_PORT_ARG(&port), MACADDRESS_ARG(conf->mac_addr));
     VTSS_I("SecY prm: RP:%d RW:%d Prt frms:%d incl_sci:%d use_es:%d use_scb:%d cipher:%s%s confidentiality offset:%d",
@@ -7428,50 +7674,7 @@ vtss_rc vtss_macsec_secy_conf_add(const vtss_inst_t                 inst,
     VTSS_ENTER();
 
     if ((rc = vtss_macsec_port_check(inst, &vtss_state, port, 1, &secy_id)) == VTSS_RC_OK) {
-        if (!check_resources(vtss_state, port.port_no, 0, 0)) {
-            VTSS_E("HW resources exhausted");
-            rc = dbg_counter_incr(vtss_state, port.port_no, VTSS_RC_ERR_MACSEC_HW_RESOURCE_EXHUSTED);
-        } else {
-            secy = &vtss_state->macsec_conf[port.port_no].secy[secy_id];
-
-            if (vtss_state->macsec_conf[port.port_no].glb.macsec_revb != TRUE) {
-                if (conf->current_cipher_suite == VTSS_MACSEC_CIPHER_SUITE_GCM_AES_XPN_128 ||
-                    conf->current_cipher_suite == VTSS_MACSEC_CIPHER_SUITE_GCM_AES_XPN_256) {
-                    VTSS_E("Extended packet numbering not supported on Macsec Rev A");
-                    VTSS_EXIT();
-                    return VTSS_RC_ERROR;
-                }
-            }
-            if (vtss_state->macsec_conf[port.port_no].glb.macsec_revb == TRUE) {
-                if ((conf->current_cipher_suite == VTSS_MACSEC_CIPHER_SUITE_GCM_AES_XPN_128 ||
-                     conf->current_cipher_suite == VTSS_MACSEC_CIPHER_SUITE_GCM_AES_XPN_256) &&
-                    conf->replay_window > MACSEC_REVB_REPLAY_WINDOW_SIZE) {
-                    VTSS_E("Replay window size cannot be greater than 2^30 for extended packet numbering");
-                    VTSS_EXIT();
-                    return VTSS_RC_ERROR;
-                }
-            }
-            secy->conf = *conf;
-            secy->sci.port_id = port.port_id;
-            secy->service_id = port.service_id;
-            for (i = 0; i < 6; ++i) {
-                secy->sci.mac_addr.addr[i] = secy->conf.mac_addr.addr[i];
-            }
-
-            for (i = 0; i < 3; ++i) {
-                secy->pattern_record[i][0] = MACSEC_NOT_IN_USE;
-                secy->pattern_record[i][1] = MACSEC_NOT_IN_USE;
-                secy->pattern[i][0].match = VTSS_MACSEC_MATCH_DISABLE;
-                secy->pattern[i][1].match = VTSS_MACSEC_MATCH_DISABLE;
-            }
-            secy->pattern[VTSS_MACSEC_MATCH_ACTION_CONTROLLED_PORT][VTSS_MACSEC_DIRECTION_EGRESS].priority = VTSS_MACSEC_MATCH_PRIORITY_LOWEST;
-            secy->pattern[VTSS_MACSEC_MATCH_ACTION_CONTROLLED_PORT][VTSS_MACSEC_DIRECTION_INGRESS].priority = VTSS_MACSEC_MATCH_PRIORITY_LOWEST;
-            if ((rc = is_sci_valid(vtss_state, port.port_no, &secy->sci)) == VTSS_RC_OK) {  // Update rc to return error code if sci is not valid
-                secy->in_use = 1;
-            } else {
-                secy->in_use = 0;
-            }
-        }
+        rc = vtss_macsec_secy_conf_add_priv(vtss_state, port, conf, secy_id);
     }
     VTSS_EXIT();
 
@@ -8767,7 +8970,6 @@ vtss_rc vtss_macsec_pattern_set(const vtss_inst_t                  inst,
 {
     vtss_state_t *vtss_state;
     vtss_rc rc = VTSS_RC_ERROR;
-    vtss_macsec_internal_secy_t *secy;
     u32 secy_id = 0;
 
     {
@@ -8784,13 +8986,7 @@ vtss_rc vtss_macsec_pattern_set(const vtss_inst_t                  inst,
         if ((rc = vtss_macsec_port_check(inst, &vtss_state, port, 0, &secy_id)) != VTSS_RC_OK) {
             break;
         }
-        secy = &vtss_state->macsec_conf[port.port_no].secy[secy_id];
-        if (action == VTSS_MACSEC_MATCH_ACTION_DROP || action == VTSS_MACSEC_MATCH_ACTION_UNCONTROLLED_PORT) {
-            if ((rc = VTSS_RC_COLD(vtss_macsec_pattern_set_priv(vtss_state, port.port_no, secy_id, direction, action, pattern, 0))) != VTSS_RC_OK) {
-                break;
-            }
-        }
-        secy->pattern[action][direction] = *pattern;
+        rc = vtss_macsec_pattern_conf_set_priv(vtss_state, port, secy_id, direction, action, pattern);
     } while (0);
     VTSS_EXIT();
     return rc;
@@ -8851,6 +9047,247 @@ vtss_rc vtss_macsec_pattern_get(const vtss_inst_t                  inst,
     return rc;
 }
 
+// Validate a SecY of a transaction against the current state and the SecYs before it in the transaction
+static vtss_rc macsec_txn_secy_check(vtss_state_t                 *vtss_state,
+                                     const u32                    idx,
+                                     const vtss_macsec_txn_secy_t *const txn)
+{
+    const vtss_macsec_txn_secy_t *t = &txn[idx], *o;
+    const vtss_macsec_port_t     *port = &t->port;
+    const vtss_macsec_txn_sa_t   *sa;
+    BOOL xpn = (t->conf.current_cipher_suite == VTSS_MACSEC_CIPHER_SUITE_GCM_AES_XPN_128 ||
+                t->conf.current_cipher_suite == VTSS_MACSEC_CIPHER_SUITE_GCM_AES_XPN_256);
+    u32 i, p, sc, sc2, an, active = 0;
+    u32 max_sc_rx = vtss_state->macsec_capability[port->port_no].max_sc_cnt;
+
+    VTSS_MACSEC_ASSERT(t->conf.confidentiality_offset > 64, "Confidentiality offset value not supported");
+    VTSS_MACSEC_ASSERT(t->pattern_cnt > VTSS_MACSEC_TXN_PATTERN_MAX, "Too many patterns");
+    VTSS_MACSEC_ASSERT(t->rx_sc_cnt > VTSS_MACSEC_TXN_RX_SC_MAX, "Too many Rx SCs");
+    if (xpn) {
+        VTSS_MACSEC_ASSERT(vtss_state->macsec_conf[port->port_no].glb.macsec_revb != TRUE,
+                           "Extended packet numbering not supported on Macsec Rev A");
+        VTSS_MACSEC_ASSERT(t->conf.replay_window > MACSEC_REVB_REPLAY_WINDOW_SIZE,
+                           "Replay window size cannot be greater than 2^30 for extended packet numbering");
+    }
+    for (p = 0; p < t->pattern_cnt; p++) {
+        VTSS_MACSEC_ASSERT(t->pattern[p].direction >= VTSS_MACSEC_DIRECTION_CNT ||
+                           t->pattern[p].action >= VTSS_MACSEC_MATCH_ACTION_CNT, "Invalid pattern direction or action");
+    }
+
+    for (an = 0; an < VTSS_MACSEC_SA_PER_SC; an++) {
+        sa = &t->tx_sa[an];
+        VTSS_MACSEC_ASSERT(sa->enable && !t->tx_sc, "Tx SA without Tx SC");
+        VTSS_MACSEC_ASSERT(sa->activate && !sa->enable, "Tx SA activated, but not created");
+        VTSS_MACSEC_ASSERT(sa->enable && (xpn ? sa->pn.xpn == 0 : sa->pn.pn == 0), "Tx next PN must be non-zero");
+        active += (sa->activate ? 1 : 0);
+    }
+    VTSS_MACSEC_ASSERT(active > 1, "Only one Tx SA can be activated");
+
+    for (sc = 0; sc < t->rx_sc_cnt; sc++) {
+        for (an = 0; an < VTSS_MACSEC_SA_PER_SC; an++) {
+            sa = &t->rx_sc[sc].sa[an];
+            VTSS_MACSEC_ASSERT(sa->activate && !sa->enable, "Rx SA activated, but not created");
+        }
+        for (sc2 = 0; sc2 < sc; sc2++) {
+            VTSS_MACSEC_ASSERT(sci_cmp(&t->rx_sc[sc].sci, &t->rx_sc[sc2].sci), "Rx SCI added twice");
+        }
+        for (sc2 = 0; sc2 < max_sc_rx; sc2++) {
+            if (vtss_state->macsec_conf[port->port_no].rx_sc[sc2].in_use &&
+                sci_cmp(&t->rx_sc[sc].sci, &vtss_state->macsec_conf[port->port_no].rx_sc[sc2].sci)) {
+                VTSS_E("SCI already exists, port_no:%d  port_id:%d", port->port_no, port->port_id);
+                return dbg_counter_incr(vtss_state, port->port_no, VTSS_RC_ERR_MACSEC_SCI_ALREADY_EXISTS);
+            }
+        }
+    }
+
+    for (i = 0; i < idx; i++) {
+        o = &txn[i];
+        if (o->port.port_no != port->port_no) {
+            continue;
+        }
+        VTSS_MACSEC_ASSERT(o->port.port_id == port->port_id && o->port.service_id == port->service_id, "SecY added twice");
+        for (sc = 0; sc < t->rx_sc_cnt; sc++) {
+            for (sc2 = 0; sc2 < o->rx_sc_cnt; sc2++) {
+                VTSS_MACSEC_ASSERT(sci_cmp(&t->rx_sc[sc].sci, &o->rx_sc[sc2].sci), "Rx SCI added twice");
+            }
+        }
+    }
+    return VTSS_RC_OK;
+}
+
+// Check that the free SecY, SC and SA records of a port can hold the SecYs of a transaction
+static vtss_rc macsec_txn_resources_check(vtss_state_t                 *vtss_state,
+                                          const vtss_port_no_t         port_no,
+                                          const u32                    cnt,
+                                          const vtss_macsec_txn_secy_t *const txn)
+{
+    vtss_macsec_internal_conf_t *conf = &vtss_state->macsec_conf[port_no];
+    vtss_macsec_port_capability *cap = &vtss_state->macsec_capability[port_no];
+    u32 i, sc, an, secy_cnt = 0, sc_cnt = 0, rx_sa_cnt = 0, tx_sa_cnt = 0;
+
+    for (i = 0; i < cnt; i++) {
+        if (txn[i].port.port_no != port_no) {
+            continue;
+        }
+        secy_cnt++;
+        sc_cnt += txn[i].rx_sc_cnt;
+        for (an = 0; an < VTSS_MACSEC_SA_PER_SC; an++) {
+            tx_sa_cnt += (txn[i].tx_sa[an].enable ? 1 : 0);
+            for (sc = 0; sc < txn[i].rx_sc_cnt; sc++) {
+                rx_sa_cnt += (txn[i].rx_sc[sc].sa[an].enable ? 1 : 0);
+            }
+        }
+    }
+    for (i = 0; i < cap->max_secy_cnt; i++) {
+        secy_cnt += (conf->secy[i].in_use ? 1 : 0);
+    }
+    for (i = 0; i < cap->max_sc_cnt; i++) {
+        sc_cnt += (conf->rx_sc[i].in_use ? 1 : 0);
+    }
+    for (i = 0; i < cap->max_sa_cnt; i++) {
+        rx_sa_cnt += (conf->rx_sa[i].in_use ? 1 : 0);
+        tx_sa_cnt += (conf->tx_sa[i].in_use ? 1 : 0);
+    }
+    if (secy_cnt > cap->max_secy_cnt || sc_cnt > cap->max_sc_cnt ||
+        rx_sa_cnt > cap->max_sa_cnt || tx_sa_cnt > cap->max_sa_cnt) {
+        VTSS_E("HW resources exhausted, port_no:%u, secy:%u, rx_sc:%u, rx_sa:%u, tx_sa:%u",
+               port_no, secy_cnt, sc_cnt, rx_sa_cnt, tx_sa_cnt);
+        return dbg_counter_incr(vtss_state, port_no, VTSS_RC_ERR_MACSEC_HW_RESOURCE_EXHUSTED);
+    }
+    return VTSS_RC_OK;
+}
+
+// Create a SecY of a transaction. The patterns are set and the controlled port is enabled before any SA is
+// created, so each SA is programmed once with its final match and enable state.
+static vtss_rc macsec_txn_secy_commit(vtss_state_t                 *vtss_state,
+                                      const vtss_macsec_txn_secy_t *const t,
+                                      const u32                    secy_id,
+                                      BOOL                         *const added)
+{
+    const vtss_macsec_port_t    port = t->port;
+    const vtss_macsec_txn_sa_t  *sa;
+    const vtss_macsec_sci_t     *sci;
+    u32 p, sc, an;
+
+    VTSS_I("Port: %u/%u/%u, rx_sc_cnt:%u, pattern_cnt:%u", MACSEC_PORT_ARG(&port), t->rx_sc_cnt, t->pattern_cnt);
+    VTSS_RC(vtss_macsec_secy_conf_add_priv(vtss_state, port, &t->conf, secy_id));
+    *added = TRUE;
+    for (p = 0; p < t->pattern_cnt; p++) {
+        VTSS_RC(vtss_macsec_pattern_conf_set_priv(vtss_state, port, secy_id, t->pattern[p].direction,
+                                                  t->pattern[p].action, &t->pattern[p].pattern));
+    }
+    if (t->controlled) {
+        VTSS_RC(vtss_macsec_secy_controlled_set_priv(vtss_state, port, TRUE, secy_id));
+    }
+    if (t->tx_sc) {
+        VTSS_RC(vtss_macsec_tx_sc_set_priv(vtss_state, port, secy_id));
+    }
+    for (sc = 0; sc < t->rx_sc_cnt; sc++) {
+        sci = &t->rx_sc[sc].sci;
+        VTSS_RC(vtss_macsec_rx_sc_add_priv(vtss_state, port, sci, secy_id));
+        for (an = 0; an < VTSS_MACSEC_SA_PER_SC; an++) {
+            sa = &t->rx_sc[sc].sa[an];
+            if (sa->enable) {
+                VTSS_RC(vtss_macsec_rx_sa_set_priv(vtss_state, secy_id, port, sci, an, sa->pn, &sa->sak, &sa->ssci));
+            }
+        }
+        for (an = 0; an < VTSS_MACSEC_SA_PER_SC; an++) {
+            if (t->rx_sc[sc].sa[an].activate) {
+                VTSS_RC(vtss_macsec_rx_sa_activate_priv(vtss_state, secy_id, port, sci, an));
+            }
+        }
+    }
+    for (an = 0; an < VTSS_MACSEC_SA_PER_SC; an++) {
+        sa = &t->tx_sa[an];
+        if (sa->enable) {
+            VTSS_RC(vtss_macsec_tx_sa_set_priv(vtss_state, secy_id, port, an, sa->pn, sa->confidentiality, &sa->sak, &sa->ssci));
+        }
+    }
+    for (an = 0; an < VTSS_MACSEC_SA_PER_SC; an++) {
+        if (t->tx_sa[an].activate) {
+            VTSS_RC(vtss_macsec_tx_sa_activate_priv(vtss_state, secy_id, port, an));
+        }
+    }
+    return VTSS_RC_OK;
+}
+
+#ifdef VTSS_CHIP_CU_PHY
+// Start or end batched MACsec register access on the 1G ports of a transaction
+static void macsec_txn_batch_set(vtss_state_t *vtss_state, const u32 cnt, const vtss_macsec_txn_secy_t *const txn, BOOL enable)
+{
+    u32 i;
+
+    for (i = 0; i < cnt; i++) {
+        if (phy_is_1g(vtss_state, txn[i].port.port_no) &&
+            vtss_phy_macsec_csr_batch_set(vtss_state, txn[i].port.port_no, enable) != VTSS_RC_OK) {
+            VTSS_E("Could not %s batch mode, port_no:%u", enable ? "start" : "end", txn[i].port.port_no);
+        }
+    }
+}
+#endif
+
+vtss_rc vtss_macsec_txn_commit(const vtss_inst_t            inst,
+                               const u32                    cnt,
+                               const vtss_macsec_txn_secy_t *const secy,
+                               u32                          *const failed)
+{
+    vtss_state_t *vtss_state = NULL;
+    vtss_rc rc = VTSS_RC_OK;
+    u32 i, j, idx = 0, secy_id = 0;
+    BOOL added = FALSE;
+
+    VTSS_I("cnt: %u", cnt);
+    VTSS_ENTER();
+
+    // Validate the complete transaction before anything is written to the chip
+    for (idx = 0; idx < cnt; idx++) {
+        if ((rc = vtss_macsec_port_check(inst, &vtss_state, secy[idx].port, 1, &secy_id)) != VTSS_RC_OK ||
+            (rc = macsec_txn_secy_check(vtss_state, idx, secy)) != VTSS_RC_OK) {
+            break;
+        }
+    }
+    for (i = 0; i < cnt && rc == VTSS_RC_OK; i++) {
+        for (j = 0; j < i && secy[j].port.port_no != secy[i].port.port_no; j++) {
+        }
+        if (j == i && (rc = macsec_txn_resources_check(vtss_state, secy[i].port.port_no, cnt, secy)) != VTSS_RC_OK) {
+            idx = i;
+        }
+    }
+
+    if (rc == VTSS_RC_OK) {
+#ifdef VTSS_CHIP_CU_PHY
+        macsec_txn_batch_set(vtss_state, cnt, secy, TRUE);
+#endif
+        for (idx = 0; idx < cnt; idx++) {
+            added = FALSE;
+            if ((rc = vtss_macsec_port_check(inst, &vtss_state, secy[idx].port, 1, &secy_id)) != VTSS_RC_OK ||
+                (rc = macsec_txn_secy_commit(vtss_state, &secy[idx], secy_id, &added)) != VTSS_RC_OK) {
+                break;
+            }
+        }
+        if (rc != VTSS_RC_OK) {
+            // Roll back, the failing SecY first
+            VTSS_E("Transaction failed, port: %u/%u/%u, rolling back %u SecYs",
+                   MACSEC_PORT_ARG(&secy[idx].port), added ? idx + 1 : idx);
+            for (i = (added ? idx + 1 : idx); i > 0; i--) {
+                if (vtss_macsec_port_check(inst, &vtss_state, secy[i - 1].port, 0, &secy_id) != VTSS_RC_OK ||
+                    vtss_macsec_secy_conf_del_priv(vtss_state, secy[i - 1].port, secy_id) != VTSS_RC_OK) {
+                    VTSS_E("Roll back failed, port: %u/%u/%u", MACSEC_PORT_ARG(&secy[i - 1].port));
+                }
+            }
+        }
+#ifdef VTSS_CHIP_CU_PHY
+        macsec_txn_batch_set(vtss_state, cnt, secy, FALSE);
+#endif
+    }
+    VTSS_EXIT();
+
+    if (failed != NULL) {
+        *failed = idx;
+    }
+    return rc;
+}
+
 vtss_rc vtss_macsec_bypass_mode_set(const vtss_inst_t                inst,
                                     const vtss_port_no_t             port_no,
                                     const vtss_macsec_bypass_mode_t  *const bypass)
@@ -8956,6 +9393,34 @@ vtss_rc vtss_macsec_frame_get(const vtss_inst_t             inst,
     return rc;
 }
 
+vtss_rc vtss_macsec_frame_ring_get(const vtss_inst_t             inst,
+                                   const vtss_port_no_t          port_no,
+                                   vtss_macsec_capture_ring_t    *const ring,
+                                   u32                           *const cnt)
+{
+    vtss_state_t *vtss_state;
+    vtss_rc rc = VTSS_RC_ERROR;
+
+    VTSS_D("port_no: %u", port_no);
+    *cnt = 0;
+    VTSS_ENTER();
+    if ((rc = vtss_inst_macsec_port_no_check(inst, &vtss_state, port_no)) == VTSS_RC_OK) {
+#ifdef VTSS_CHIP_CU_PHY
+        if (phy_is_1g(vtss_state, port_no)) {
+            (void)vtss_phy_macsec_csr_batch_set(vtss_state, port_no, TRUE);
+        }
+#endif
+        rc = vtss_macsec_frame_ring_get_priv(vtss_state, port_no, ring, cnt);
+#ifdef VTSS_CHIP_CU_PHY
+        if (phy_is_1g(vtss_state, port_no)) {
+            (void)vtss_phy_macsec_csr_batch_set(vtss_state, port_no, FALSE);
+        }
+#endif
+    }
+    VTSS_EXIT();
+    return rc;
+}
+
 vtss_rc vtss_macsec_event_enable_set(const vtss_inst_t           inst,
                                      const vtss_port_no_t        port_no,
                                      const vtss_macsec_event_t   ev_mask,
@@ -9053,6 +9518,40 @@ vtss_rc vtss_macsec_egr_intr_sa_get(const vtss_inst_t    inst,
     return rc;
 }
 
+vtss_rc vtss_macsec_sa_event_poll(const vtss_inst_t      inst,
+                                  const u32              max_cnt,
+                                  vtss_macsec_sa_event_t *const events,
+                                  u32                    *const cnt)
+{
+    vtss_state_t *vtss_state;
+    vtss_port_no_t port_no;
+    vtss_rc rc = VTSS_RC_ERROR;
+
+    *cnt = 0;
+    VTSS_ENTER();
+    if ((rc = vtss_inst_check(inst, &vtss_state)) == VTSS_RC_OK) {
+        for (port_no = VTSS_PORT_NO_START; port_no < vtss_state->port_count && rc == VTSS_RC_OK; port_no++) {
+            if (!is_macsec_capable(vtss_state, port_no) || vtss_state->macsec_conf[port_no].secy == NULL ||
+                !vtss_state->macsec_conf[port_no].glb.init.enable) {
+                continue;
+            }
+#ifdef VTSS_CHIP_CU_PHY
+            if (phy_is_1g(vtss_state, port_no)) {
+                (void)vtss_phy_macsec_csr_batch_set(vtss_state, port_no, TRUE);
+            }
+#endif
+            rc = vtss_macsec_sa_event_port_poll_priv(vtss_state, port_no, max_cnt, events, cnt);
+#ifdef VTSS_CHIP_CU_PHY
+            if (phy_is_1g(vtss_state, port_no)) {
+                (void)vtss_phy_macsec_csr_batch_set(vtss_state, port_no, FALSE);
+            }
+#endif
+        }
+    }
+    VTSS_EXIT();
+    return rc;
+}
+
 vtss_rc vtss_macsec_mtu_get(const vtss_inst_t       inst,
                             const vtss_port_no_t    port_no,
                             vtss_macsec_mtu_t       *mtu_conf)
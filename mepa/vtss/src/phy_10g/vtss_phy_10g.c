@@ -3176,6 +3176,75 @@ vtss_rc vtss_phy_10g_debug_register_dump (const vtss_inst_t inst,
     return rc;
 }
 
+/* Longest run of consecutive registers read in one go by the register snapshot */
+#define VTSS_PHY_10G_SNAPSHOT_BURST 16
+
+static vtss_rc vtss_phy_10g_snapshot_reg_get(vtss_state_t *vtss_state, const vtss_port_no_t port_no,
+                                             u32 idx, ioreg_blk *const reg, u32 *const cnt)
+{
+    if (vtss_state->phy_10g_state[port_no].family == VTSS_PHY_FAMILY_VENICE) {
+        return VTSS_FUNC(cil.vtss_phy_10g_snapshot_reg_get, port_no, idx, reg, cnt);
+    } else if (vtss_state->phy_10g_state[port_no].family == VTSS_PHY_FAMILY_MALIBU) {
+        return VTSS_FUNC(cil.malibu_phy_10g_snapshot_reg_get, port_no, idx, reg, cnt);
+    }
+    return VTSS_RC_NOT_IMPLEMENTED;
+}
+
+/* Read the registers from snap->cursor that are at consecutive addresses in one burst */
+static vtss_rc vtss_phy_10g_reg_snapshot_run_private(vtss_state_t *vtss_state,
+                                                     const vtss_port_no_t port_no,
+                                                     vtss_phy_reg_snapshot_t *const snap,
+                                                     u32 *const tbl_cnt)
+{
+    mepa_reg_snapshot_entry_t *entry;
+    ioreg_blk                 reg, next;
+    u32                       value[VTSS_PHY_10G_SNAPSHOT_BURST], n, i;
+
+    VTSS_RC(vtss_phy_10g_snapshot_reg_get(vtss_state, port_no, snap->cursor, &reg, tbl_cnt));
+    if (snap->cursor >= *tbl_cnt) {
+        return VTSS_RC_OK;
+    }
+    for (n = 1; n < VTSS_PHY_10G_SNAPSHOT_BURST && n < snap->size - snap->cnt && snap->cursor + n < *tbl_cnt; n++) {
+        VTSS_RC(vtss_phy_10g_snapshot_reg_get(vtss_state, port_no, snap->cursor + n, &next, tbl_cnt));
+        if (next.mmd != reg.mmd || next.is32 != reg.is32 || next.addr != reg.addr + n) {
+            break;
+        }
+    }
+    VTSS_RC(csr_rd_multi(vtss_state, port_no, reg.mmd, reg.is32, reg.addr, n, value));
+    for (i = 0; i < n; i++) {
+        entry = &snap->entry[snap->cnt++];
+        entry->block = reg.mmd;
+        entry->addr = (u16)(reg.addr + i);
+        entry->value = value[i];
+    }
+    snap->cursor += n;
+    return VTSS_RC_OK;
+}
+
+vtss_rc vtss_phy_10g_reg_snapshot_get(const vtss_inst_t             inst,
+                                      const vtss_port_no_t          port_no,
+                                      vtss_phy_reg_snapshot_t *const snap)
+{
+    vtss_state_t *vtss_state;
+    vtss_rc      rc = VTSS_RC_OK;
+    u32          tbl_cnt = 1;
+
+    // Consecutive registers are read as one burst, releasing the API lock between bursts
+    while (rc == VTSS_RC_OK && snap->cursor < tbl_cnt && snap->cnt < snap->size) {
+        VTSS_ENTER();
+        if ((rc = vtss_inst_phy_10G_no_check_private(inst, &vtss_state, port_no)) == VTSS_RC_OK) {
+            rc = vtss_phy_10g_reg_snapshot_run_private(vtss_state, port_no, snap, &tbl_cnt);
+        }
+        VTSS_EXIT();
+    }
+    snap->done = (snap->cursor >= tbl_cnt);
+    if (rc == VTSS_RC_OK && snap->cnt == 0 && !snap->done) {
+        VTSS_E("port_no %u: snapshot buffer of %u entries too small", port_no, snap->size);
+        rc = VTSS_RC_ERR_PARM;
+    }
+    return rc;
+}
+
 static vtss_rc vtss_phy_10g_lane_sync_set_private(vtss_state_t *vtss_state,
         const vtss_port_no_t port_no)
 {
@@ -3779,6 +3848,62 @@ vtss_rc vtss_phy_10g_event_poll(const vtss_inst_t     inst,
             break;
         }
         VTSS_I("port %u events polled 0x %0x%s ",port_no,*events,event_10g_type2txt(*events));
+#if defined(VTSS_FEATURE_WIS)
+        if (rc == VTSS_RC_OK) {
+            /* Let the eWIS PM engine know that the port is not idle */
+            vtss_state->ewis_pm[port_no].ev_latch |= *events;
+        }
+#endif /* VTSS_FEATURE_WIS */
+    }
+    VTSS_EXIT();
+    return rc;
+}
+
+vtss_rc vtss_phy_10g_event_summary_get(const vtss_inst_t            inst,
+                                       const vtss_port_no_t         port_no,
+                                       vtss_phy_10g_event_summary_t *const summary)
+{
+    vtss_state_t   *vtss_state;
+    vtss_rc        rc;
+    u32            aggr_int[4], i;
+    vtss_port_no_t p;
+
+    VTSS_ENTER();
+    if ((rc = vtss_inst_phy_10G_no_check_private(inst, &vtss_state, port_no)) == VTSS_RC_OK) {
+        switch (vtss_state->phy_10g_state[port_no].type) {
+        case VTSS_PHY_TYPE_8256:
+        case VTSS_PHY_TYPE_8257:
+        case VTSS_PHY_TYPE_8254:
+        case VTSS_PHY_TYPE_8258:
+            rc = VTSS_FUNC_COLD(cil.malibu_phy_10g_event_summary_get, port_no, aggr_int);
+            break;
+        default:
+            rc = VTSS_RC_ERROR;
+            break;
+        }
+        if (rc == VTSS_RC_OK) {
+            memset(summary, 0, sizeof(*summary));
+            for (i = 0; i < 4; i++) {
+                summary->port_no[i] = VTSS_PORT_NO_NONE;
+                if ((aggr_int[0] | aggr_int[1] | aggr_int[2] | aggr_int[3]) &
+                    ((1 << (VTSS_10G_GPIO_AGGR_INTRPT_CH0_INTR0_EN + 2 * i)) |
+                     (1 << (VTSS_10G_GPIO_AGGR_INTRPT_CH0_INTR1_EN + 2 * i)) |
+                     (1 << (VTSS_10G_GPIO_AGGR_INTRPT_IP1588_0_INTR0_EN + i)) |
+                     (1 << (VTSS_10G_GPIO_AGGR_INTRPT_IP1588_1_INTR0_EN + i)))) {
+                    summary->chan_pending |= (1 << i);
+                }
+            }
+            summary->gpio_pending = ((aggr_int[0] | aggr_int[1] | aggr_int[2] | aggr_int[3]) &
+                                     (1 << VTSS_10G_GPIO_AGGR_INTRPT_GPIO_INTR_EN)) ? TRUE : FALSE;
+            for (p = VTSS_PORT_NO_START; p < vtss_state->port_count; p++) {
+                if (vtss_state->phy_10g_state[p].type == vtss_state->phy_10g_state[port_no].type &&
+                    vtss_state->phy_10g_state[p].phy_api_base_no == vtss_state->phy_10g_state[port_no].phy_api_base_no &&
+                    vtss_state->phy_10g_state[p].channel_id < 4) {
+                    summary->port_no[vtss_state->phy_10g_state[p].channel_id] = p;
+                }
+            }
+            VTSS_D("port %u chan_pending 0x%x gpio_pending %d", port_no, summary->chan_pending, summary->gpio_pending);
+        }
     }
     VTSS_EXIT();
     return rc;
@@ -4041,32 +4166,59 @@ vtss_rc vtss_phy_10g_extended_event_enable_get(const vtss_inst_t
     return rc;
 }
 
+static vtss_rc vtss_phy_10g_poll_1sec_private(vtss_state_t *vtss_state, const vtss_port_no_t port)
+{
+    vtss_rc rc = VTSS_RC_OK;
+    u16     pending, mask, enable;
+
+    /* Check if 8486 10G port events are "enabled" */
+    if (vtss_state->phy_10g_state[port].type == VTSS_PHY_TYPE_8486 &&
+        vtss_state->phy_10g_state[port].event_86_enable) {
+        /* Interrupt can be enable once a second. Problem is that active failure
+           generates interrupt not possible to clear */
+        rc = vtss_mmd_rd(vtss_state, port, MMD_NVR_DOM, 0x9002, &enable);
+        if (!(enable & 0x4)) { /* Interrupt is not actually enabled - wait for no pending and then enable */
+            rc = vtss_mmd_rd(vtss_state, pma_port_no(vtss_state, port), MMD_PMA, 0x0008, &pending);   /* Read register in order to clear alarm status */
+            rc = vtss_mmd_rd(vtss_state, port, MMD_NVR_DOM, 0x9003, &pending);
+            rc = vtss_mmd_rd(vtss_state, port, MMD_NVR_DOM, 0x9000, &mask);
+            if (!(pending & mask))
+                rc = vtss_mmd_wr_masked(vtss_state, port, MMD_NVR_DOM, 0x9002, 0x4, 0x7);
+        }
+    }
+    return rc;
+}
+
 vtss_rc vtss_phy_10g_poll_1sec(const vtss_inst_t inst)
 
 {
     vtss_state_t *vtss_state;
     vtss_rc rc = VTSS_RC_OK;
     u32 port, port_count = 0;
-    u16 pending, mask, enable;
 
     VTSS_ENTER();
     if ((rc = vtss_inst_check(inst, &vtss_state)) == VTSS_RC_OK)
         port_count = vtss_state->port_count;
-    for (port=0; port<port_count; ++port) {      /* Check all 8486 10G ports to see if events are "enabled"  */
-        if ((rc = vtss_inst_phy_10G_no_check_private(inst, &vtss_state, port)) == VTSS_RC_OK &&
-            vtss_state->phy_10g_state[port].type == VTSS_PHY_TYPE_8486 &&
-            vtss_state->phy_10g_state[port].event_86_enable) {
-            /* Interrupt can be enable once a second. Problem is that active failure
-               generates interrupt not possible to clear */
-            rc = vtss_mmd_rd(vtss_state, port, MMD_NVR_DOM, 0x9002, &enable);
-            if (!(enable & 0x4)) { /* Interrupt is not actually enabled - wait for no pending and then enable */
-                rc = vtss_mmd_rd(vtss_state, pma_port_no(vtss_state, port), MMD_PMA, 0x0008, &pending);   /* Read register in order to clear alarm status */
-                rc = vtss_mmd_rd(vtss_state, port, MMD_NVR_DOM, 0x9003, &pending);
-                rc = vtss_mmd_rd(vtss_state, port, MMD_NVR_DOM, 0x9000, &mask);
-                if (!(pending & mask))
-                    rc = vtss_mmd_wr_masked(vtss_state, port, MMD_NVR_DOM, 0x9002, 0x4, 0x7);
-            }
+    VTSS_EXIT();
+    /* The API lock is released between ports, so other API users are not held back for the whole poll */
+    for (port=0; port<port_count; ++port) {
+        VTSS_ENTER();
+        if ((rc = vtss_inst_phy_10G_no_check_private(inst, &vtss_state, port)) == VTSS_RC_OK) {
+            rc = vtss_phy_10g_poll_1sec_private(vtss_state, port);
         }
+        VTSS_EXIT();
+    }
+    return rc;
+}
+
+vtss_rc vtss_phy_10g_poll_1sec_port(const vtss_inst_t    inst,
+                                    const vtss_port_no_t port_no)
+{
+    vtss_state_t *vtss_state;
+    vtss_rc      rc;
+
+    VTSS_ENTER();
+    if ((rc = vtss_inst_phy_10G_no_check_private(inst, &vtss_state, port_no)) == VTSS_RC_OK) {
+        rc = vtss_phy_10g_poll_1sec_private(vtss_state, port_no);
     }
     VTSS_EXIT();
     return rc;
@@ -4628,6 +4780,35 @@ vtss_rc vtss_phy_10g_vscope_scan_status_get(const vtss_inst_t inst,
     return rc;
 }
 
+vtss_rc vtss_phy_10g_vscope_scan_status_multi_get(const vtss_inst_t inst,
+                                                  const u32 port_cnt,
+                                                  const vtss_port_no_t *const port_list,
+                                                  vtss_phy_10g_vscope_scan_status_t *const conf_list)
+{
+    vtss_state_t *vtss_state;
+    vtss_rc rc = VTSS_RC_ERROR;
+    u32 n;
+
+    if (port_cnt == 0) {
+        return VTSS_RC_ERROR;
+    }
+    VTSS_ENTER();
+    for (n = 0; n < port_cnt; n++) {
+        if ((rc = vtss_inst_phy_10G_no_check_private(inst, &vtss_state, port_list[n])) != VTSS_RC_OK) {
+            break;
+        }
+        if (vtss_state->phy_10g_state[port_list[n]].family != VTSS_PHY_FAMILY_MALIBU) {
+            rc = VTSS_RC_ERROR;
+            break;
+        }
+    }
+    if (rc == VTSS_RC_OK) {
+        rc = VTSS_FUNC_COLD(cil.malibu_phy_10g_vscope_scan_status_multi_get, port_cnt, port_list, conf_list);
+    }
+    VTSS_EXIT();
+    return rc;
+}
+
 vtss_rc vtss_phy_10g_pkt_gen_conf(const vtss_inst_t      inst,
         const vtss_port_no_t   port_no,
         const vtss_phy_10g_pkt_gen_conf_t *const conf)
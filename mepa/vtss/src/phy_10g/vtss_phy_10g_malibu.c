@@ -13654,6 +13654,19 @@ static vtss_rc malibu_phy_10g_event_poll(vtss_state_t               *vtss_state,
     return VTSS_RC_OK;
 }
 
+/* Read the four chip level aggregated interrupt status registers (one per AGGR_INT output) */
+static vtss_rc malibu_phy_10g_event_summary_get(vtss_state_t         *vtss_state,
+                                                const vtss_port_no_t port_no,
+                                                u32                  *const aggr_int)
+{
+    ioreg_blk *io = VTSS_GPIO_CTRL_INTR_CFG_STAT_INTR_STAT(0);
+
+    // The four status registers are consecutive, read them in one go
+    VTSS_RC(csr_rd_multi(vtss_state, port_no, io->mmd, io->is32, io->addr, 4, aggr_int));
+    VTSS_D("port %u aggr_int 0x%x 0x%x 0x%x 0x%x", port_no, aggr_int[0], aggr_int[1], aggr_int[2], aggr_int[3]);
+    return VTSS_RC_OK;
+}
+
 static vtss_rc vtss_phy_1g_extended_event_poll_private(vtss_state_t *vtss_state,
                                                 const vtss_port_no_t port_no,
                                                 vtss_phy_10g_extnd_event_t  *const ex_events)
@@ -15039,6 +15052,98 @@ vtss_rc malibu_10g_debug_reg_dump(vtss_state_t *vtss_state,
     return (VTSS_RC_OK);
 }
 
+/* Registers printed by malibu_10g_debug_reg_dump(), in dump order, used by the register snapshot */
+#undef VTSS_IOREG
+#define VTSS_IOREG(dev, is32, off) {(dev), (is32), (off)}
+static const ioreg_blk malibu_snapshot_reg_tbl[] = {
+    VTSS_LINE_PCS10G_PCS_Status_2_PCS_Status_2,
+    VTSS_LINE_PCS10G_Eth_10GBASE_R_PCS_Status_2_Eth_10GBASE_R_PCS_Status_2,
+    VTSS_LINE_PCS10G_PCS_TX_SEQ_ERR_CNT_PCS_TX_SEQ_ERR_CNT,
+    VTSS_LINE_PCS10G_PCS_RX_SEQ_ERR_CNT_PCS_RX_SEQ_ERR_CNT,
+    VTSS_LINE_PCS10G_PCS_TX_BLK_ENC_ERR_CNT_PCS_TX_BLK_ENC_ERR_CNT,
+    VTSS_LINE_PCS10G_PCS_PCS_RX_BLK_DEC_ERR_CNT_PCS_PCS_RX_BLK_DEC_ERR_CNT,
+    VTSS_LINE_PCS10G_PCS_TX_CHAR_ENC_ERR_CNT_PCS_TX_CHAR_ENC_ERR_CNT,
+    VTSS_LINE_PCS10G_PCS_RX_CHAR_DEC_ERR_CNT_PCS_RX_CHAR_DEC_ERR_CNT,
+    VTSS_LINE_PMA_32BIT_SD10G65_APC_APC_EQZ_L_CTRL,
+    VTSS_LINE_PMA_32BIT_SD10G65_APC_APC_EQZ_L_PAR_CFG,
+    VTSS_LINE_PMA_32BIT_SD10G65_APC_APC_EQZ_C_CTRL,
+    VTSS_LINE_PMA_32BIT_SD10G65_APC_APC_EQZ_C_PAR_CFG,
+    VTSS_LINE_PMA_32BIT_SD10G65_APC_APC_EQZ_AGC_CTRL,
+    VTSS_LINE_PMA_32BIT_SD10G65_APC_APC_EQZ_AGC_PAR_CFG,
+    VTSS_LINE_PMA_32BIT_SD10G65_APC_APC_EQZ_OFFS_CTRL,
+    VTSS_LINE_PMA_32BIT_SD10G65_APC_APC_EQZ_OFFS_PAR_CFG,
+    VTSS_LINE_PMA_32BIT_SD10G65_APC_APC_EQZ_LD_CTRL,
+    VTSS_LINE_PMA_32BIT_SD10G65_APC_APC_EQZ_CTRL_STATUS,
+    VTSS_LINE_PMA_32BIT_SD10G65_APC_APC_EQZ_GAIN_CTRL_CFG,
+    VTSS_LINE_PMA_32BIT_SD10G65_APC_APC_DFE1_CTRL,
+    VTSS_LINE_PMA_32BIT_SD10G65_APC_APC_DFE1_PAR_CFG,
+    VTSS_LINE_PMA_32BIT_SD10G65_APC_APC_DFE2_CTRL,
+    VTSS_LINE_PMA_32BIT_SD10G65_APC_APC_DFE2_PAR_CFG,
+    VTSS_LINE_PMA_32BIT_SD10G65_APC_APC_DFE3_CTRL,
+    VTSS_LINE_PMA_32BIT_SD10G65_APC_APC_DFE3_PAR_CFG,
+    VTSS_LINE_PMA_32BIT_SD10G65_APC_APC_DFE4_CTRL,
+    VTSS_LINE_PMA_32BIT_SD10G65_APC_APC_DFE4_PAR_CFG,
+    VTSS_LINE_PMA_32BIT_SD10G65_APC_APC_COMMON_CFG0,
+    VTSS_LINE_PMA_32BIT_SD10G65_OB_SD10G65_OB_CFG0,
+    VTSS_LINE_PMA_32BIT_SD10G65_OB_SD10G65_OB_CFG1,
+    VTSS_LINE_PMA_32BIT_SD10G65_OB_SD10G65_OB_CFG2,
+    VTSS_HOST_PCS10G_PCS_Status_2_PCS_Status_2,
+    VTSS_HOST_PCS10G_Eth_10GBASE_R_PCS_Status_2_Eth_10GBASE_R_PCS_Status_2,
+    VTSS_HOST_PCS10G_PCS_TX_SEQ_ERR_CNT_PCS_TX_SEQ_ERR_CNT,
+    VTSS_HOST_PCS10G_PCS_RX_SEQ_ERR_CNT_PCS_RX_SEQ_ERR_CNT,
+    VTSS_HOST_PCS10G_PCS_TX_BLK_ENC_ERR_CNT_PCS_TX_BLK_ENC_ERR_CNT,
+    VTSS_HOST_PCS10G_PCS_PCS_RX_BLK_DEC_ERR_CNT_PCS_PCS_RX_BLK_DEC_ERR_CNT,
+    VTSS_HOST_PCS10G_PCS_TX_CHAR_ENC_ERR_CNT_PCS_TX_CHAR_ENC_ERR_CNT,
+    VTSS_HOST_PCS10G_PCS_RX_CHAR_DEC_ERR_CNT_PCS_RX_CHAR_DEC_ERR_CNT,
+    VTSS_HOST_PMA_32BIT_SD10G65_APC_APC_EQZ_L_CTRL,
+    VTSS_HOST_PMA_32BIT_SD10G65_APC_APC_EQZ_L_PAR_CFG,
+    VTSS_HOST_PMA_32BIT_SD10G65_APC_APC_EQZ_C_CTRL,
+    VTSS_HOST_PMA_32BIT_SD10G65_APC_APC_EQZ_C_PAR_CFG,
+    VTSS_HOST_PMA_32BIT_SD10G65_APC_APC_EQZ_AGC_CTRL,
+    VTSS_HOST_PMA_32BIT_SD10G65_APC_APC_EQZ_AGC_PAR_CFG,
+    VTSS_HOST_PMA_32BIT_SD10G65_APC_APC_EQZ_OFFS_CTRL,
+    VTSS_HOST_PMA_32BIT_SD10G65_APC_APC_EQZ_OFFS_PAR_CFG,
+    VTSS_HOST_PMA_32BIT_SD10G65_APC_APC_EQZ_LD_CTRL,
+    VTSS_HOST_PMA_32BIT_SD10G65_APC_APC_EQZ_CTRL_STATUS,
+    VTSS_HOST_PMA_32BIT_SD10G65_APC_APC_EQZ_GAIN_CTRL_CFG,
+    VTSS_HOST_PMA_32BIT_SD10G65_APC_APC_DFE1_CTRL,
+    VTSS_HOST_PMA_32BIT_SD10G65_APC_APC_DFE1_PAR_CFG,
+    VTSS_HOST_PMA_32BIT_SD10G65_APC_APC_DFE2_CTRL,
+    VTSS_HOST_PMA_32BIT_SD10G65_APC_APC_DFE2_PAR_CFG,
+    VTSS_HOST_PMA_32BIT_SD10G65_APC_APC_DFE3_CTRL,
+    VTSS_HOST_PMA_32BIT_SD10G65_APC_APC_DFE3_PAR_CFG,
+    VTSS_HOST_PMA_32BIT_SD10G65_APC_APC_DFE4_CTRL,
+    VTSS_HOST_PMA_32BIT_SD10G65_APC_APC_DFE4_PAR_CFG,
+    VTSS_HOST_PMA_32BIT_SD10G65_APC_APC_COMMON_CFG0,
+    VTSS_HOST_PMA_32BIT_SD10G65_OB_SD10G65_OB_CFG0,
+    VTSS_HOST_PMA_32BIT_SD10G65_OB_SD10G65_OB_CFG1,
+    VTSS_HOST_PMA_32BIT_SD10G65_OB_SD10G65_OB_CFG2,
+    VTSS_GLOBAL_Temp_Monitor_Temp_Mon_Regs,
+    VTSS_FIFO_BIST_Datapath_Control_Datapath_Control,
+    VTSS_FIFO_BIST_MON_GOODCRC_MON_GOOD_LSW,
+    VTSS_FIFO_BIST_MON_GOODCRC_MON_GOOD_MSW,
+    VTSS_FIFO_BIST_MON_BADCRC_MON_BAD_LSW,
+    VTSS_FIFO_BIST_MON_BADCRC_MON_BAD_MSW,
+    VTSS_FIFO_BIST_MON_FRAG_MON_FRAG_LSW,
+    VTSS_FIFO_BIST_MON_FRAG_MON_FRAG_MSW,
+    VTSS_FIFO_BIST_MON_LFAULT_MON_LFAULT_LSW,
+    VTSS_FIFO_BIST_MON_LFAULT_MON_LFAULT_MSW,
+    VTSS_FIFO_BIST_MON_BER_MON_BER_LSW,
+    VTSS_FIFO_BIST_MON_BER_MON_BER_MSW,
+};
+#undef VTSS_IOREG
+#define VTSS_IOREG(dev, is32, off)  _ioreg(&vtss_state->io_var, (dev), (is32), (off))
+
+static vtss_rc malibu_10g_snapshot_reg_get(vtss_state_t *vtss_state, vtss_port_no_t port_no,
+                                           u32 idx, ioreg_blk *const reg, u32 *const cnt)
+{
+    *cnt = VTSS_ARRSZ(malibu_snapshot_reg_tbl);
+    if (idx < *cnt) {
+        *reg = malibu_snapshot_reg_tbl[idx];
+    }
+    return VTSS_RC_OK;
+}
+
 
 //function for circle phase aux, used in VSCOPE
 static vtss_rc malibu_phy_10g_vscope_circle_phase_aux(struct vtss_state_s *vtss_state,const vtss_port_no_t port_no, BOOL line) 
@@ -15637,32 +15742,21 @@ static vtss_rc malibu_phy_10g_vscope_fast_scan_status_get(struct vtss_state_s *
 }
 
 
-static vtss_rc malibu_phy_10g_vscope_xy_scan_eye_sw( struct vtss_state_s * vtss_state,
+/* Prepare the vscope counter of a port for a software XY scan with the given preload hit count */
+static vtss_rc malibu_phy_10g_vscope_xy_scan_prepare(struct vtss_state_s *vtss_state,
         const vtss_port_no_t port_no,
-        vtss_phy_10g_vscope_scan_status_t * const conf)
+        BOOL line,
+        u32 hit_cnt,
+        vtss_phy_10g_ib_storage_t *const store)
 {
-    vtss_phy_10g_ib_storage_t store; 
-    u32 hit_cnt, symDisable, tmp, skipAmpl, actPhase, actAmpl, counter_val, err_thres;
-    u32 i,j;
-    //value to be calculated using x/log10(2)
-    BOOL line;
-    hit_cnt = conf->scan_conf.ber;
-    symDisable = 0;
+    u32 tmp, counter_val, err_thres;
+
     err_thres = vtss_state->phy_10g_state[port_no].vscope_conf.error_thres;
-    line = vtss_state->phy_10g_state[port_no].vscope_conf.line;
-    memset(&store, 0, sizeof(vtss_phy_10g_ib_storage_t));
- 
-    //checking bounds of the scan parameters
-    if(conf->scan_conf.x_start + conf->scan_conf.x_count > 127){
-        return VTSS_RC_ERROR;
-    }
-    if(conf->scan_conf.y_start + conf->scan_conf.y_count > 63){
-        return VTSS_RC_ERROR;
-    }
+    memset(store, 0, sizeof(vtss_phy_10g_ib_storage_t));
 
     if(line)
     {
-        VTSS_RC(malibu_phy_10g_vscope_backup_settings(vtss_state, port_no, 1, &store));
+        VTSS_RC(malibu_phy_10g_vscope_backup_settings(vtss_state, port_no, 1, store));
 
         CSR_WARM_WRM(port_no, VTSS_LINE_PMA_SD10G65_VSCOPE2_VSCOPE_PAT_LOCK_CFG_A,
                 VTSS_F_LINE_PMA_SD10G65_VSCOPE2_VSCOPE_PAT_LOCK_CFG_A_PRELOAD_HIT_CNT(14),
@@ -15674,8 +15768,6 @@ static vtss_rc malibu_phy_10g_vscope_xy_scan_eye_sw( struct vtss_state_s * vtss_
         CSR_WARM_WRM(port_no, VTSS_LINE_PMA_SD10G65_VSCOPE2_VSCOPE_HW_SCAN_CFG_1B,
                 VTSS_F_LINE_PMA_SD10G65_VSCOPE2_VSCOPE_HW_SCAN_CFG_1B_HW_SCAN_ENA(0),
                 VTSS_M_LINE_PMA_SD10G65_VSCOPE2_VSCOPE_HW_SCAN_CFG_1B_HW_SCAN_ENA);
-        conf->scan_conf.x_incr++;
-        conf->scan_conf.y_incr++;
         //FREEZE APC 
         CSR_WARM_WRM(port_no, VTSS_LINE_PMA_32BIT_SD10G65_APC_APC_COMMON_CFG0,
                 VTSS_F_LINE_PMA_32BIT_SD10G65_APC_APC_COMMON_CFG0_FREEZE_APC,
@@ -15716,48 +15808,9 @@ static vtss_rc malibu_phy_10g_vscope_xy_scan_eye_sw( struct vtss_state_s * vtss_
        CSR_WARM_WRM(port_no, VTSS_LINE_PMA_SD10G65_VSCOPE2_VSCOPE_PAT_LOCK_CFG_A,
                 VTSS_F_LINE_PMA_SD10G65_VSCOPE2_VSCOPE_PAT_LOCK_CFG_A_PRELOAD_HIT_CNT(hit_cnt),
                 VTSS_M_LINE_PMA_SD10G65_VSCOPE2_VSCOPE_PAT_LOCK_CFG_A_PRELOAD_HIT_CNT);
-
-
-        for( j = 0 ; j <= conf->scan_conf.x_count; j = j + conf->scan_conf.x_incr){
-            skipAmpl = 0;
-            for( i = 0; (i + skipAmpl) <= conf->scan_conf.y_count; i = i+ conf->scan_conf.y_incr) {
-                actPhase = j + conf->scan_conf.x_start;
-                skipAmpl = 0;
-                if((symDisable == 0) && ( conf->scan_conf.y_start < 32) && ((i + conf->scan_conf.y_start) >= 32)){
-                    skipAmpl = 1;
-                }
-                actAmpl = i + conf->scan_conf.y_start + skipAmpl;
-
-                //write phase and aux values (vscope10g_get_xy_point)
-                CSR_WARM_WRM(port_no, VTSS_LINE_PMA_32BIT_SD10G65_RX_SYNTH_SD10G65_RX_SYNTH_CFG2,
-                        VTSS_F_LINE_PMA_32BIT_SD10G65_RX_SYNTH_SD10G65_RX_SYNTH_CFG2_SYNTH_PHASE_AUX(actPhase),
-                        VTSS_M_LINE_PMA_32BIT_SD10G65_RX_SYNTH_SD10G65_RX_SYNTH_CFG2_SYNTH_PHASE_AUX);
-                CSR_WARM_WRM(port_no, VTSS_LINE_PMA_32BIT_SD10G65_IB_SD10G65_IB_CFG4 ,
-                        VTSS_F_LINE_PMA_32BIT_SD10G65_IB_SD10G65_IB_CFG4_IB_VSCOPE_H_THRES(actAmpl),
-                        VTSS_M_LINE_PMA_32BIT_SD10G65_IB_SD10G65_IB_CFG4_IB_VSCOPE_H_THRES);
-                CSR_WARM_WRM(port_no, VTSS_LINE_PMA_SD10G65_VSCOPE2_VSCOPE_MAIN_CFG_C,
-                        VTSS_F_LINE_PMA_SD10G65_VSCOPE2_VSCOPE_MAIN_CFG_C_CNT_ENA,
-                        VTSS_F_LINE_PMA_SD10G65_VSCOPE2_VSCOPE_MAIN_CFG_C_CNT_ENA);
-                CSR_RD(port_no, VTSS_LINE_PMA_SD10G65_VSCOPE2_VSCOPE_CNT_A, &tmp);
-                counter_val = tmp << 16;
-                CSR_RD(port_no, VTSS_LINE_PMA_SD10G65_VSCOPE2_VSCOPE_CNT_B, &tmp);
-                counter_val |= tmp;
-                CSR_WARM_WRM(port_no, VTSS_LINE_PMA_SD10G65_VSCOPE2_VSCOPE_MAIN_CFG_C,
-                        0,
-                        VTSS_F_LINE_PMA_SD10G65_VSCOPE2_VSCOPE_MAIN_CFG_C_CNT_ENA);
-                conf->errors[actPhase][actAmpl] = counter_val;
-            }
-        }
-
-        //Aux circle phase condition 
-        if ((((conf->scan_conf.x_count * conf->scan_conf.x_incr) % 128) - conf->scan_conf.x_start) > 63){
-            VTSS_RC(malibu_phy_10g_vscope_circle_phase_aux(vtss_state,port_no,1));
-        }
-        //backup settings to be restored ========> resolved 
-        VTSS_RC(malibu_phy_10g_vscope_restore_settings(vtss_state, port_no, 1, &store));
     } else {
 
-        VTSS_RC(malibu_phy_10g_vscope_backup_settings(vtss_state, port_no, 0, &store));
+        VTSS_RC(malibu_phy_10g_vscope_backup_settings(vtss_state, port_no, 0, store));
 
         //calculate hit cnt from ber (hit count) =======>  lets do this in ICLI and give the formula to customer
         CSR_WARM_WRM(port_no, VTSS_HOST_PMA_SD10G65_VSCOPE2_VSCOPE_PAT_LOCK_CFG_A,
@@ -15770,8 +15823,6 @@ static vtss_rc malibu_phy_10g_vscope_xy_scan_eye_sw( struct vtss_state_s * vtss_
         CSR_WARM_WRM(port_no, VTSS_HOST_PMA_SD10G65_VSCOPE2_VSCOPE_HW_SCAN_CFG_1B,
                 VTSS_F_HOST_PMA_SD10G65_VSCOPE2_VSCOPE_HW_SCAN_CFG_1B_HW_SCAN_ENA(0),
                 VTSS_M_HOST_PMA_SD10G65_VSCOPE2_VSCOPE_HW_SCAN_CFG_1B_HW_SCAN_ENA);
-        conf->scan_conf.x_incr++;
-        conf->scan_conf.y_incr++;
 
         //FREEZE APC 
         CSR_WARM_WRM(port_no, VTSS_HOST_PMA_32BIT_SD10G65_APC_APC_COMMON_CFG0,
@@ -15812,50 +15863,432 @@ static vtss_rc malibu_phy_10g_vscope_xy_scan_eye_sw( struct vtss_state_s * vtss_
         CSR_WARM_WRM(port_no, VTSS_HOST_PMA_SD10G65_VSCOPE2_VSCOPE_PAT_LOCK_CFG_A,
                 VTSS_F_HOST_PMA_SD10G65_VSCOPE2_VSCOPE_PAT_LOCK_CFG_A_PRELOAD_HIT_CNT(hit_cnt),
                 VTSS_M_HOST_PMA_SD10G65_VSCOPE2_VSCOPE_PAT_LOCK_CFG_A_PRELOAD_HIT_CNT);
+    }
+    return VTSS_RC_OK;
+}
 
-        for( j = 0 ; j <= conf->scan_conf.x_count; j = j + conf->scan_conf.x_incr){
+/* Move the sampling point to (phase, ampl) and start the vscope counter */
+static vtss_rc malibu_phy_10g_vscope_xy_point_start(struct vtss_state_s *vtss_state,
+        const vtss_port_no_t port_no,
+        BOOL line,
+        u32 phase,
+        u32 ampl)
+{
+    //write phase and aux values (vscope10g_get_xy_point)
+    if (line) {
+        CSR_WARM_WRM(port_no, VTSS_LINE_PMA_32BIT_SD10G65_RX_SYNTH_SD10G65_RX_SYNTH_CFG2,
+                VTSS_F_LINE_PMA_32BIT_SD10G65_RX_SYNTH_SD10G65_RX_SYNTH_CFG2_SYNTH_PHASE_AUX(phase),
+                VTSS_M_LINE_PMA_32BIT_SD10G65_RX_SYNTH_SD10G65_RX_SYNTH_CFG2_SYNTH_PHASE_AUX);
+        CSR_WARM_WRM(port_no, VTSS_LINE_PMA_32BIT_SD10G65_IB_SD10G65_IB_CFG4 ,
+                VTSS_F_LINE_PMA_32BIT_SD10G65_IB_SD10G65_IB_CFG4_IB_VSCOPE_H_THRES(ampl),
+                VTSS_M_LINE_PMA_32BIT_SD10G65_IB_SD10G65_IB_CFG4_IB_VSCOPE_H_THRES);
+        CSR_WARM_WRM(port_no, VTSS_LINE_PMA_SD10G65_VSCOPE2_VSCOPE_MAIN_CFG_C,
+                VTSS_F_LINE_PMA_SD10G65_VSCOPE2_VSCOPE_MAIN_CFG_C_CNT_ENA,
+                VTSS_F_LINE_PMA_SD10G65_VSCOPE2_VSCOPE_MAIN_CFG_C_CNT_ENA);
+    } else {
+        CSR_WARM_WRM(port_no, VTSS_HOST_PMA_32BIT_SD10G65_RX_SYNTH_SD10G65_RX_SYNTH_CFG2,
+                VTSS_F_HOST_PMA_32BIT_SD10G65_RX_SYNTH_SD10G65_RX_SYNTH_CFG2_SYNTH_PHASE_AUX(phase),
+                VTSS_M_HOST_PMA_32BIT_SD10G65_RX_SYNTH_SD10G65_RX_SYNTH_CFG2_SYNTH_PHASE_AUX);
+        CSR_WARM_WRM(port_no, VTSS_HOST_PMA_32BIT_SD10G65_IB_SD10G65_IB_CFG4 ,
+                VTSS_F_HOST_PMA_32BIT_SD10G65_IB_SD10G65_IB_CFG4_IB_VSCOPE_H_THRES(ampl),
+                VTSS_M_HOST_PMA_32BIT_SD10G65_IB_SD10G65_IB_CFG4_IB_VSCOPE_H_THRES);
+        CSR_WARM_WRM(port_no, VTSS_HOST_PMA_SD10G65_VSCOPE2_VSCOPE_MAIN_CFG_C,
+                VTSS_F_HOST_PMA_SD10G65_VSCOPE2_VSCOPE_MAIN_CFG_C_CNT_ENA,
+                VTSS_F_HOST_PMA_SD10G65_VSCOPE2_VSCOPE_MAIN_CFG_C_CNT_ENA);
+    }
+    return VTSS_RC_OK;
+}
+
+/* Read and stop the vscope counter started by malibu_phy_10g_vscope_xy_point_start() */
+static vtss_rc malibu_phy_10g_vscope_xy_point_read(struct vtss_state_s *vtss_state,
+        const vtss_port_no_t port_no,
+        BOOL line,
+        u32 *const counter_val)
+{
+    u32 tmp;
+
+    if (line) {
+        CSR_RD(port_no, VTSS_LINE_PMA_SD10G65_VSCOPE2_VSCOPE_CNT_A, &tmp);
+        *counter_val = tmp << 16;
+        CSR_RD(port_no, VTSS_LINE_PMA_SD10G65_VSCOPE2_VSCOPE_CNT_B, &tmp);
+        *counter_val |= tmp;
+        CSR_WARM_WRM(port_no, VTSS_LINE_PMA_SD10G65_VSCOPE2_VSCOPE_MAIN_CFG_C,
+                0,
+                VTSS_F_LINE_PMA_SD10G65_VSCOPE2_VSCOPE_MAIN_CFG_C_CNT_ENA);
+    } else {
+        CSR_RD(port_no, VTSS_HOST_PMA_SD10G65_VSCOPE2_VSCOPE_CNT_A, &tmp);
+        *counter_val = tmp << 16;
+        CSR_RD(port_no, VTSS_HOST_PMA_SD10G65_VSCOPE2_VSCOPE_CNT_B, &tmp);
+        *counter_val |= tmp;
+        CSR_WARM_WRM(port_no, VTSS_HOST_PMA_SD10G65_VSCOPE2_VSCOPE_MAIN_CFG_C,
+                0,
+                VTSS_F_HOST_PMA_SD10G65_VSCOPE2_VSCOPE_MAIN_CFG_C_CNT_ENA);
+    }
+    return VTSS_RC_OK;
+}
+
+/* Undo malibu_phy_10g_vscope_xy_scan_prepare() once the scan is done */
+static vtss_rc malibu_phy_10g_vscope_xy_scan_finish(struct vtss_state_s *vtss_state,
+        const vtss_port_no_t port_no,
+        BOOL line,
+        const vtss_phy_10g_vscope_scan_status_t *const conf,
+        vtss_phy_10g_ib_storage_t *const store)
+{
+    //Aux circle phase condition 
+    if ((((conf->scan_conf.x_count * conf->scan_conf.x_incr) % 128) - conf->scan_conf.x_start) > 63){
+        VTSS_RC(malibu_phy_10g_vscope_circle_phase_aux(vtss_state,port_no,line));
+    }
+    //backup settings to be restored ========> resolved 
+    VTSS_RC(malibu_phy_10g_vscope_restore_settings(vtss_state, port_no, line, store));
+    return VTSS_RC_OK;
+}
+
+static vtss_rc malibu_phy_10g_vscope_xy_scan_eye_sw( struct vtss_state_s * vtss_state,
+        const vtss_port_no_t port_no,
+        vtss_phy_10g_vscope_scan_status_t * const conf)
+{
+    vtss_phy_10g_ib_storage_t store; 
+    u32 symDisable, skipAmpl, actPhase, actAmpl, counter_val;
+    u32 i,j;
+    //value to be calculated using x/log10(2)
+    BOOL line;
+    symDisable = 0;
+    line = vtss_state->phy_10g_state[port_no].vscope_conf.line;
+ 
+    //checking bounds of the scan parameters
+    if(conf->scan_conf.x_start + conf->scan_conf.x_count > 127){
+        return VTSS_RC_ERROR;
+    }
+    if(conf->scan_conf.y_start + conf->scan_conf.y_count > 63){
+        return VTSS_RC_ERROR;
+    }
+
+    VTSS_RC(malibu_phy_10g_vscope_xy_scan_prepare(vtss_state, port_no, line, conf->scan_conf.ber, &store));
+    conf->scan_conf.x_incr++;
+    conf->scan_conf.y_incr++;
+    conf->samples = 0;
+
+    for( j = 0 ; j <= conf->scan_conf.x_count; j = j + conf->scan_conf.x_incr){
+        skipAmpl = 0;
+        for( i = 0; (i + skipAmpl) <= conf->scan_conf.y_count; i = i+ conf->scan_conf.y_incr) {
+            actPhase = j + conf->scan_conf.x_start;
             skipAmpl = 0;
-            for( i = 0; (i + skipAmpl) <= conf->scan_conf.y_count; i = i+ conf->scan_conf.y_incr) {
-                actPhase = j + conf->scan_conf.x_start;
-                skipAmpl = 0;
-                if((symDisable == 0) && ( conf->scan_conf.y_start < 32) && ((i + conf->scan_conf.y_start) >= 32)){
-                    skipAmpl = 1;
+            if((symDisable == 0) && ( conf->scan_conf.y_start < 32) && ((i + conf->scan_conf.y_start) >= 32)){
+                skipAmpl = 1;
+            }
+            actAmpl = i + conf->scan_conf.y_start + skipAmpl;
+
+            VTSS_RC(malibu_phy_10g_vscope_xy_point_start(vtss_state, port_no, line, actPhase, actAmpl));
+            VTSS_RC(malibu_phy_10g_vscope_xy_point_read(vtss_state, port_no, line, &counter_val));
+            conf->errors[actPhase][actAmpl] = counter_val;
+            conf->samples++;
+        }
+    }
+    conf->full_samples = conf->samples;
+
+    //some temp array processing here to be added later.
+
+    VTSS_RC(malibu_phy_10g_vscope_xy_scan_finish(vtss_state, port_no, line, conf, &store));
+    return VTSS_RC_OK;
+}
+
+/* Adaptive coarse-to-fine XY scan.
+ * The scan grid is the one of the full scan (x_start, x_incr, x_count and the
+ * y equivalents). A coarse pass measures every coarse_step'th grid point, and
+ * only the coarse cells whose corners do not agree on being inside the eye
+ * (counter <= error_thres) are measured at full resolution. The cells on the
+ * center row and column of the scan window, which decide the eye opening,
+ * are refined first; if min_eye_x and min_eye_y are reached the remaining
+ * boundary cells are skipped. Points that are not measured get the largest
+ * counter of the corners of their coarse cell.
+ * Ports on the same chip can be scanned together: the coarse pass then
+ * starts the counter on all lanes before reading any of them. */
+#define VSCOPE_ADAPTIVE_PORTS_MAX 4 /* lanes in a Malibu chip */
+
+typedef struct {
+    vtss_port_no_t                    port_no;
+    BOOL                              line;
+    u32                               err_thres;
+    vtss_phy_10g_vscope_scan_status_t *conf;
+    vtss_phy_10g_ib_storage_t         store;
+    u32                               x_cnt;   /* Grid points in phase direction */
+    u32                               y_cnt;   /* Grid points in amplitude direction */
+    u64                               sampled[PHASE_POINTS]; /* Bit per measured amplitude */
+} vscope_adaptive_lane_t;
+
+static u32 vscope_adaptive_ampl(const vscope_adaptive_lane_t *const lane, u32 y)
+{
+    const vtss_phy_10g_vscope_scan_conf_t *sc = &lane->conf->scan_conf;
+    u32 i = y * sc->y_incr;
+
+    /* Same amplitude mapping as the full scan: skip 32 when crossing it */
+    if ((sc->y_start < 32) && ((i + sc->y_start) >= 32)) {
+        return i + sc->y_start + 1;
+    }
+    return i + sc->y_start;
+}
+
+static u32 vscope_adaptive_phase(const vscope_adaptive_lane_t *const lane, u32 x)
+{
+    return x * lane->conf->scan_conf.x_incr + lane->conf->scan_conf.x_start;
+}
+
+static u32 *vscope_adaptive_err(const vscope_adaptive_lane_t *const lane, u32 x, u32 y)
+{
+    return &lane->conf->errors[vscope_adaptive_phase(lane, x)][vscope_adaptive_ampl(lane, y)];
+}
+
+static BOOL vscope_adaptive_sampled(const vscope_adaptive_lane_t *const lane, u32 x, u32 y)
+{
+    return (lane->sampled[vscope_adaptive_phase(lane, x)] >> vscope_adaptive_ampl(lane, y)) & 1;
+}
+
+static vtss_rc vscope_adaptive_point_get(struct vtss_state_s *vtss_state,
+        vscope_adaptive_lane_t *const lane, u32 x, u32 y)
+{
+    u32 phase = vscope_adaptive_phase(lane, x), ampl = vscope_adaptive_ampl(lane, y);
+
+    if (vscope_adaptive_sampled(lane, x, y)) {
+        return VTSS_RC_OK;
+    }
+    VTSS_RC(malibu_phy_10g_vscope_xy_point_start(vtss_state, lane->port_no, lane->line, phase, ampl));
+    VTSS_RC(malibu_phy_10g_vscope_xy_point_read(vtss_state, lane->port_no, lane->line, &lane->conf->errors[phase][ampl]));
+    lane->sampled[phase] |= ((u64)1 << ampl);
+    lane->conf->samples++;
+    return VTSS_RC_OK;
+}
+
+/* Coarse grid index c, the last coarse point is always the last grid point */
+static u32 vscope_adaptive_coarse(u32 c, u32 step, u32 cnt)
+{
+    return (c * step < cnt ? c * step : cnt - 1);
+}
+
+static u32 vscope_adaptive_coarse_cnt(u32 step, u32 cnt)
+{
+    return ((cnt - 1 + step - 1) / step) + 1;
+}
+
+/* Bit 0: some corner is open, bit 1: some corner is closed. 3 is a boundary cell */
+static u32 vscope_adaptive_cell_kind(const vscope_adaptive_lane_t *const lane, u32 x0, u32 x1, u32 y0, u32 y1)
+{
+    u32 kind = 0;
+
+    kind |= (*vscope_adaptive_err(lane, x0, y0) <= lane->err_thres ? 1 : 2);
+    kind |= (*vscope_adaptive_err(lane, x0, y1) <= lane->err_thres ? 1 : 2);
+    kind |= (*vscope_adaptive_err(lane, x1, y0) <= lane->err_thres ? 1 : 2);
+    kind |= (*vscope_adaptive_err(lane, x1, y1) <= lane->err_thres ? 1 : 2);
+    return kind;
+}
+
+static vtss_rc vscope_adaptive_cell_refine(struct vtss_state_s *vtss_state,
+        vscope_adaptive_lane_t *const lane, u32 x0, u32 x1, u32 y0, u32 y1)
+{
+    u32 x, y;
+
+    for (x = x0; x <= x1; x++) {
+        for (y = y0; y <= y1; y++) {
+            VTSS_RC(vscope_adaptive_point_get(vtss_state, lane, x, y));
+        }
+    }
+    return VTSS_RC_OK;
+}
+
+/* Point n on the center row (phase_dir) or center column of the window is inside the eye */
+static BOOL vscope_adaptive_center_open(const vscope_adaptive_lane_t *const lane, BOOL phase_dir, u32 n)
+{
+    const u32 *err = (phase_dir ? vscope_adaptive_err(lane, n, lane->y_cnt / 2) :
+                      vscope_adaptive_err(lane, lane->x_cnt / 2, n));
+
+    return (*err <= lane->err_thres);
+}
+
+/* Length of the run of open points through the window center, in grid points */
+static u32 vscope_adaptive_opening(const vscope_adaptive_lane_t *const lane, BOOL phase_dir)
+{
+    u32 cnt = (phase_dir ? lane->x_cnt : lane->y_cnt);
+    u32 lo, hi;
+
+    if (!vscope_adaptive_center_open(lane, phase_dir, cnt / 2)) {
+        return 0;
+    }
+    for (lo = cnt / 2; lo > 0 && vscope_adaptive_center_open(lane, phase_dir, lo - 1); lo--) {
+    }
+    for (hi = cnt / 2; hi + 1 < cnt && vscope_adaptive_center_open(lane, phase_dir, hi + 1); hi++) {
+    }
+    return hi - lo + 1;
+}
+
+/* Fill in the points that were not measured from their coarse cell */
+static void vscope_adaptive_fill(const vscope_adaptive_lane_t *const lane, u32 step, u32 cx_cnt, u32 cy_cnt)
+{
+    u32 cx, cy, x0, x1, y0, y1, x, y, val;
+
+    for (cx = 0; cx + 1 < cx_cnt; cx++) {
+        x0 = vscope_adaptive_coarse(cx, step, lane->x_cnt);
+        x1 = vscope_adaptive_coarse(cx + 1, step, lane->x_cnt);
+        for (cy = 0; cy + 1 < cy_cnt; cy++) {
+            y0 = vscope_adaptive_coarse(cy, step, lane->y_cnt);
+            y1 = vscope_adaptive_coarse(cy + 1, step, lane->y_cnt);
+            val = *vscope_adaptive_err(lane, x0, y0);
+            val = (*vscope_adaptive_err(lane, x0, y1) > val ? *vscope_adaptive_err(lane, x0, y1) : val);
+            val = (*vscope_adaptive_err(lane, x1, y0) > val ? *vscope_adaptive_err(lane, x1, y0) : val);
+            val = (*vscope_adaptive_err(lane, x1, y1) > val ? *vscope_adaptive_err(lane, x1, y1) : val);
+            for (x = x0; x <= x1; x++) {
+                for (y = y0; y <= y1; y++) {
+                    if (!vscope_adaptive_sampled(lane, x, y)) {
+                        *vscope_adaptive_err(lane, x, y) = val;
+                    }
                 }
-                actAmpl = i + conf->scan_conf.y_start + skipAmpl;
+            }
+        }
+    }
+}
 
-                //write phase and aux values (vscope10g_get_xy_point)
-                CSR_WARM_WRM(port_no, VTSS_HOST_PMA_32BIT_SD10G65_RX_SYNTH_SD10G65_RX_SYNTH_CFG2,
-                        VTSS_F_HOST_PMA_32BIT_SD10G65_RX_SYNTH_SD10G65_RX_SYNTH_CFG2_SYNTH_PHASE_AUX(actPhase),
-                        VTSS_M_HOST_PMA_32BIT_SD10G65_RX_SYNTH_SD10G65_RX_SYNTH_CFG2_SYNTH_PHASE_AUX);
-                CSR_WARM_WRM(port_no, VTSS_HOST_PMA_32BIT_SD10G65_IB_SD10G65_IB_CFG4 ,
-                        VTSS_F_HOST_PMA_32BIT_SD10G65_IB_SD10G65_IB_CFG4_IB_VSCOPE_H_THRES(actAmpl),
-                        VTSS_M_HOST_PMA_32BIT_SD10G65_IB_SD10G65_IB_CFG4_IB_VSCOPE_H_THRES);
-                CSR_WARM_WRM(port_no, VTSS_HOST_PMA_SD10G65_VSCOPE2_VSCOPE_MAIN_CFG_C,
-                        VTSS_F_HOST_PMA_SD10G65_VSCOPE2_VSCOPE_MAIN_CFG_C_CNT_ENA,
-                        VTSS_F_HOST_PMA_SD10G65_VSCOPE2_VSCOPE_MAIN_CFG_C_CNT_ENA);
-                CSR_RD(port_no, VTSS_HOST_PMA_SD10G65_VSCOPE2_VSCOPE_CNT_A, &tmp);
-                counter_val = tmp << 16;
-                CSR_RD(port_no, VTSS_HOST_PMA_SD10G65_VSCOPE2_VSCOPE_CNT_B, &tmp);
-                counter_val |= tmp;
-                CSR_WARM_WRM(port_no, VTSS_HOST_PMA_SD10G65_VSCOPE2_VSCOPE_MAIN_CFG_C,
-                        0,
-                        VTSS_F_HOST_PMA_SD10G65_VSCOPE2_VSCOPE_MAIN_CFG_C_CNT_ENA);
-                conf->errors[actPhase][actAmpl] = counter_val;
+static vtss_rc malibu_phy_10g_vscope_adaptive_scan(struct vtss_state_s *vtss_state,
+        u32 port_cnt,
+        const vtss_port_no_t *const port_list,
+        vtss_phy_10g_vscope_scan_status_t *const conf_list)
+{
+    vscope_adaptive_lane_t lanes[VSCOPE_ADAPTIVE_PORTS_MAX], *lane;
+    vtss_phy_10g_vscope_scan_conf_t *sc;
+    u32 n, m, step, cx, cy, cx_cnt, cy_cnt, x0, x1, y0, y1, x, y, pass;
+    BOOL center, done;
+    vtss_rc rc = VTSS_RC_OK;
+
+    if (port_cnt == 0 || port_cnt > VSCOPE_ADAPTIVE_PORTS_MAX) {
+        return VTSS_RC_ERROR;
+    }
+    for (n = 0; n < port_cnt; n++) {
+        sc = &conf_list[n].scan_conf;
+        if (sc->x_start + sc->x_count > 127 || sc->y_start + sc->y_count > 63) {
+            return VTSS_RC_ERROR;
+        }
+        /* The coarse pass is shared, so the lanes must scan the same grid */
+        if (n > 0 && (sc->x_count != conf_list[0].scan_conf.x_count || sc->x_incr != conf_list[0].scan_conf.x_incr ||
+                      sc->y_start != conf_list[0].scan_conf.y_start ||
+                      sc->y_count != conf_list[0].scan_conf.y_count || sc->y_incr != conf_list[0].scan_conf.y_incr ||
+                      sc->coarse_step != conf_list[0].scan_conf.coarse_step)) {
+            return VTSS_RC_ERROR;
+        }
+        /* A port listed twice would have its APC state backed up twice and left frozen on restore */
+        for (m = 0; m < n; m++) {
+            if (port_list[m] == port_list[n]) {
+                return VTSS_RC_ERROR;
             }
         }
+    }
+    memset(lanes, 0, sizeof(lanes));
+
+    for (n = 0; n < port_cnt && rc == VTSS_RC_OK; n++) {
+        lane = &lanes[n];
+        lane->port_no = port_list[n];
+        lane->line = vtss_state->phy_10g_state[lane->port_no].vscope_conf.line;
+        lane->err_thres = vtss_state->phy_10g_state[lane->port_no].vscope_conf.error_thres;
+        lane->conf = &conf_list[n];
+        sc = &lane->conf->scan_conf;
+        if ((rc = malibu_phy_10g_vscope_xy_scan_prepare(vtss_state, lane->port_no, lane->line, sc->ber, &lane->store)) != VTSS_RC_OK) {
+            break;
+        }
+        sc->x_incr++;
+        sc->y_incr++;
+        lane->x_cnt = sc->x_count / sc->x_incr + 1;
+        for (lane->y_cnt = 0; vscope_adaptive_ampl(lane, lane->y_cnt) <= sc->y_start + sc->y_count; lane->y_cnt++) {
+        }
+        lane->conf->samples = 0;
+        lane->conf->full_samples = lane->x_cnt * lane->y_cnt;
+    }
+    if (rc != VTSS_RC_OK) {
+        port_cnt = n;
+        goto finish;
+    }
 
-        //some temp array processing here to be added later.
+    step = (conf_list[0].scan_conf.coarse_step ? conf_list[0].scan_conf.coarse_step : 4);
+    cx_cnt = vscope_adaptive_coarse_cnt(step, lanes[0].x_cnt);
+    cy_cnt = vscope_adaptive_coarse_cnt(step, lanes[0].y_cnt);
+
+    /* Coarse pass, interleaved across the lanes */
+    for (cx = 0; cx < cx_cnt && rc == VTSS_RC_OK; cx++) {
+        for (cy = 0; cy < cy_cnt && rc == VTSS_RC_OK; cy++) {
+            x = vscope_adaptive_coarse(cx, step, lanes[0].x_cnt);
+            for (n = 0; n < port_cnt && rc == VTSS_RC_OK; n++) {
+                y = vscope_adaptive_coarse(cy, step, lanes[n].y_cnt);
+                rc = malibu_phy_10g_vscope_xy_point_start(vtss_state, lanes[n].port_no, lanes[n].line,
+                                                          vscope_adaptive_phase(&lanes[n], x), vscope_adaptive_ampl(&lanes[n], y));
+            }
+            for (n = 0; n < port_cnt && rc == VTSS_RC_OK; n++) {
+                lane = &lanes[n];
+                y = vscope_adaptive_coarse(cy, step, lane->y_cnt);
+                rc = malibu_phy_10g_vscope_xy_point_read(vtss_state, lane->port_no, lane->line, vscope_adaptive_err(lane, x, y));
+                lane->sampled[vscope_adaptive_phase(lane, x)] |= ((u64)1 << vscope_adaptive_ampl(lane, y));
+                lane->conf->samples++;
+            }
+        }
+    }
 
-        //Aux circle phase condition 
-        if ((((conf->scan_conf.x_count * conf->scan_conf.x_incr)%128)-conf->scan_conf.x_start) > 63){
-            VTSS_RC(malibu_phy_10g_vscope_circle_phase_aux(vtss_state,port_no,0));
+    /* Refine the boundary cells: pass 0 does the cells on the center row and
+       column, pass 1 the rest unless the eye is already known to be open enough */
+    for (n = 0; n < port_cnt && rc == VTSS_RC_OK; n++) {
+        lane = &lanes[n];
+        sc = &lane->conf->scan_conf;
+        done = FALSE;
+        for (pass = 0; pass < 2 && !done && rc == VTSS_RC_OK; pass++) {
+            for (cx = 0; cx + 1 < cx_cnt && rc == VTSS_RC_OK; cx++) {
+                x0 = vscope_adaptive_coarse(cx, step, lane->x_cnt);
+                x1 = vscope_adaptive_coarse(cx + 1, step, lane->x_cnt);
+                for (cy = 0; cy + 1 < cy_cnt && rc == VTSS_RC_OK; cy++) {
+                    y0 = vscope_adaptive_coarse(cy, step, lane->y_cnt);
+                    y1 = vscope_adaptive_coarse(cy + 1, step, lane->y_cnt);
+                    center = ((x0 <= lane->x_cnt / 2 && lane->x_cnt / 2 <= x1) ||
+                              (y0 <= lane->y_cnt / 2 && lane->y_cnt / 2 <= y1));
+                    if ((pass == 0) != center) {
+                        continue;
+                    }
+                    if (vscope_adaptive_cell_kind(lane, x0, x1, y0, y1) == 3) {
+                        rc = vscope_adaptive_cell_refine(vtss_state, lane, x0, x1, y0, y1);
+                    }
+                }
+            }
+            /* The opening is measured on the filled grid, unmeasured points would look error free */
+            vscope_adaptive_fill(lane, step, cx_cnt, cy_cnt);
+            lane->conf->error_free_x = vscope_adaptive_opening(lane, TRUE) * sc->x_incr;
+            lane->conf->error_free_y = vscope_adaptive_opening(lane, FALSE) * sc->y_incr;
+            lane->conf->amp_range = sc->y_count;
+            if ((sc->min_eye_x || sc->min_eye_y) &&
+                (u32)lane->conf->error_free_x >= sc->min_eye_x && (u32)lane->conf->error_free_y >= sc->min_eye_y) {
+                /* Eye is open enough, skip the rest of the boundary */
+                done = TRUE;
+            }
         }
-        //backup settings to be restored ========> resolved 
-        VTSS_RC(malibu_phy_10g_vscope_restore_settings(vtss_state, port_no, 0, &store));
+
+        VTSS_D("port %u: adaptive vscope scan measured %u of %u points", lane->port_no,
+               lane->conf->samples, lane->conf->full_samples);
     }
-    return VTSS_RC_OK;
+
+finish:
+    for (n = 0; n < port_cnt; n++) {
+        if (malibu_phy_10g_vscope_xy_scan_finish(vtss_state, lanes[n].port_no, lanes[n].line, lanes[n].conf, &lanes[n].store) != VTSS_RC_OK) {
+            rc = VTSS_RC_ERROR;
+        }
+    }
+    return rc;
 }
 
+static vtss_rc malibu_phy_10g_vscope_scan_status_multi_get(struct vtss_state_s *vtss_state,
+        u32 port_cnt,
+        const vtss_port_no_t *const port_list,
+        vtss_phy_10g_vscope_scan_status_t *const conf_list)
+{
+    u32 n;
+
+    for (n = 0; n < port_cnt; n++) {
+        if (vtss_state->phy_10g_state[port_list[n]].vscope_conf.scan_type != VTSS_PHY_10G_ADAPTIVE_SCAN ||
+            vtss_state->phy_10g_state[port_list[n]].phy_api_base_no != vtss_state->phy_10g_state[port_list[0]].phy_api_base_no) {
+            return VTSS_RC_ERROR;
+        }
+    }
+    return malibu_phy_10g_vscope_adaptive_scan(vtss_state, port_cnt, port_list, conf_list);
+}
 
 
 static vtss_rc malibu_phy_10g_vscope_scan_status_get( struct vtss_state_s *vtss_state,
@@ -15868,6 +16301,8 @@ static vtss_rc malibu_phy_10g_vscope_scan_status_get( struct vtss_state_s *vtss_
         VTSS_RC(malibu_phy_10g_vscope_fast_scan_status_get(vtss_state, port_no, conf));
     } else if (scan_type == VTSS_PHY_10G_FULL_SCAN){
         VTSS_RC(malibu_phy_10g_vscope_xy_scan_eye_sw(vtss_state, port_no, conf));
+    } else if (scan_type == VTSS_PHY_10G_ADAPTIVE_SCAN){
+        VTSS_RC(malibu_phy_10g_vscope_adaptive_scan(vtss_state, 1, &port_no, conf));
     } else {
         return VTSS_RC_ERROR;
     }
@@ -18171,6 +18606,7 @@ vtss_rc vtss_phy_10g_inst_malibu_create(vtss_state_t *vtss_state)
     func->malibu_phy_10g_event_poll = malibu_phy_10g_event_poll;
     func->malibu_phy_10g_extended_event_poll = malibu_phy_10g_extended_event_poll;
     func->malibu_phy_10g_extended2_event_poll = malibu_phy_10g_extended2_event_poll;
+    func->malibu_phy_10g_event_summary_get = malibu_phy_10g_event_summary_get;
     func->malibu_phy_10g_pcs_status_get = malibu_phy_10g_pcs_status_get;
     func->malibu_phy_10g_host_recvrd_clk_set = malibu_phy_10g_host_recvrd_clk_set;
     func->malibu_phy_10g_line_clk_set = malibu_phy_10g_line_clk_set;
@@ -18188,6 +18624,7 @@ vtss_rc vtss_phy_10g_inst_malibu_create(vtss_state_t *vtss_state)
     func->malibu_phy_10g_prbs_mon_status_get = malibu_phy_10g_prbs_mon_status_get;
     func->malibu_phy_10g_vscope_conf_set= malibu_phy_10g_vscope_conf_set;
     func->malibu_phy_10g_vscope_scan_status_get = malibu_phy_10g_vscope_scan_status_get;
+    func->malibu_phy_10g_vscope_scan_status_multi_get = malibu_phy_10g_vscope_scan_status_multi_get;
     func->malibu_phy_10g_ib_conf_set = malibu_phy_10g_ib_conf_set;
     func->malibu_phy_10g_ib_status_get = malibu_phy_10g_ib_status_get;
     func->malibu_phy_10g_ob_status_get = malibu_phy_10g_ob_status_get;
@@ -18199,6 +18636,7 @@ vtss_rc vtss_phy_10g_inst_malibu_create(vtss_state_t *vtss_state)
     func->malibu_phy_10g_serdes_status_get = malibu_phy_10g_serdes_status_get;
     func->malibu_phy_10g_sgmii_mode_set = malibu_phy_10g_sgmii_mode_set;
     func->malibu_phy_10g_debug_reg_dump = malibu_10g_debug_reg_dump;
+    func->malibu_phy_10g_snapshot_reg_get = malibu_10g_snapshot_reg_get;
     func->malibu_phy_10g_base_kr_conf_set = malibu_phy_10g_base_kr_conf_set;
     func->malibu_phy_10g_base_kr_host_conf_set = malibu_phy_10g_base_kr_host_conf_set;
 #ifdef VTSS_FEATURE_10GBASE_KR
@@ -6526,6 +6526,177 @@ vtss_rc venice_phy_10g_debug_reg_dump(vtss_state_t *vtss_state,
     return (VTSS_RC_OK);
 }
 
+/* Registers printed by venice_phy_10g_debug_reg_dump(), used by the register snapshot.
+   The APC registers move on revision A and are kept in separate tables at the end. */
+#undef VTSS_IOREG
+#define VTSS_IOREG(dev, is32, off) {(dev), (is32), (off)}
+static const ioreg_blk venice_snapshot_reg_tbl[] = {
+    VTSS_VENICE_GLOBAL_Device_Info_Device_ID,
+    VTSS_VENICE_GLOBAL_Device_Info_Device_Revision,
+    VTSS_VENICE_GLOBAL_Pin_Status_Pin_Status,
+    VTSS_VENICE_PCS_Eth_10GBASE_R_PCS_Status_2_Eth_10GBASE_R_PCS_Status_2,
+    VTSS_VENICE_PCS_Eth_10GBASE_R_PCS_Status_1_Eth_10GBASE_R_PCS_Status_1,
+    VTSS_VENICE_PCS_PCS_Status_2_PCS_Status_2,
+    VTSS_VENICE_PCS_PCS_Status_1_PCS_Status_1,
+    VTSS_VENICE_DEV4_PHY_XS_Status_2_PHY_XS_Status_2,
+    VTSS_PCS_XAUI_PCS_XAUI_CONFIGURATION_PCS_XAUI_INTERLEAVE_MODE_CFG,
+    VTSS_PCS_XAUI_PCS_XAUI_CONFIGURATION_PCS_XAUI_INTERLEAVE_MODE_CFG2,
+    VTSS_PCS_XAUI_PCS_XAUI_STATUS_PCS_XAUI_STATUS,
+    VTSS_PCS_XAUI_PCS_XAUI_STATUS_PCS_XAUI_STATUS2,
+    VTSS_PCS_XAUI_PCS_XAUI_STATUS_PCS_XAUI_INT,
+    VTSS_PCS_XAUI_PCS_XAUI_STATUS_PCS_XAUI_INT2,
+    VTSS_PCS_XAUI_PCS_XAUI_STATUS_PCS_XAUI_RX_SEQ_REC_STATUS,
+    VTSS_PCS_XAUI_PCS_XAUI_ERR_COUNTERS_PCS_XAUI_RX_ALIGN_ERR_CNT,
+    VTSS_PCS_XAUI_PCS_XAUI_ERR_COUNTERS_PCS_XAUI_XGMII_ERR_CNT,
+    VTSS_PCS_XAUI_PCS_XAUI_ERR_COUNTERS_PCS_XAUI_RX_FIFO_OF_ERR_L0_CNT_STATUS,
+    VTSS_PCS_XAUI_PCS_XAUI_ERR_COUNTERS_PCS_XAUI_RX_FIFO_UF_ERR_L1_CNT_STATUS,
+    VTSS_PCS_XAUI_PCS_XAUI_ERR_COUNTERS_PCS_XAUI_RX_FIFO_D_ERR_L2_CNT_STATUS,
+    VTSS_PCS_XAUI_PCS_XAUI_ERR_COUNTERS_PCS_XAUI_RX_FIFO_CG_ERR_L3_CNT_STATUS,
+    VTSS_HOST_PLL5G_H_PLL5G_H_PLL5G_STATUS0,
+    VTSS_HOST_PLL5G_H_PLL5G_H_PLL5G_STATUS1A,
+    VTSS_HOST_PLL5G_H_PLL5G_H_PLL5G_STATUS1B,
+    VTSS_LINE_PLL5G_L_PLL5G_L_PLL5G_STATUS0,
+    VTSS_LINE_PLL5G_L_PLL5G_L_PLL5G_STATUS1A,
+    VTSS_LINE_PLL5G_L_PLL5G_L_PLL5G_STATUS1B,
+    VTSS_VENICE_DEV1_32_SD10G65_RX_RCPLL_SD10G65_RX_RCPLL_STAT0,
+    VTSS_VENICE_DEV1_32_SD10G65_RX_RCPLL_SD10G65_RX_RCPLL_STAT1,
+    VTSS_VENICE_DEV1_32_SD10G65_TX_RCPLL_SD10G65_TX_RCPLL_STAT0,
+    VTSS_VENICE_DEV1_32_SD10G65_TX_RCPLL_SD10G65_TX_RCPLL_STAT1,
+    VTSS_VENICE_DEV1_DATAPATH_CONTROL_DATAPATH_MODE,
+    VTSS_VENICE_DEV1_SD10G65_SYNC_CTRL_SYNC_CTRL_CFG,
+    VTSS_VENICE_DEV1_SD10G65_SYNC_CTRL_SYNC_CTRL_STAT,
+    VTSS_VENICE_DEV1_32_SD10G65_OB_SD10G65_OB_CFG0,
+    VTSS_VENICE_DEV1_32_SD10G65_OB_SD10G65_OB_CFG1,
+    VTSS_VENICE_DEV1_32_SD10G65_OB_SD10G65_OB_CFG2,
+    VTSS_VENICE_DEV4_SERDES6G_ANA_CFG_SERDES6G_IB_CFG0B,
+    VTSS_VENICE_DEV4_SERDES6G_ANA_CFG_SERDES6G_IB_CFG1B,
+    VTSS_VENICE_DEV4_SERDES6G_ANA_CFG_SERDES6G_IB_CFG3A,
+    VTSS_VENICE_DEV4_SERDES6G_ANA_CFG_SERDES6G_IB_CFG3B,
+    VTSS_VENICE_DEV4_SERDES6G_ANA_CFG_SERDES6G_IB_CFG4A,
+    VTSS_VENICE_DEV4_SERDES6G_ANA_CFG_SERDES6G_IB_CFG4B,
+    VTSS_VENICE_DEV4_SERDES6G_ANA_CFG_SERDES6G_IB_CFG5A,
+    VTSS_VENICE_DEV4_SERDES6G_ANA_CFG_SERDES6G_IB_CFG5B,
+    VTSS_VENICE_DEV4_SERDES6G_ANA_CFG_SERDES6G_OB_CFG0A,
+    VTSS_VENICE_DEV4_SERDES6G_ANA_CFG_SERDES6G_OB_CFG0B,
+    VTSS_VENICE_DEV4_SERDES6G_ANA_CFG_SERDES6G_OB_CFG1,
+    VTSS_VENICE_DEV4_SERDES6G_ANA_CFG_SERDES6G_SER_CFG,
+    VTSS_VENICE_DEV4_SERDES6G_ANA_CFG_SERDES6G_COMMON_CFGA,
+    VTSS_VENICE_DEV4_SERDES6G_ANA_CFG_SERDES6G_COMMON_CFGB,
+    VTSS_VENICE_DEV4_MACRO_CTRL_STATUS_MACRO_CTRL_STAT,
+    VTSS_VENICE_DEV4_MACRO_CTRL_STATUS_MACRO_CTRL_SIGDRV_STAT,
+    VTSS_VENICE_DEV4_SERDES6G_ANA_STATUS_SERDES6G_IB_STATUS0(0),
+    VTSS_VENICE_DEV4_SERDES6G_ANA_STATUS_SERDES6G_IB_STATUS1A(0),
+    VTSS_VENICE_DEV4_SERDES6G_ANA_STATUS_SERDES6G_IB_STATUS1B(0),
+    VTSS_VENICE_DEV4_SERDES6G_ANA_STATUS_SERDES6G_ACJTAG_STATUS(0),
+    VTSS_VENICE_DEV4_SERDES6G_ANA_STATUS_SERDES6G_PLL_STATUS(0),
+    VTSS_VENICE_DEV4_SERDES6G_ANA_STATUS_SERDES6G_REVIDA(0),
+    VTSS_VENICE_DEV4_SERDES6G_ANA_STATUS_SERDES6G_REVIDB(0),
+    VTSS_VENICE_DEV4_SERDES6G_ANA_STATUS_SERDES6G_IB_STATUS0(1),
+    VTSS_VENICE_DEV4_SERDES6G_ANA_STATUS_SERDES6G_IB_STATUS1A(1),
+    VTSS_VENICE_DEV4_SERDES6G_ANA_STATUS_SERDES6G_IB_STATUS1B(1),
+    VTSS_VENICE_DEV4_SERDES6G_ANA_STATUS_SERDES6G_ACJTAG_STATUS(1),
+    VTSS_VENICE_DEV4_SERDES6G_ANA_STATUS_SERDES6G_PLL_STATUS(1),
+    VTSS_VENICE_DEV4_SERDES6G_ANA_STATUS_SERDES6G_REVIDA(1),
+    VTSS_VENICE_DEV4_SERDES6G_ANA_STATUS_SERDES6G_REVIDB(1),
+    VTSS_VENICE_DEV4_SERDES6G_ANA_STATUS_SERDES6G_IB_STATUS0(2),
+    VTSS_VENICE_DEV4_SERDES6G_ANA_STATUS_SERDES6G_IB_STATUS1A(2),
+    VTSS_VENICE_DEV4_SERDES6G_ANA_STATUS_SERDES6G_IB_STATUS1B(2),
+    VTSS_VENICE_DEV4_SERDES6G_ANA_STATUS_SERDES6G_ACJTAG_STATUS(2),
+    VTSS_VENICE_DEV4_SERDES6G_ANA_STATUS_SERDES6G_PLL_STATUS(2),
+    VTSS_VENICE_DEV4_SERDES6G_ANA_STATUS_SERDES6G_REVIDA(2),
+    VTSS_VENICE_DEV4_SERDES6G_ANA_STATUS_SERDES6G_REVIDB(2),
+    VTSS_VENICE_DEV4_SERDES6G_ANA_STATUS_SERDES6G_IB_STATUS0(3),
+    VTSS_VENICE_DEV4_SERDES6G_ANA_STATUS_SERDES6G_IB_STATUS1A(3),
+    VTSS_VENICE_DEV4_SERDES6G_ANA_STATUS_SERDES6G_IB_STATUS1B(3),
+    VTSS_VENICE_DEV4_SERDES6G_ANA_STATUS_SERDES6G_ACJTAG_STATUS(3),
+    VTSS_VENICE_DEV4_SERDES6G_ANA_STATUS_SERDES6G_PLL_STATUS(3),
+    VTSS_VENICE_DEV4_SERDES6G_ANA_STATUS_SERDES6G_REVIDA(3),
+    VTSS_VENICE_DEV4_SERDES6G_ANA_STATUS_SERDES6G_REVIDB(3),
+    VTSS_VENICE_PCS_PCS_Tx_Sequencing_Error_Count_PCS_Tx_Sequencing_Error_Count,
+    VTSS_VENICE_PCS_PCS_Rx_Sequencing_Error_Count_PCS_Rx_Sequencing_Error_Count,
+    VTSS_VENICE_PCS_PCS_Tx_Block_Encode_Error_Count_PCS_Tx_Block_Encode_Error_Count,
+    VTSS_VENICE_PCS_PCS_Rx_Block_Decode_Error_Count_PCS_Rx_Block_Decode_Error_Count,
+    VTSS_VENICE_PCS_PCS_Tx_Char_Encode_Error_Count_PCS_Tx_Char_Encode_Error_Count,
+    VTSS_VENICE_PCS_PCS_Rx_Char_Decode_Error_Count_PCS_Rx_Char_Decode_Error_Count,
+    VTSS_VENICE_GLOBAL_Temp_Monitor_Temp_Mon_Regs,
+    VTSS_VENICE_DEV1_32_SD10G65_APC_APC_EQZ_L_CTRL,
+    VTSS_VENICE_DEV1_32_SD10G65_APC_APC_EQZ_L_TIMER_CFG,
+    VTSS_FIFO_BIST_Datapath_Control_Datapath_Control,
+    VTSS_FIFO_BIST_MON_GOODCRC_MON_GOOD_LSW,
+    VTSS_FIFO_BIST_MON_GOODCRC_MON_GOOD_MSW,
+    VTSS_FIFO_BIST_MON_BADCRC_MON_BAD_LSW,
+    VTSS_FIFO_BIST_MON_BADCRC_MON_BAD_MSW,
+    VTSS_FIFO_BIST_MON_FRAG_MON_FRAG_LSW,
+    VTSS_FIFO_BIST_MON_FRAG_MON_FRAG_MSW,
+    VTSS_FIFO_BIST_MON_LFAULT_MON_LFAULT_LSW,
+    VTSS_FIFO_BIST_MON_LFAULT_MON_LFAULT_MSW,
+    VTSS_FIFO_BIST_MON_BER_MON_BER_LSW,
+    VTSS_FIFO_BIST_MON_BER_MON_BER_MSW,
+};
+
+static const ioreg_blk venice_snapshot_apc_tbl[] = {
+    VTSS_VENICE_DEV1_32_SD10G65_APC_APC_EQZ_L_CTRL,
+    VTSS_VENICE_DEV1_32_SD10G65_APC_APC_EQZ_L_PAR_CFG,
+    VTSS_VENICE_DEV1_32_SD10G65_APC_APC_EQZ_C_CTRL,
+    VTSS_VENICE_DEV1_32_SD10G65_APC_APC_EQZ_C_PAR_CFG,
+    VTSS_VENICE_DEV1_32_SD10G65_APC_APC_EQZ_AGC_CTRL,
+    VTSS_VENICE_DEV1_32_SD10G65_APC_APC_EQZ_AGC_PAR_CFG,
+    VTSS_VENICE_DEV1_32_SD10G65_APC_APC_EQZ_OFFS_CTRL,
+    VTSS_VENICE_DEV1_32_SD10G65_APC_APC_EQZ_OFFS_PAR_CFG,
+    VTSS_VENICE_DEV1_32_SD10G65_APC_APC_EQZ_LD_CTRL,
+    VTSS_VENICE_DEV1_32_SD10G65_APC_APC_EQZ_CTRL_STATUS,
+    VTSS_VENICE_DEV1_32_SD10G65_APC_APC_EQZ_GAIN_CTRL_CFG,
+    VTSS_VENICE_DEV1_32_SD10G65_APC_APC_DFE1_CTRL,
+    VTSS_VENICE_DEV1_32_SD10G65_APC_APC_DFE1_PAR_CFG,
+    VTSS_VENICE_DEV1_32_SD10G65_APC_APC_DFE2_CTRL,
+    VTSS_VENICE_DEV1_32_SD10G65_APC_APC_DFE2_PAR_CFG,
+    VTSS_VENICE_DEV1_32_SD10G65_APC_APC_DFE3_CTRL,
+    VTSS_VENICE_DEV1_32_SD10G65_APC_APC_DFE3_PAR_CFG,
+    VTSS_VENICE_DEV1_32_SD10G65_APC_APC_DFE4_CTRL,
+    VTSS_VENICE_DEV1_32_SD10G65_APC_APC_DFE4_PAR_CFG,
+    VTSS_VENICE_DEV1_32_SD10G65_APC_APC_COMMON_CFG0,
+};
+
+static const ioreg_blk venice_snapshot_apc_rev_a_tbl[] = {
+    VTSS_VENICE_DEV1_32_SD10G65_APC_APC_EQZ_L_CTRL_REV_A,
+    VTSS_VENICE_DEV1_32_SD10G65_APC_APC_EQZ_L_PAR_CFG_REV_A,
+    VTSS_VENICE_DEV1_32_SD10G65_APC_APC_EQZ_C_CTRL_REV_A,
+    VTSS_VENICE_DEV1_32_SD10G65_APC_APC_EQZ_C_PAR_CFG_REV_A,
+    VTSS_VENICE_DEV1_32_SD10G65_APC_APC_EQZ_AGC_CTRL_REV_A,
+    VTSS_VENICE_DEV1_32_SD10G65_APC_APC_EQZ_AGC_PAR_CFG_REV_A,
+    VTSS_VENICE_DEV1_32_SD10G65_APC_APC_EQZ_OFFS_CTRL_REV_A,
+    VTSS_VENICE_DEV1_32_SD10G65_APC_APC_EQZ_OFFS_PAR_CFG_REV_A,
+    VTSS_VENICE_DEV1_32_SD10G65_APC_APC_EQZ_LD_CTRL_REV_A,
+    VTSS_VENICE_DEV1_32_SD10G65_APC_APC_EQZ_CTRL_STATUS_REV_A,
+    VTSS_VENICE_DEV1_32_SD10G65_APC_APC_EQZ_GAIN_CTRL_CFG_REV_A,
+    VTSS_VENICE_DEV1_32_SD10G65_APC_APC_DFE1_CTRL_REV_A,
+    VTSS_VENICE_DEV1_32_SD10G65_APC_APC_DFE1_PAR_CFG_REV_A,
+    VTSS_VENICE_DEV1_32_SD10G65_APC_APC_DFE2_CTRL_REV_A,
+    VTSS_VENICE_DEV1_32_SD10G65_APC_APC_DFE2_PAR_CFG_REV_A,
+    VTSS_VENICE_DEV1_32_SD10G65_APC_APC_DFE3_CTRL_REV_A,
+    VTSS_VENICE_DEV1_32_SD10G65_APC_APC_DFE3_PAR_CFG_REV_A,
+    VTSS_VENICE_DEV1_32_SD10G65_APC_APC_DFE4_CTRL_REV_A,
+    VTSS_VENICE_DEV1_32_SD10G65_APC_APC_DFE4_PAR_CFG_REV_A,
+    VTSS_VENICE_DEV1_32_SD10G65_APC_APC_COMMON_CFG0_REV_A,
+};
+#undef VTSS_IOREG
+#define VTSS_IOREG(dev, is32, off)  _ioreg(&vtss_state->io_var, (dev), (is32), (off))
+
+static vtss_rc venice_phy_10g_snapshot_reg_get(vtss_state_t *vtss_state, vtss_port_no_t port_no,
+                                               u32 idx, ioreg_blk *const reg, u32 *const cnt)
+{
+    const ioreg_blk *apc = (venice_rev_a(vtss_state, port_no) ? venice_snapshot_apc_rev_a_tbl : venice_snapshot_apc_tbl);
+    u32             base = VTSS_ARRSZ(venice_snapshot_reg_tbl);
+
+    *cnt = base + VTSS_ARRSZ(venice_snapshot_apc_tbl);
+    if (idx < base) {
+        *reg = venice_snapshot_reg_tbl[idx];
+    } else if (idx < *cnt) {
+        *reg = apc[idx - base];
+    }
+    return VTSS_RC_OK;
+}
+
 
 static void prnt_reg(char *reg_name,u32 value,const vtss_debug_printf_t pr) {
     int tcount = 0;
@@ -6944,6 +7115,12 @@ vtss_rc vtss_phy_10g_debug_info_print(vtss_state_t              *vtss_state,
             id10g = &vtss_state->phy_10g_state[port_no];
             pr("%-6d %-10d %-10d %-10d %-10d %-10d\n",port_no, id10g->type, id10g->revision, id10g->channel_id, id10g->phy_api_base_no, id10g->device_feature_status);
         }
+#if VTSS_OPT_PHY_SD10G65_CALC_CACHE
+        if (!init) {
+            pr("\n");
+            vtss_sd10g65_calc_cache_print(pr);
+        }
+#endif
         return VTSS_RC_OK;
     }
 
@@ -9525,6 +9702,7 @@ vtss_rc vtss_phy_10g_inst_venice_create(vtss_state_t *vtss_state)
     func->phy_10g_sgmii_mode_set = venice_phy_10g_sgmii_mode_set;
     func->phy_10g_lane_sync_set  = phy_10g_lane_sync_set;
     func->vtss_phy_10g_debug_reg_dump = venice_phy_10g_debug_reg_dump;
+    func->vtss_phy_10g_snapshot_reg_get = venice_phy_10g_snapshot_reg_get;
     func->venice_cross_connect = vtss_phy_10g_venice_cross_connect;
     func->phy_10g_prbs_gen_conf = phy_10g_prbs_gen_conf;
     func->phy_10g_prbs_mon_conf = phy_10g_prbs_mon_conf;
@@ -576,8 +576,8 @@ static vtss_rc setup_loop_cfg (const vtss_chip_name_t chip_name,
 /********************************************************************************
  ***                   vtss_calc_sd10g65_setup_tx                                  ***
  ********************************************************************************/
-vtss_rc vtss_calc_sd10g65_setup_tx(const vtss_sd10g65_setup_tx_args_t config,
-                                   vtss_sd10g65_setup_tx_struct_t     *const ret_val) {
+static vtss_rc sd10g65_setup_tx_calc(const vtss_sd10g65_setup_tx_args_t config,
+                                     vtss_sd10g65_setup_tx_struct_t     *const ret_val) {
 
     vtss_rc               rslt;
     vtss_sd10g65_f_pll_t           cfg_f_pll = config.f_pll;
@@ -815,8 +815,8 @@ vtss_rc vtss_sd10g65_setup_rx_args_init (vtss_sd10g65_setup_rx_args_t     *const
 /********************************************************************************
  ***                   calc_sd10g65_setup_rx                                ***
  ********************************************************************************/
-vtss_rc vtss_calc_sd10g65_setup_rx(const vtss_sd10g65_setup_rx_args_t config,
-                                   vtss_sd10g65_setup_rx_struct_t     *const ret_val) {
+static vtss_rc sd10g65_setup_rx_calc(const vtss_sd10g65_setup_rx_args_t config,
+                                     vtss_sd10g65_setup_rx_struct_t     *const ret_val) {
 
     vtss_rc rslt;
     vtss_sd10g65_f_pll_t           cfg_f_pll = config.f_pll;
@@ -1347,8 +1347,8 @@ vtss_rc vtss_sd10g65_setup_f2df_args_init(vtss_sd10g65_setup_f2df_args_t *const
 /********************************************************************************
  ***                   calc_sd10g65_setup_f2df                                ***
  ********************************************************************************/
-vtss_rc vtss_calc_sd10g65_setup_f2df(const vtss_sd10g65_setup_f2df_args_t config,
-                                     vtss_sd10g65_setup_f2df_struct_t     *const ret_val ) {
+static vtss_rc sd10g65_setup_f2df_calc(const vtss_sd10g65_setup_f2df_args_t config,
+                                       vtss_sd10g65_setup_f2df_struct_t     *const ret_val ) {
 
     vtss_rc rslt;
     vtss_sd10g65_f_pll_t           cfg_f_in = config.f_in;
@@ -1888,8 +1888,8 @@ vtss_rc vtss_sd10g65_setup_df2f_args_init (vtss_sd10g65_setup_df2f_args_t     *c
 }
 
 
-vtss_rc vtss_calc_sd10g65_setup_df2f(const vtss_sd10g65_setup_df2f_args_t config,
-                                     vtss_sd10g65_setup_df2f_struct_t     *const ret_val) {
+static vtss_rc sd10g65_setup_df2f_calc(const vtss_sd10g65_setup_df2f_args_t config,
+                                       vtss_sd10g65_setup_df2f_struct_t     *const ret_val) {
 
     vtss_rc                        rslt;
     vtss_sd10g65_f_pll_t           cfg_f_out = config.f_out;
@@ -2351,6 +2351,256 @@ vtss_rc vtss_calc_sd10g65_setup_df2f(const vtss_sd10g65_setup_df2f_args_t config
 
 
 
+/********************************************************************************
+ ***                   Setup calculation cache                                ***
+ ********************************************************************************/
+/* The setup calculations only depend on their arguments (chip, data rate,
+ * preset, loop options, ...), so the results of the most recently used
+ * argument sets are kept and returned on mode set, failover and KR retrain
+ * instead of redoing the synthesizer and loop configuration math.
+ * The argument sets are copied field by field into a zeroed key, so that
+ * structure padding never makes two identical argument sets look different. */
+#if VTSS_OPT_PHY_SD10G65_CALC_CACHE
+#define SD10G65_CALC_CACHE_SIZE 8
+
+typedef struct {
+    const char *name;
+    u8         *key;        /* SD10G65_CALC_CACHE_SIZE keys */
+    u8         *rslt;       /* SD10G65_CALC_CACHE_SIZE results */
+    u32        key_size;
+    u32        rslt_size;
+    u32        cnt;         /* Number of valid entries */
+    u32        next;        /* Entry to replace when the cache is full */
+    u32        hits;
+    u32        misses;
+    u32        check_errors;
+} sd10g65_calc_cache_t;
+
+#define SD10G65_CALC_CACHE(_n, _args_t, _rslt_t)                                      \
+    static struct {                                                                   \
+        _args_t key[SD10G65_CALC_CACHE_SIZE];                                         \
+        _rslt_t rslt[SD10G65_CALC_CACHE_SIZE];                                        \
+    } sd10g65_##_n##_store;                                                           \
+    static sd10g65_calc_cache_t sd10g65_##_n##_cache = {                              \
+        #_n, (u8 *)sd10g65_##_n##_store.key, (u8 *)sd10g65_##_n##_store.rslt,         \
+        sizeof(_args_t), sizeof(_rslt_t), 0, 0, 0, 0, 0                               \
+    }
+
+SD10G65_CALC_CACHE(tx,   vtss_sd10g65_setup_tx_args_t,   vtss_sd10g65_setup_tx_struct_t);
+SD10G65_CALC_CACHE(rx,   vtss_sd10g65_setup_rx_args_t,   vtss_sd10g65_setup_rx_struct_t);
+SD10G65_CALC_CACHE(f2df, vtss_sd10g65_setup_f2df_args_t, vtss_sd10g65_setup_f2df_struct_t);
+SD10G65_CALC_CACHE(df2f, vtss_sd10g65_setup_df2f_args_t, vtss_sd10g65_setup_df2f_struct_t);
+
+static sd10g65_calc_cache_t *const sd10g65_calc_caches[] = {
+    &sd10g65_tx_cache, &sd10g65_rx_cache, &sd10g65_f2df_cache, &sd10g65_df2f_cache
+};
+
+/* Return the index of the entry matching key, or -1 */
+static int sd10g65_calc_cache_lookup(const sd10g65_calc_cache_t *const cache, const void *const key)
+{
+    u32 i;
+
+    for (i = 0; i < cache->cnt; i++) {
+        if (memcmp(cache->key + i * cache->key_size, key, cache->key_size) == 0) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+static void sd10g65_calc_cache_store(sd10g65_calc_cache_t *const cache, const void *const key, const void *const rslt)
+{
+    u32 i;
+
+    if (cache->cnt < SD10G65_CALC_CACHE_SIZE) {
+        i = cache->cnt++;
+    } else {
+        i = cache->next;
+        cache->next = (cache->next + 1) % SD10G65_CALC_CACHE_SIZE;
+    }
+    memcpy(cache->key + i * cache->key_size, key, cache->key_size);
+    memcpy(cache->rslt + i * cache->rslt_size, rslt, cache->rslt_size);
+}
+
+/* Returns TRUE and copies the cached result to rslt on a hit */
+static BOOL sd10g65_calc_cache_get(sd10g65_calc_cache_t *const cache, const void *const key, void *const rslt)
+{
+    int i = sd10g65_calc_cache_lookup(cache, key);
+
+    if (i < 0) {
+        cache->misses++;
+        return FALSE;
+    }
+    cache->hits++;
+    memcpy(rslt, cache->rslt + i * cache->rslt_size, cache->rslt_size);
+    return TRUE;
+}
+
+#if VTSS_OPT_PHY_SD10G65_CALC_CACHE_CHECK
+/* Self-check: compare a cache hit against the freshly calculated result */
+static void sd10g65_calc_cache_check(sd10g65_calc_cache_t *const cache, const void *const cached, const void *const fresh)
+{
+    if (memcmp(cached, fresh, cache->rslt_size) != 0) {
+        cache->check_errors++;
+        VTSS_E("sd10g65 %s setup cache entry differs from calculated result", cache->name);
+    }
+}
+#endif /* VTSS_OPT_PHY_SD10G65_CALC_CACHE_CHECK */
+
+#define SD10G65_CALC_CACHED(_n, _key, _rslt_t, _config, _ret_val)                          \
+    do {                                                                                   \
+        _rslt_t rslt;                                                                      \
+        vtss_rc rc;                                                                        \
+        memset(&rslt, 0, sizeof(rslt));                                                    \
+        if (sd10g65_calc_cache_get(&sd10g65_##_n##_cache, _key, _ret_val)) {               \
+            SD10G65_CALC_CACHE_CHECK(_n, _config, _ret_val);                               \
+            return VTSS_RC_OK;                                                             \
+        }                                                                                  \
+        if ((rc = sd10g65_setup_##_n##_calc(_config, &rslt)) == VTSS_RC_OK) {              \
+            sd10g65_calc_cache_store(&sd10g65_##_n##_cache, _key, &rslt);                  \
+        }                                                                                  \
+        *(_ret_val) = rslt;                                                                \
+        return rc;                                                                         \
+    } while (0)
+
+#if VTSS_OPT_PHY_SD10G65_CALC_CACHE_CHECK
+#define SD10G65_CALC_CACHE_CHECK(_n, _config, _ret_val)                                    \
+    if (sd10g65_setup_##_n##_calc(_config, &rslt) == VTSS_RC_OK) {                         \
+        sd10g65_calc_cache_check(&sd10g65_##_n##_cache, _ret_val, &rslt);                  \
+        *(_ret_val) = rslt;                                                                \
+    }
+#else
+#define SD10G65_CALC_CACHE_CHECK(_n, _config, _ret_val)
+#endif /* VTSS_OPT_PHY_SD10G65_CALC_CACHE_CHECK */
+
+static void sd10g65_f_pll_key(const vtss_sd10g65_f_pll_t *const in, vtss_sd10g65_f_pll_t *const key)
+{
+    key->f_pll_khz = in->f_pll_khz;
+    key->ratio_num = in->ratio_num;
+    key->ratio_den = in->ratio_den;
+}
+
+vtss_rc vtss_calc_sd10g65_setup_tx(const vtss_sd10g65_setup_tx_args_t config,
+                                   vtss_sd10g65_setup_tx_struct_t     *const ret_val) {
+    vtss_sd10g65_setup_tx_args_t key;
+
+    memset(&key, 0, sizeof(key));
+    key.chip_name = config.chip_name;
+    sd10g65_f_pll_key(&config.f_pll, &key.f_pll);
+    key.f_mode = config.f_mode;
+    key.if_width = config.if_width;
+    key.no_pwrcycle = config.no_pwrcycle;
+    key.ls_ena = config.ls_ena;
+    key.i2_fsel = config.i2_fsel;
+    key.inp_loop = config.inp_loop;
+    key.pad_loop = config.pad_loop;
+    key.invert = config.invert;
+    key.incr_levn = config.incr_levn;
+    key.ob_levn = config.ob_levn;
+    key.mute = config.mute;
+    SD10G65_CALC_CACHED(tx, &key, vtss_sd10g65_setup_tx_struct_t, config, ret_val);
+}
+
+vtss_rc vtss_calc_sd10g65_setup_rx(const vtss_sd10g65_setup_rx_args_t config,
+                                   vtss_sd10g65_setup_rx_struct_t     *const ret_val) {
+    vtss_sd10g65_setup_rx_args_t key;
+
+    memset(&key, 0, sizeof(key));
+    key.chip_name = config.chip_name;
+    sd10g65_f_pll_key(&config.f_pll, &key.f_pll);
+    key.f_mode = config.f_mode;
+    key.if_width = config.if_width;
+    key.preset = config.preset;
+    key.no_pwrcycle = config.no_pwrcycle;
+    key.fpwr_mode = config.fpwr_mode;
+    key.skip_cal = config.skip_cal;
+    key.i1_fsel = config.i1_fsel;
+    key.i1_lim = config.i1_lim;
+    key.i2_fsel = config.i2_fsel;
+    key.p_step = config.p_step;
+    key.i1_step = config.i1_step;
+    key.i2_step = config.i2_step;
+    key.i2_step_val = config.i2_step_val;
+    key.fb_step = config.fb_step;
+    key.fb_step_val = config.fb_step_val;
+    key.inp_loop = config.inp_loop;
+    key.pad_loop = config.pad_loop;
+    key.cmos_loop = config.cmos_loop;
+    key.lock2ref = config.lock2ref;
+    key.invert = config.invert;
+    SD10G65_CALC_CACHED(rx, &key, vtss_sd10g65_setup_rx_struct_t, config, ret_val);
+}
+
+vtss_rc vtss_calc_sd10g65_setup_f2df(const vtss_sd10g65_setup_f2df_args_t config,
+                                     vtss_sd10g65_setup_f2df_struct_t     *const ret_val) {
+    vtss_sd10g65_setup_f2df_args_t key;
+
+    memset(&key, 0, sizeof(key));
+    key.chip_name = config.chip_name;
+    sd10g65_f_pll_key(&config.f_in, &key.f_in);
+    key.no_pwrcycle = config.no_pwrcycle;
+    key.i1_fsel = config.i1_fsel;
+    key.i1_lim = config.i1_lim;
+    key.i2_fsel = config.i2_fsel;
+    key.inp_loop = config.inp_loop;
+    key.pad_loop = config.pad_loop;
+    key.cmos_loop = config.cmos_loop;
+    key.invert = config.invert;
+    SD10G65_CALC_CACHED(f2df, &key, vtss_sd10g65_setup_f2df_struct_t, config, ret_val);
+}
+
+vtss_rc vtss_calc_sd10g65_setup_df2f(const vtss_sd10g65_setup_df2f_args_t config,
+                                     vtss_sd10g65_setup_df2f_struct_t     *const ret_val) {
+    vtss_sd10g65_setup_df2f_args_t key;
+
+    memset(&key, 0, sizeof(key));
+    key.chip_name = config.chip_name;
+    sd10g65_f_pll_key(&config.f_out, &key.f_out);
+    key.use_par_clk = config.use_par_clk;
+    key.no_pwrcycle = config.no_pwrcycle;
+    key.ls_ena = config.ls_ena;
+    key.i2_fsel = config.i2_fsel;
+    key.inp_loop = config.inp_loop;
+    key.pad_loop = config.pad_loop;
+    key.incr_levn = config.incr_levn;
+    key.ob_levn = config.ob_levn;
+    SD10G65_CALC_CACHED(df2f, &key, vtss_sd10g65_setup_df2f_struct_t, config, ret_val);
+}
+
+void vtss_sd10g65_calc_cache_print(const vtss_debug_printf_t pr)
+{
+    const sd10g65_calc_cache_t *cache;
+    u32 i;
+
+    pr("%-8s %-8s %-10s %-10s %-10s\n", "Setup", "Entries", "Hits", "Misses", "Check err");
+    for (i = 0; i < sizeof(sd10g65_calc_caches) / sizeof(sd10g65_calc_caches[0]); i++) {
+        cache = sd10g65_calc_caches[i];
+        pr("%-8s %-8u %-10u %-10u %-10u\n", cache->name, cache->cnt, cache->hits, cache->misses, cache->check_errors);
+    }
+}
+
+#else
+vtss_rc vtss_calc_sd10g65_setup_tx(const vtss_sd10g65_setup_tx_args_t config,
+                                   vtss_sd10g65_setup_tx_struct_t     *const ret_val) {
+    return sd10g65_setup_tx_calc(config, ret_val);
+}
+
+vtss_rc vtss_calc_sd10g65_setup_rx(const vtss_sd10g65_setup_rx_args_t config,
+                                   vtss_sd10g65_setup_rx_struct_t     *const ret_val) {
+    return sd10g65_setup_rx_calc(config, ret_val);
+}
+
+vtss_rc vtss_calc_sd10g65_setup_f2df(const vtss_sd10g65_setup_f2df_args_t config,
+                                     vtss_sd10g65_setup_f2df_struct_t     *const ret_val) {
+    return sd10g65_setup_f2df_calc(config, ret_val);
+}
+
+vtss_rc vtss_calc_sd10g65_setup_df2f(const vtss_sd10g65_setup_df2f_args_t config,
+                                     vtss_sd10g65_setup_df2f_struct_t     *const ret_val) {
+    return sd10g65_setup_df2f_calc(config, ret_val);
+}
+#endif /* VTSS_OPT_PHY_SD10G65_CALC_CACHE */
+
 /* ******************************************************************************** */
 /* ***                        E N D   O F    F I L E                            *** */
 /* ******************************************************************************** */
@@ -807,4 +807,9 @@ vtss_rc vtss_calc_sd10g65_setup_f2df(const vtss_sd10g65_setup_f2df_args_t config
 vtss_rc vtss_calc_sd10g65_setup_df2f(const vtss_sd10g65_setup_df2f_args_t config,
                                      vtss_sd10g65_setup_df2f_struct_t    *const ret_val);
 
+#if VTSS_OPT_PHY_SD10G65_CALC_CACHE
+/* Print hit/miss counters of the setup calculation cache */
+void vtss_sd10g65_calc_cache_print(const vtss_debug_printf_t pr);
+#endif
+
 #endif
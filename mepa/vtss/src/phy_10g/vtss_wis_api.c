@@ -622,4 +622,57 @@ vtss_rc vtss_ewis_counter_threshold_get(const vtss_inst_t inst,
     VTSS_EXIT();
     return rc;
 }
+
+/* ================================================================= *
+ *  Performance Monitoring
+ * ================================================================= */
+
+vtss_rc vtss_ewis_pm_enable_set(const vtss_inst_t inst,
+                                const vtss_port_no_t port_no,
+                                const BOOL enable)
+{
+    vtss_state_t *vtss_state;
+    vtss_rc      rc;
+
+    VTSS_D("port_no: %u, enable: %u", port_no, enable);
+    VTSS_ENTER();
+    if ((rc = vtss_inst_port_no_check(inst, &vtss_state, port_no)) == VTSS_RC_OK) {
+        memset(&vtss_state->ewis_pm[port_no], 0, sizeof(vtss_state->ewis_pm[port_no]));
+        vtss_state->ewis_pm[port_no].pm.enable = enable;
+    }
+    VTSS_EXIT();
+    return rc;
+}
+
+vtss_rc vtss_ewis_pm_tick(const vtss_inst_t inst,
+                          const vtss_port_no_t port_no)
+{
+    vtss_state_t *vtss_state;
+    vtss_rc      rc;
+
+    VTSS_N("port_no: %u", port_no);
+    VTSS_ENTER();
+    if ((rc = vtss_inst_port_no_check(inst, &vtss_state, port_no)) == VTSS_RC_OK) {
+        rc = VTSS_FUNC_COLD(cil.ewis_pm_tick, port_no);
+    }
+    VTSS_EXIT();
+    return rc;
+}
+
+vtss_rc vtss_ewis_pm_get(const vtss_inst_t inst,
+                         const vtss_port_no_t port_no,
+                         vtss_ewis_pm_t *const pm)
+{
+    vtss_state_t *vtss_state;
+    vtss_rc      rc;
+
+    VTSS_D("port_no: %u", port_no);
+    VTSS_PHY_EWIS_ASSERT(pm == NULL);
+    VTSS_ENTER();
+    if ((rc = vtss_inst_port_no_check(inst, &vtss_state, port_no)) == VTSS_RC_OK) {
+        *pm = vtss_state->ewis_pm[port_no].pm;
+    }
+    VTSS_EXIT();
+    return rc;
+}
 #endif /*VTSS_FEATURE_WIS */
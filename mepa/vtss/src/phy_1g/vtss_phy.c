@@ -39,6 +39,7 @@ extern vtss_rc get_base_adr(vtss_state_t *vtss_state, vtss_port_no_t port_no, u3
 // Because the PHYs operates with paged registers, we have sometimes expired that the registers are accessed to wrong pages due to code bugs.
 // These bugs can be hard to find therefore definitions of registers are including the page they belong to. By setting the do_page_chk variable the page register is checked whenever a register is accessed, and giving an error message if there is an unexpected page access.
 // For this to work the register definitions must be used, and therefor all new updates to the phy api should use these register definition and the corresponding rd_page and wr_page functions and macros.
+// The page check also verifies the page register mirror (page_cur), which is used to skip writes to the page register when the page doesn't change.
 #ifdef VTSS_SW_OPTION_DEBUG
 static BOOL do_page_chk = TRUE;
 #else
@@ -419,6 +420,37 @@ static vtss_rc vtss_phy_i2c_rd_private(vtss_state_t *vtss_state, vtss_port_no_t
 }
 
 
+// Forget what is known about the page register of a port. Must be called whenever register 31 may have been changed
+// without going through vtss_phy_rd_wr_masked (raw MIIM access, reset, warm start).
+void vtss_phy_page_invalidate(vtss_state_t *vtss_state, vtss_port_no_t port_no)
+{
+    vtss_state->phy_state[port_no].page_valid = FALSE;
+}
+
+// Make the next status read a full read. Must be called when the PHY is reset or reconfigured.
+void vtss_phy_status_fast_invalidate(vtss_state_t *vtss_state, vtss_port_no_t port_no)
+{
+    vtss_state->phy_state[port_no].status_fast = FALSE;
+}
+
+// Select a page in the chip unless the page register already holds it
+static vtss_rc vtss_phy_page_hw_set(vtss_state_t *vtss_state, const vtss_port_no_t port_no, const u16 page)
+{
+    vtss_phy_port_state_t *ps = &vtss_state->phy_state[port_no];
+
+    if (ps->page_valid && ps->page_cur == page) {
+        return VTSS_RC_OK;
+    }
+    ps->page_valid = FALSE;
+    if (ps->bcast) {
+        ps->bcast_page_wr = TRUE;
+    }
+    VTSS_RC(vtss_state->init_conf.miim_write(vtss_state, port_no, 31, page));
+    ps->page_cur = page;
+    ps->page_valid = TRUE;
+    return VTSS_RC_OK;
+}
+
 static vtss_rc vtss_phy_rd_wr_masked(vtss_state_t         *vtss_state,
                                      BOOL                 read,
                                      const vtss_port_no_t port_no,
@@ -426,10 +458,11 @@ static vtss_rc vtss_phy_rd_wr_masked(vtss_state_t         *vtss_state,
                                      u16                  *const value,
                                      const u16            mask)
 {
-    vtss_rc           rc = VTSS_RC_OK;
-    vtss_miim_read_t  read_func;
-    vtss_miim_write_t write_func;
-    u16               reg, page, val;
+    vtss_rc               rc = VTSS_RC_OK;
+    vtss_miim_read_t      read_func;
+    vtss_miim_write_t     write_func;
+    vtss_phy_port_state_t *ps = &vtss_state->phy_state[port_no];
+    u16                   reg, page, val;
 
     /* Setup read/write function pointers */
     read_func = vtss_state->init_conf.miim_read;
@@ -443,10 +476,24 @@ static vtss_rc vtss_phy_rd_wr_masked(vtss_state_t         *vtss_state,
     page = (addr >> 5);
     reg = (addr & 0x1f);
 
-    /* Change page */
+    /* Change page. The page of a page-encoded access is left selected, so a run of accesses to the
+       same page only selects it once. The standard page is selected again by the first access that
+       is not page-encoded, unless the caller has selected a page itself in between. */
     if (page) {
-        rc = write_func(vtss_state, port_no, 31, page);
+        if ((rc = vtss_phy_page_hw_set(vtss_state, port_no, page)) == VTSS_RC_OK) {
+            ps->page_restore = TRUE;
+        }
+    } else if (reg == 31 && !read && mask == 0xffff) {
+        /* Page select - only written if the page changes */
+        VTSS_N("Page - port:%d, page:0x%X, cur_page:0x%X, valid:%d", port_no, *value, ps->page_cur, ps->page_valid);
+        ps->page_restore = FALSE;
+        return vtss_phy_page_hw_set(vtss_state, port_no, *value);
+    } else if (ps->page_restore) {
+        if ((rc = vtss_phy_page_hw_set(vtss_state, port_no, VTSS_PHY_PAGE_STANDARD)) == VTSS_RC_OK) {
+            ps->page_restore = FALSE;
+        }
     }
+
     if (rc == VTSS_RC_OK) {
         if (read) {
             /* Read */
@@ -468,9 +515,13 @@ static vtss_rc vtss_phy_rd_wr_masked(vtss_state_t         *vtss_state,
         }
     }
 
-    /* Restore standard page */
-    if (page && rc == VTSS_RC_OK) {
-        rc = write_func(vtss_state, port_no, 31, VTSS_PHY_PAGE_STANDARD);
+    if (rc != VTSS_RC_OK || (!page && reg == 31 && !read)) {
+        /* Page register state unknown */
+        vtss_phy_page_invalidate(vtss_state, port_no);
+        if (rc == VTSS_RC_OK) {
+            /* The caller has selected the page itself */
+            ps->page_restore = FALSE;
+        }
     }
 
     return rc;
@@ -485,6 +536,41 @@ vtss_rc vtss_phy_rd(vtss_state_t         *vtss_state,
     return vtss_phy_rd_wr_masked(vtss_state, 1, port_no, addr, value, 0);
 }
 
+// Enable or disable SMI broadcast writes (register 22 bit 0). While enabled, every write done through port_no is
+// also done in the other ports of the chip, so a sequence that is identical for all ports only has to be run once.
+// Reads and the read part of masked writes are still done in port_no only.
+vtss_rc vtss_phy_bcast_set(vtss_state_t *vtss_state, vtss_port_no_t port_no, BOOL enable)
+{
+    vtss_phy_port_state_t *ps = &vtss_state->phy_state[port_no];
+    vtss_phy_port_state_t *px;
+    vtss_port_no_t        port_x;
+    BOOL                  chip_known = vtss_state->phy_inst_state.base_ports_found;
+
+    VTSS_RC(vtss_phy_page_std(vtss_state, port_no));
+    VTSS_RC(vtss_phy_wr_masked(vtss_state, port_no, 22, enable ? 0x0001 : 0x0000, 0x0001));
+    if (enable) {
+        ps->bcast = TRUE;
+        ps->bcast_page_wr = FALSE;
+        return VTSS_RC_OK;
+    }
+
+    ps->bcast = FALSE;
+    if (ps->bcast_page_wr) {
+        // The page selects were also done in the other ports of the chip. Before the base ports are
+        // detected, the ports of the chip are unknown, so the page of all other ports is forgotten.
+        for (port_x = 0; port_x < vtss_state->port_count; port_x++) {
+            px = &vtss_state->phy_state[port_x];
+            if (port_x == port_no || (chip_known && px->type.base_port_no != ps->type.base_port_no)) {
+                continue;
+            }
+            px->page_cur = ps->page_cur;
+            px->page_valid = (chip_known && ps->page_valid);
+            px->page_restore = ps->page_restore;
+        }
+    }
+    return VTSS_RC_OK;
+}
+
 
 
 // For debugging - See comment at the do_page_chk
@@ -526,6 +612,10 @@ static vtss_rc  vtss_phy_do_page_chk(vtss_state_t         *vtss_state,
     default:
         // Do the page check
         VTSS_RC(vtss_phy_rd(vtss_state, port_no, 31, &current_page));
+        if (ps->page_valid && current_page != ps->page_cur) {
+            VTSS_E("Page tracking out of sync - Current_Page:0x%X, tracked page:0x%X, line:%d, port:%d", current_page, ps->page_cur, line, port_no);
+            vtss_phy_page_invalidate(vtss_state, port_no);
+        }
         if (current_page != page) {
             VTSS_E("Unexpected page - Current_Page:0x%X, expected page:0x%X, line:%d, port:%d, family:%d", current_page, page, line, port_no, ps->family);
 
@@ -974,6 +1064,9 @@ static vtss_rc vtss_phy_soft_reset_port(vtss_state_t *vtss_state, vtss_port_no_t
                                        VTSS_F_PHY_MODE_CONTROL_SW_RESET)); // Reset phy port
             break;
         }
+        vtss_phy_page_invalidate(vtss_state, port_no);
+        vtss_phy_status_fast_invalidate(vtss_state, port_no);
+        vtss_state->phy_state[port_no].stat_valid = FALSE; // The reset clears the counters
 
         MEPA_MSLEEP(1);/* pause after reset */
         MEPA_MTIMER_START(&timer, 5000); /* Wait up to 5 seconds */
@@ -7794,10 +7887,10 @@ static vtss_rc vtss_phy_detect_base_ports_private(vtss_state_t *vtss_state)
         if (port_skip[port_x]) {
             continue;
         }
-        VTSS_RC(vtss_phy_wr_masked(vtss_state, port_x, 22, 0x0001, 0x0001));  /* Broadcast Write */
+        VTSS_RC(vtss_phy_bcast_set(vtss_state, port_x, TRUE));  /* Broadcast Write */
         VTSS_RC(vtss_phy_gp_reg_wr(vtss_state, port_x, 0x0100 + port_x));
         VTSS_N("vtss_phy_detect_base_ports_private: port_x: %d Broadcast Write to 30E1: %x ", port_x, 0x0100 + port_x);
-        VTSS_RC(vtss_phy_wr_masked(vtss_state, port_x, 22, 0x0000, 0x0001));
+        VTSS_RC(vtss_phy_bcast_set(vtss_state, port_x, FALSE));
     }
 
     /* Find base port for each PHY */
@@ -8029,7 +8122,7 @@ static vtss_rc vtss_phy_init_seq_enzo(vtss_state_t *vtss_state,
     if ((reg & (0x3 << 11)) == 0) {
         /* Enable Broad-cast writes for this device */
         VTSS_RC(vtss_phy_page_std(vtss_state, port_no));
-        VTSS_RC(PHY_WR_MASKED_PAGE(vtss_state, port_no, VTSS_PHY_EXTENDED_CONTROL_AND_STATUS, 0x0001, 0x0001));
+        VTSS_RC(vtss_phy_bcast_set(vtss_state, port_no, TRUE));
 
         if (ps->type.revision == 0) {    /*- Rev A */
             /* BZ 2637 */
@@ -8147,7 +8240,7 @@ static vtss_rc vtss_phy_init_seq_enzo(vtss_state_t *vtss_state,
 
         /* Turn-off broad-cast writes for this device */
         VTSS_RC(vtss_phy_page_std(vtss_state, port_no));
-        VTSS_RC(PHY_WR_MASKED_PAGE(vtss_state, port_no, VTSS_PHY_EXTENDED_CONTROL_AND_STATUS, 0x0000, 0x0001));
+        VTSS_RC(vtss_phy_bcast_set(vtss_state, port_no, FALSE));
     }   /* ps->map.addr % 4) == 0 */
 
     if ((!ps->reset.i_cpu_en) && (port_no % 4 == 0)) {
@@ -8601,6 +8694,7 @@ static vtss_rc vtss_phy_conf_set_private(vtss_state_t *vtss_state,
     VTSS_D("enter, port_no: %u", port_no);
     family = ps->family;
     revision = ps->type.revision;
+    vtss_phy_status_fast_invalidate(vtss_state, port_no);
 
         /*- This is for a Luton26 Switch */
         /*- By defining VTSS_PHY_OPT_CAP_FE_ONLY, Downgrade PHY Advertised Capability, Over-ride Config */
@@ -9561,6 +9655,60 @@ vtss_rc vtss_phy_1588_csr_rd_private(vtss_state_t         *vtss_state,
 }
 
 
+// Select the MACsec page, wait for the previous command and setup the target of a MACsec CSR access.
+// Within a batch the wait and the target setup are skipped when they are known to be redundant.
+static vtss_rc vtss_phy_macsec_csr_setup(vtss_state_t *vtss_state, const vtss_port_no_t port_no, const u16 target)
+{
+    vtss_phy_port_state_t *ps = &vtss_state->phy_state[port_no];
+
+    VTSS_RC(vtss_phy_page_macsec(vtss_state, port_no));
+
+    // Wait for any previous Cmd to complete
+    if (!ps->macsec_csr_batch || !ps->macsec_csr_idle) {
+        VTSS_RC(vtss_phy_wait_for_macsec_command_busy(vtss_state, port_no, 19)); // Wait for MACSEC register access
+    }
+    ps->macsec_csr_idle = FALSE;
+
+    // Setup the Target Id
+    if (!ps->macsec_csr_batch || ps->macsec_csr_tgt != (target >> 2)) {
+        ps->macsec_csr_tgt = 0xffff;
+        VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_MACSEC_20, VTSS_PHY_F_PAGE_MACSEC_20_TARGET((target >> 2))));
+        ps->macsec_csr_tgt = (target >> 2);
+    }
+    return VTSS_RC_OK;
+}
+
+// Complete a MACsec CSR access. The command has completed, so outside a batch the standard page is restored.
+static vtss_rc vtss_phy_macsec_csr_done(vtss_state_t *vtss_state, const vtss_port_no_t port_no)
+{
+    vtss_phy_port_state_t *ps = &vtss_state->phy_state[port_no];
+
+    if (ps->macsec_csr_batch) {
+        ps->macsec_csr_idle = TRUE;
+        return VTSS_RC_OK;
+    }
+    return vtss_phy_page_std(vtss_state, port_no);
+}
+
+// See vtss_phy.h
+vtss_rc vtss_phy_macsec_csr_batch_set(vtss_state_t         *vtss_state,
+                                      const vtss_port_no_t port_no,
+                                      const BOOL           enable)
+{
+    vtss_phy_port_state_t *ps = &vtss_state->phy_state[port_no];
+
+    if (ps->macsec_csr_batch == enable) {
+        return VTSS_RC_OK;
+    }
+    VTSS_D("port_no:%u, enable:%d", port_no, enable);
+    ps->macsec_csr_batch = enable;
+    ps->macsec_csr_idle = FALSE;
+    ps->macsec_csr_tgt = 0xffff;
+
+    // The page register is left at the MACsec page within a batch
+    return (enable ? VTSS_RC_OK : vtss_phy_page_std(vtss_state, port_no));
+}
+
 // See vtss_phy_csr_wr
 vtss_rc vtss_phy_macsec_csr_wr_private(vtss_state_t         *vtss_state,
                                        const vtss_port_no_t port_no,
@@ -9582,19 +9730,14 @@ vtss_rc vtss_phy_macsec_csr_wr_private(vtss_state_t         *vtss_state,
         return VTSS_RC_ERROR;
     }
 
-    VTSS_RC(vtss_phy_page_macsec(vtss_state, port_no));
-
-    // Wait for any previous Cmd to complete
-    VTSS_RC(vtss_phy_wait_for_macsec_command_busy(vtss_state, port_no, 19)); // Wait for MACSEC register access
-
     // The Sequence to Write to CSR's is as Follows:
     // Setup the Target Id
     // Write the Least Significant Word (LSW) (17)
     // Write the Most Significant Word (MSW) (18)
     // Trigger CSR Action - Write(16) into the CSR's and wait for complete
 
-    // Setup the Target Id
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_MACSEC_20, VTSS_PHY_F_PAGE_MACSEC_20_TARGET((target >> 2))));
+    // Wait for any previous Cmd to complete and setup the Target Id
+    VTSS_RC(vtss_phy_macsec_csr_setup(vtss_state, port_no, target));
 
     //    VTSS_RC(PHY_RD_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_MACSEC_20, &val));
     //    printf("reg20:%x\n",val);
@@ -9613,8 +9756,7 @@ vtss_rc vtss_phy_macsec_csr_wr_private(vtss_state_t         *vtss_state,
     // Wait for the Write to complete
     VTSS_RC(vtss_phy_wait_for_macsec_command_busy(vtss_state, port_no, 19)); // Wait for MACSEC register access
 
-    VTSS_RC(vtss_phy_page_std(vtss_state, port_no));
-    return VTSS_RC_OK;
+    return vtss_phy_macsec_csr_done(vtss_state, port_no);
 }
 
 // See vtss_phy_csr_rd
@@ -9633,19 +9775,14 @@ vtss_rc vtss_phy_macsec_csr_rd_private(vtss_state_t         *vtss_state,
         return VTSS_RC_ERR_MACSEC_PHY_NOT_MACSEC_CAPABLE;
     }
 
-    VTSS_RC(vtss_phy_page_macsec(vtss_state, port_no));
-
-    // Wait for any previous Cmd to complete
-    VTSS_RC(vtss_phy_wait_for_macsec_command_busy(vtss_state, port_no, 19)); // Wait for MACSEC register access
-
     // The Sequence to Read from the CSR's is as Follows:
     // Setup the Target Id
     // Trigger CSR Action - Read(16) into the CSR's and wait for complete
     // Read the Least Significant Word (LSW) (17)
     // Read the Most Significant Word (MSW) (18)
 
-    // Setup the Target Id
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_MACSEC_20, VTSS_PHY_F_PAGE_MACSEC_20_TARGET((target >> 2))));
+    // Wait for any previous Cmd to complete and setup the Target Id
+    VTSS_RC(vtss_phy_macsec_csr_setup(vtss_state, port_no, target));
 
     if (target >> 2 == 1) {
         target_tmp = target & 3; // non-macsec access
@@ -9663,7 +9800,7 @@ vtss_rc vtss_phy_macsec_csr_rd_private(vtss_state_t         *vtss_state,
     // Read the Most Significant Word (MSW) (18)
     VTSS_RC(PHY_RD_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_MACSEC_CSR_DATA_MSB, &reg_value_upper));
 
-    VTSS_RC(vtss_phy_page_std(vtss_state, port_no));
+    VTSS_RC(vtss_phy_macsec_csr_done(vtss_state, port_no));
     *value = (reg_value_upper << 16) | reg_value_lower;
     return VTSS_RC_OK;
 }
@@ -9688,11 +9825,6 @@ vtss_rc vtss_phy_macsec_csr_rd_64_private(vtss_state_t         *vtss_state,
         return VTSS_RC_ERR_MACSEC_PHY_NOT_MACSEC_CAPABLE;
     }
 
-    VTSS_RC(vtss_phy_page_macsec(vtss_state, port_no));
-
-    // Wait for any previous Cmd to complete
-    VTSS_RC(vtss_phy_wait_for_macsec_command_busy(vtss_state, port_no, 19)); // Wait for MACSEC register access
-
     // 64bit Access requires 4 x 16bit register accesses
     // The Sequence to Read from the CSR's is as Follows:
     // Setup the Target Id
@@ -9700,8 +9832,8 @@ vtss_rc vtss_phy_macsec_csr_rd_64_private(vtss_state_t         *vtss_state,
     // Read the Least Significant Word (LSW) (17)
     // Read the Most Significant Word (MSW) (18)
 
-    // Setup the Target Id
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_MACSEC_20, VTSS_PHY_F_PAGE_MACSEC_20_TARGET((target >> 2))));
+    // Wait for any previous Cmd to complete and setup the Target Id
+    VTSS_RC(vtss_phy_macsec_csr_setup(vtss_state, port_no, target));
 
     if (target >> 2 == 1) {
         target_tmp = target & 3; // non-macsec access
@@ -9730,7 +9862,7 @@ vtss_rc vtss_phy_macsec_csr_rd_64_private(vtss_state_t         *vtss_state,
     // Read the Most Significant Word (MSW) (18)
     VTSS_RC(PHY_RD_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_MACSEC_CSR_DATA_MSB, &reg_value_upper_1));
 
-    VTSS_RC(vtss_phy_page_std(vtss_state, port_no));
+    VTSS_RC(vtss_phy_macsec_csr_done(vtss_state, port_no));
 
     VTSS_D("Port:%d, Read Value: 0x%04X %04X %04X %04X", port_no, reg_value_upper_1, reg_value_lower_1, reg_value_upper, reg_value_lower);
     value_64 = (0x000000000000FFFF & ((u64)reg_value_lower));
@@ -9829,6 +9961,80 @@ void vtss_phy_reg_decode_status(vtss_port_no_t port_no, u16 lp_auto_neg_advertis
     // Link up/down
     vtss_phy_decode_status_reg(port_no, mii_status_reg, status);
 }
+
+// Status read for a port with link up, where the aneg and link partner result is known from the last full read.
+// Only the latched link status (including the SerDes link status where the full read uses it) and the auxiliary
+// control and status register are read. *done is FALSE when a full read is needed, i.e. on a link transition or latched
+// link down event, if speed/duplex has changed, or when the refresh interval has expired.
+static vtss_rc vtss_phy_status_fast_get(vtss_state_t         *vtss_state,
+                                        const vtss_port_no_t port_no,
+                                        vtss_port_status_t   *const status,
+                                        BOOL                 *const done)
+{
+    vtss_phy_port_state_t *ps = &vtss_state->phy_state[port_no];
+    vtss_phy_reset_conf_t *conf = &ps->reset;
+    vtss_port_speed_t     speed;
+    u16                   reg, reg17, reg24, aux;
+    BOOL                  link;
+
+    *done = FALSE;
+    if (!ps->status_fast || ps->status_refresh == 0 || ps->link_down_due_to_port_reset || vtss_state->warm_start_cur ||
+        ((u32)MEPA_UPTIME_SECONDS() - ps->status_full_time) >= ps->status_refresh) {
+        return VTSS_RC_OK;
+    }
+
+    VTSS_RC(vtss_phy_page_std(vtss_state, port_no));
+    VTSS_RC(PHY_RD_PAGE(vtss_state, port_no, VTSS_PHY_MODE_STATUS, &reg));
+    link = (reg & (1 << 2) ? TRUE : FALSE);
+    if (((ps->family == VTSS_PHY_FAMILY_VIPER) || (ps->family == VTSS_PHY_FAMILY_TESLA)) &&
+        ((conf->mac_if == VTSS_PORT_INTERFACE_QSGMII) || (conf->mac_if == VTSS_PORT_INTERFACE_SGMII))) {
+        VTSS_RC(vtss_phy_page_ext3(vtss_state, port_no));
+        VTSS_RC(PHY_RD_PAGE(vtss_state, port_no, VTSS_PHY_MAC_SERDES_PCS_STATUS, &reg17));
+        VTSS_RC(PHY_RD_PAGE(vtss_state, port_no, VTSS_PHY_MEDIA_SERDES_PCS_STATUS, &reg24));
+        VTSS_RC(vtss_phy_page_std(vtss_state, port_no));
+        link = (((reg & (1 << 2)) | (reg24 & (1 << 2))) & (reg17 & (1 << 2)) ? TRUE : FALSE);
+    }
+    if (!link) {
+        // This read has cleared the latched link down, so pass it on to the full read
+        ps->status_link_down = TRUE;
+        return VTSS_RC_OK;
+    }
+    if (ps->setup.mode == VTSS_PHY_MODE_ANEG && (reg & (1 << 5)) == 0) {
+        return VTSS_RC_OK;
+    }
+
+    /* Speed/duplex from register 28, must be unchanged */
+    VTSS_RC(PHY_RD_PAGE(vtss_state, port_no, VTSS_PHY_AUXILIARY_CONTROL_AND_STATUS, &aux));
+    switch ((aux >> 3) & 0x3) {
+    case 0:
+        speed = VTSS_SPEED_10M;
+        break;
+    case 1:
+        speed = VTSS_SPEED_100M;
+        break;
+    case 2:
+        speed = VTSS_SPEED_1G;
+        break;
+    default:
+        speed = VTSS_SPEED_UNDEFINED;
+        break;
+    }
+    if (speed != ps->status.speed || (aux & (1 << 5) ? 1 : 0) != ps->status.fdx) {
+        VTSS_I("port_no:%u, speed/duplex changed without link down, aux:0x%X", port_no, aux);
+        return VTSS_RC_OK;
+    }
+
+    /* Everything else is unchanged since the last full read */
+    *status = ps->status;
+    vtss_phy_decode_status_reg(port_no, reg, status);
+    status->link_down = FALSE;
+    status->mdi_cross = ((aux & VTSS_F_PHY_AUXILIARY_CONTROL_AND_STATUS_HP_AUTO_MDIX_CROSSOVER_INDICATION) ? TRUE : FALSE);
+    ps->status = *status;
+    ps->status_fast_cnt++;
+    *done = TRUE;
+    return VTSS_RC_OK;
+}
+
 vtss_rc vtss_phy_status_get_private(vtss_state_t *vtss_state,
                                     const vtss_port_no_t port_no,
                                     vtss_port_status_t   *const status)
@@ -9837,8 +10043,15 @@ vtss_rc vtss_phy_status_get_private(vtss_state_t *vtss_state,
     u16                   reg, reg10, reg17, reg24;
     u16                   revision;
     vtss_phy_reset_conf_t *conf = &ps->reset;
+    BOOL                  done;
     revision = ps->type.revision;
 
+        VTSS_RC(vtss_phy_status_fast_get(vtss_state, port_no, status, &done));
+        if (done) {
+            return VTSS_RC_OK;
+        }
+        ps->status_fast = FALSE;
+
         VTSS_RC(vtss_phy_page_std(vtss_state, port_no));
         VTSS_N("vtss_phy_status_get_private, port_no: %u", port_no);
 
@@ -9863,6 +10076,12 @@ vtss_rc vtss_phy_status_get_private(vtss_state_t *vtss_state,
 	    }
         }
 
+        if (ps->status_link_down) {
+            /* Latched link down seen by the fast path */
+            status->link_down = TRUE;
+            ps->status_link_down = FALSE;
+        }
+
         VTSS_RC(vtss_phy_page_std(vtss_state, port_no));
 
         if (status->link_down) {
@@ -10374,6 +10593,12 @@ vtss_rc vtss_phy_status_get_private(vtss_state_t *vtss_state,
         VTSS_RC(vtss_phy_page_std(vtss_state, port_no));
         VTSS_N("port_no:%d, status->fiber:%d", port_no, status->fiber)
 
+        /* The next reads may use the fast path, if the result only depends on register 1 and 28 while link stays up */
+        ps->status_full_time = (u32)MEPA_UPTIME_SECONDS();
+        ps->status_fast = (status->link && !status->link_down && !status->fiber && ps->family != VTSS_PHY_FAMILY_NONE &&
+                           ps->family != VTSS_PHY_FAMILY_COBRA && ps->family != VTSS_PHY_FAMILY_ENZO &&
+                           (ps->setup.mode == VTSS_PHY_MODE_ANEG || ps->setup.mode == VTSS_PHY_MODE_FORCED));
+
 
     /* Save status */
     ps->status = *status;
@@ -11366,46 +11591,32 @@ static vtss_rc vtss_phy_read_temp_reg (vtss_state_t *vtss_state,
 }
 
 
-// Public API Function for getting chip temperature
-/* Note: Function to Initialize chip temperature sensor must be called at least once prior
- * \brief Function for getting Chip Temperature
- * \param vtss_state                   [IN]    Port Structure
- * \param port_no                      [IN]    The PHY Port No.
- * \param temp                         [OUT]   The chip temperature (from -46 to 135 degC)
- * \Return: VTSS_RC_OK if we got the temperature - else error code
- */
-vtss_rc vtss_phy_chip_temp_get_private (vtss_state_t   *vtss_state,
-                                        const vtss_port_no_t  port_no,
-                                        i16            *const temp)
+// Chip temperature sensor supported
+static BOOL vtss_phy_temp_supported(vtss_phy_port_state_t *ps)
 {
-    vtss_phy_port_state_t *ps = &vtss_state->phy_state[port_no];
-    vtss_rc                rc = VTSS_RC_OK;
-    u8                     temp_reading = 0;
-    u8                     tmon_adj_lo  = 0;
-    u8                     tmon_adj_hi  = 0;
-    u16                    reg = 0;
-    i16                    temperature;
-
-    /* Check to see if operation supported on this PHY */
     switch (ps->family) {
     case VTSS_PHY_FAMILY_ATOM:
     case VTSS_PHY_FAMILY_LUTON26:
     case VTSS_PHY_FAMILY_TESLA:
     case VTSS_PHY_FAMILY_VIPER:
     case VTSS_PHY_FAMILY_ELISE:
-        // Read the temperature.
-        VTSS_RC(vtss_phy_read_temp_reg(vtss_state, port_no, &temp_reading));
-
-        //135.3degC - 0.71degC*ADCOUT
-        temperature = (13530 - 71 * temp_reading) / 100;
-        *temp = temperature; // Temperature bits - See PHY Data sheet section 4.6.18
-        VTSS_N("Temperature = %d, temp_reading = 0x%X", *temp, temp_reading);
-        break;
-
     case VTSS_PHY_FAMILY_NANO:
-        // Read the temperature.
-        VTSS_RC(vtss_phy_read_temp_reg(vtss_state, port_no, &temp_reading));
+        return TRUE;
+    default:
+        return FALSE;
+    }
+}
+
+// Convert an unscaled temperature reading to degC
+static vtss_rc vtss_phy_temp_calc(vtss_state_t *vtss_state, const vtss_port_no_t port_no,
+                                  u8 temp_reading, i16 *const temp)
+{
+    vtss_phy_port_state_t *ps = &vtss_state->phy_state[port_no];
+    u8                     tmon_adj_lo  = 0;
+    u8                     tmon_adj_hi  = 0;
+    u16                    reg = 0;
 
+    if (ps->family == VTSS_PHY_FAMILY_NANO) {
         VTSS_RC(vtss_phy_page_gpio(vtss_state, port_no));
 
         // reg_value=1;  mask=0x0040;   26G.6=1
@@ -11417,19 +11628,123 @@ vtss_rc vtss_phy_chip_temp_get_private (vtss_state_t   *vtss_state,
         tmon_adj_hi = reg & 0xff; // Mask off to only get Upper TMON Bits (63:56)
 
         //135.3degC - 0.714degC*ADCOUT
-        temperature = vtss_phy_tmon_adjust_private ( temp_reading, tmon_adj_lo, tmon_adj_hi);
-        *temp = temperature; // Temperature bits - See PHY Data sheet section 4.6.18
+        *temp = vtss_phy_tmon_adjust_private ( temp_reading, tmon_adj_lo, tmon_adj_hi);
         VTSS_N("Temperature = %d, temp_reading = 0x%X, tmon_hi: 0x%X, tmon_lo: 0x%X ",
                *temp, temp_reading, tmon_adj_lo, tmon_adj_hi);
-        break;
-    default:
-        VTSS_E("Temperature reading not supported for family: %s, port_no:%d", vtss_phy_family2txt(ps->family), port_no);
-        rc = VTSS_RC_ERROR;
+    } else {
+        //135.3degC - 0.71degC*ADCOUT
+        *temp = (13530 - 71 * temp_reading) / 100; // Temperature bits - See PHY Data sheet section 4.6.18
+        VTSS_N("Temperature = %d, temp_reading = 0x%X", *temp, temp_reading);
+    }
+    return VTSS_RC_OK;
+}
+
+// Start a temperature conversion without waiting for it
+static vtss_rc vtss_phy_temp_start(vtss_state_t *vtss_state, const vtss_port_no_t port_no)
+{
+    VTSS_RC(vtss_phy_page_gpio(vtss_state, port_no));
+    VTSS_RC(PHY_WR_MASKED_PAGE(vtss_state, port_no, VTSS_PHY_TEMP_CONF, 0x0, 0x0040));
+    VTSS_RC(PHY_WR_MASKED_PAGE(vtss_state, port_no, VTSS_PHY_TEMP_CONF, 0x0040, 0x0040));
+    return vtss_phy_page_std(vtss_state, port_no);
+}
+
+// Collect the result of the conversion started by vtss_phy_temp_start()
+static vtss_rc vtss_phy_temp_collect(vtss_state_t *vtss_state, const vtss_port_no_t port_no,
+                                     u8 *const temp_reading, BOOL *const done)
+{
+    u16 reg = 0;
+
+    VTSS_RC(vtss_phy_page_gpio(vtss_state, port_no));
+    VTSS_RC(PHY_RD_PAGE(vtss_state, port_no, VTSS_PHY_TEMP_VAL, &reg));
+    // Only Nano signals a conversion in progress (28G.8)
+    *done = (vtss_state->phy_state[port_no].family != VTSS_PHY_FAMILY_NANO || (reg & 0x0100) == 0);
+    *temp_reading = reg & 0xFF;
+    return vtss_phy_page_std(vtss_state, port_no);
+}
+
+// Convert the temperature and wait for the result
+static vtss_rc vtss_phy_chip_temp_read_private(vtss_state_t *vtss_state, const vtss_port_no_t port_no,
+                                               i16 *const temp)
+{
+    u8      temp_reading = 0;
+    vtss_rc rc;
+
+    if ((rc = vtss_phy_read_temp_reg(vtss_state, port_no, &temp_reading)) == VTSS_RC_OK) {
+        rc = vtss_phy_temp_calc(vtss_state, port_no, temp_reading, temp);
     }
     VTSS_RC(vtss_phy_page_std(vtss_state, port_no));
     return rc;
 }
 
+// Public API Function for getting chip temperature
+/* Note: Function to Initialize chip temperature sensor must be called at least once prior
+ * \brief Function for getting Chip Temperature
+ * \param vtss_state                   [IN]    Port Structure
+ * \param port_no                      [IN]    The PHY Port No.
+ * \param temp                         [OUT]   The chip temperature (from -46 to 135 degC)
+ * \Return: VTSS_RC_OK if we got the temperature - else error code
+ *
+ * Unless the sampling period is zero, the temperature is kept per chip in the base port.
+ * A call collects the conversion started by the previous call and starts the next one,
+ * so it only waits for a conversion the first time.
+ */
+vtss_rc vtss_phy_chip_temp_get_private (vtss_state_t   *vtss_state,
+                                        const vtss_port_no_t  port_no,
+                                        i16            *const temp)
+{
+    vtss_phy_port_state_t *ps = &vtss_state->phy_state[port_no];
+    vtss_phy_port_state_t *bs = &vtss_state->phy_state[ps->type.base_port_no];
+    u32                    now = (u32)MEPA_UPTIME_SECONDS();
+    u8                     temp_reading = 0;
+    BOOL                   done = FALSE;
+
+    /* Check to see if operation supported on this PHY */
+    if (!vtss_phy_temp_supported(ps)) {
+        VTSS_E("Temperature reading not supported for family: %s, port_no:%d", vtss_phy_family2txt(ps->family), port_no);
+        VTSS_RC(vtss_phy_page_std(vtss_state, port_no));
+        return VTSS_RC_ERROR;
+    }
+
+    // Atom rev. A must suspend the 8051 patch around each conversion
+    if (bs->temp_period == 0 ||
+        ((ps->family == VTSS_PHY_FAMILY_ATOM || ps->family == VTSS_PHY_FAMILY_LUTON26) &&
+         ps->type.revision == VTSS_PHY_ATOM_REV_A)) {
+        return vtss_phy_chip_temp_read_private(vtss_state, port_no, temp);
+    }
+
+    if (bs->temp_valid && (now - bs->temp_time) < bs->temp_period) {
+        *temp = bs->temp;
+        return VTSS_RC_OK;
+    }
+
+    if (bs->temp_pending) {
+        VTSS_RC(vtss_phy_temp_collect(vtss_state, port_no, &temp_reading, &done));
+        if (done) {
+            VTSS_RC(vtss_phy_temp_calc(vtss_state, port_no, temp_reading, &bs->temp));
+            bs->temp_time = bs->temp_start;
+            bs->temp_valid = TRUE;
+            bs->temp_pending = FALSE;
+        }
+    }
+
+    if (!bs->temp_valid) {
+        // First read, wait for the conversion
+        VTSS_RC(vtss_phy_chip_temp_read_private(vtss_state, port_no, &bs->temp));
+        bs->temp_time = now;
+        bs->temp_valid = TRUE;
+        bs->temp_pending = FALSE;
+    }
+
+    if (!bs->temp_pending) {
+        VTSS_RC(vtss_phy_temp_start(vtss_state, port_no));
+        bs->temp_start = now;
+        bs->temp_pending = TRUE;
+    }
+
+    *temp = bs->temp;
+    return VTSS_RC_OK;
+}
+
 
 // Function for Initializing Chip Temperature sensor
 /* Note: This Function to Initialize chip temperature sensor must be called at least once prior to reading Temp
@@ -11441,10 +11756,15 @@ vtss_rc vtss_phy_chip_temp_get_private (vtss_state_t   *vtss_state,
 vtss_rc vtss_phy_chip_temp_init_private(vtss_state_t *vtss_state, const vtss_port_no_t  port_no)
 {
     vtss_phy_port_state_t *ps = &vtss_state->phy_state[port_no];
+    vtss_phy_port_state_t *bs = &vtss_state->phy_state[ps->type.base_port_no];
     vtss_rc rc = VTSS_RC_OK;
 
     VTSS_D("Init chip for port:%u", port_no);
 
+    // The sensor is reset, so drop any sample
+    bs->temp_valid = FALSE;
+    bs->temp_pending = FALSE;
+
     /* Check to see if operation supported on this PHY */
     switch (ps->family) {
     case VTSS_PHY_FAMILY_ATOM:
@@ -11488,6 +11808,8 @@ static vtss_rc vtss_phy_loopback_set_private(vtss_state_t *vtss_state,
     u8   phy_port_addr;
     u8   tmp_phy_port_addr;
     BOOL fiber = FALSE;
+
+    vtss_phy_status_fast_invalidate(vtss_state, port_no);
         // Get the PHY Physical Port
         phy_port_addr = vtss_phy_chip_port(vtss_state, port_no);
 
@@ -11742,57 +12064,133 @@ static vtss_rc vtss_phy_loopback_set_private(vtss_state_t *vtss_state,
 
 
 // Getting phy statistic
-static vtss_rc vtss_phy_statistic_get_private(vtss_state_t *vtss_state,
-                                              const vtss_port_no_t port_no, vtss_phy_statistic_t *statistic)
-{
-    u16 reg_val;
-
-
-    // Update CRC good count
-    VTSS_RC(vtss_phy_page_ext(vtss_state, port_no));
-    VTSS_RC(PHY_RD_PAGE(vtss_state, port_no, VTSS_PHY_CU_MEDIA_CRC_GOOD_COUNTER, &reg_val));
-    VTSS_D("reg_val:0x%X", reg_val);
-    if (reg_val & VTSS_F_PHY_CU_MEDIA_CRC_GOOD_COUNTER_PACKET_SINCE_LAST_READ) {
-        statistic->cu_good = reg_val & VTSS_M_PHY_CU_MEDIA_CRC_GOOD_COUNTER_CONTENTS;
-    } else {
-        statistic->cu_good = 0;
+/* Counter registers read by the statistics engine. The masks cover the full counter width */
+typedef struct {
+    u16 page;
+    u16 addr;
+    u16 mask;   /* Counter bits */
+    u16 flag;   /* Activity flag, the counter has not changed when clear. Zero if none */
+    u16 modulo; /* The counter wraps at this value. Zero if it saturates and clears when read */
+} vtss_phy_stat_reg_t;
+
+// The good packet counters wrap at 10000, which takes a few milliseconds at line rate, so their
+// 64 bit extension only holds while fewer than 10000 packets arrive per statistics period.
+// The clear-on-read error counters are exact until they saturate.
+
+static const vtss_phy_stat_reg_t vtss_phy_stat_reg_tbl[VTSS_PHY_STAT_CNT] = {
+    [VTSS_PHY_STAT_CU_GOOD] = {
+        VTSS_PHY_CU_MEDIA_CRC_GOOD_COUNTER, VTSS_PHY_ENCODE_BITMASK(0, 14),
+        VTSS_F_PHY_CU_MEDIA_CRC_GOOD_COUNTER_PACKET_SINCE_LAST_READ, 10000
+    },
+    [VTSS_PHY_STAT_CU_BAD] = {
+        VTSS_PHY_EXTENDED_PHY_CONTROL_4, VTSS_PHY_ENCODE_BITMASK(0, 8), 0, 0
+    },
+    [VTSS_PHY_STAT_SERDES_TX_GOOD] = {
+        VTSS_PHY_MEDIA_SERDES_TX_GOOD_PACKET_COUNTER, VTSS_PHY_ENCODE_BITMASK(0, 14),
+        VTSS_F_PHY_MEDIA_SERDES_TX_GOOD_PACKET_COUNTER_ACTIVE, 10000
+    },
+    [VTSS_PHY_STAT_SERDES_TX_BAD] = {
+        VTSS_PHY_MEDIA_SERDES_TX_CRC_ERROR_COUNTER, VTSS_PHY_ENCODE_BITMASK(0, 8), 0, 0
+    },
+    [VTSS_PHY_STAT_MEDIA_MAC_SERDES_GOOD] = {
+        VTSS_PHY_MEDIA_MAC_SERDES_RX_GOOD_COUNTER, VTSS_PHY_ENCODE_BITMASK(0, 14), 0, 10000
+    },
+    [VTSS_PHY_STAT_MEDIA_MAC_SERDES_CRC] = {
+        VTSS_PHY_MEDIA_MAC_SERDES_RX_CRC_CRC_ERR_COUNTER, VTSS_PHY_ENCODE_BITMASK(0, 8), 0, 0
+    },
+    [VTSS_PHY_STAT_RX_ERR_CNT_BASE_TX] = {
+        VTSS_PHY_ERROR_COUNTER_1, VTSS_PHY_ENCODE_BITMASK(0, 8), 0, 0
+    },
+};
+
+// Read the counter registers of a port, unless they were read less than a period ago, and
+// add the increments to the 64 bit counters. The table is sorted by page, so each page is
+// only selected once.
+static vtss_rc vtss_phy_stat_update(vtss_state_t *vtss_state, const vtss_port_no_t port_no)
+{
+    vtss_phy_port_state_t     *ps = &vtss_state->phy_state[port_no];
+    const vtss_phy_stat_reg_t *reg;
+    u32                       i, now = MEPA_UPTIME_SECONDS();
+    u16                       page = 0xffff, reg_val, cnt;
+
+    if (ps->stat_valid && ps->stat_period != 0 && (now - ps->stat_time) < ps->stat_period) {
+        return VTSS_RC_OK;
     }
 
-
-    // Update CRC bad count
-    VTSS_RC(PHY_RD_PAGE(vtss_state, port_no, VTSS_PHY_EXTENDED_PHY_CONTROL_4, &reg_val));
-    statistic->cu_bad = reg_val & VTSS_M_VTSS_PHY_EXTENDED_PHY_CONTROL_4_CU_MEDIA_CRC_ERROR_COUNTER;
-
-
-    // Update serdes good count
-    VTSS_RC(vtss_phy_page_ext3(vtss_state, port_no));
-    VTSS_RC(PHY_RD_PAGE(vtss_state, port_no, VTSS_PHY_MEDIA_SERDES_TX_GOOD_PACKET_COUNTER, &reg_val));
-    if (reg_val & VTSS_F_PHY_MEDIA_SERDES_TX_GOOD_PACKET_COUNTER_ACTIVE) {
-        statistic->serdes_tx_good = reg_val & VTSS_M_PHY_MEDIA_SERDES_TX_GOOD_PACKET_COUNTER_CNT;
-    } else {
-        statistic->serdes_tx_good = 0;
+    for (i = 0; i < VTSS_PHY_STAT_CNT; i++) {
+        reg = &vtss_phy_stat_reg_tbl[i];
+        if (reg->page != page) {
+            page = reg->page;
+            VTSS_RC(vtss_phy_wr(vtss_state, port_no, 31, page));
+        }
+        VTSS_RC(vtss_phy_rd(vtss_state, port_no, reg->addr, &reg_val));
+        cnt = (reg_val & reg->mask);
+        if (reg->modulo == 0) {
+            // Cleared by the read, so the value is the increment
+            ps->stat_total[i] += cnt;
+            ps->stat_last[i] = cnt;
+        } else if (reg->flag != 0 && !(reg_val & reg->flag)) {
+            ps->stat_last[i] = 0;
+        } else {
+            if (ps->stat_valid && cnt < reg->modulo) {
+                ps->stat_total[i] += (cnt >= ps->stat_raw[i] ? cnt - ps->stat_raw[i] : cnt + reg->modulo - ps->stat_raw[i]);
+            }
+            ps->stat_raw[i] = cnt;
+            ps->stat_last[i] = cnt;
+        }
     }
+    VTSS_RC(vtss_phy_page_std(vtss_state, port_no));
 
-    // Update serdes bad count
-    VTSS_RC(PHY_RD_PAGE(vtss_state, port_no, VTSS_PHY_MEDIA_SERDES_TX_CRC_ERROR_COUNTER, &reg_val));
-    statistic->serdes_tx_bad = reg_val & VTSS_M_PHY_MEDIA_SERDES_TX_CRC_ERROR_COUNTER_CNT;
-
+    ps->stat_valid = TRUE;
+    ps->stat_time = now;
+    return VTSS_RC_OK;
+}
 
-    // Update 100/1000BASE-TX media/mac serdes CRC error counter
-    VTSS_RC(PHY_RD_PAGE(vtss_state, port_no, VTSS_PHY_MEDIA_MAC_SERDES_RX_CRC_CRC_ERR_COUNTER, &reg_val));
-    statistic->media_mac_serdes_crc = reg_val & VTSS_M_PHY_MEDIA_MAC_SERDES_RX_CRC_ERR_COUNTER_CNT;
+// Add a counter register read outside vtss_phy_stat_update() to the 64 bit counters, so the
+// increments cleared by the read are not lost.
+static void vtss_phy_stat_fold(vtss_state_t *vtss_state, const vtss_port_no_t port_no,
+                               u16 page, u16 addr, u16 reg_val)
+{
+    const vtss_phy_stat_reg_t *reg;
+    u32                       i;
 
-    // Update 100/1000BASE-TX media/mac serdes counter
-    VTSS_RC(PHY_RD_PAGE(vtss_state, port_no, VTSS_PHY_MEDIA_MAC_SERDES_RX_GOOD_COUNTER, &reg_val));
-    statistic->media_mac_serdes_good = reg_val & VTSS_M_PHY_MEDIA_MAC_SERDES_RX_GOOD_COUNTER_CNT;
+    for (i = 0; i < VTSS_PHY_STAT_CNT; i++) {
+        reg = &vtss_phy_stat_reg_tbl[i];
+        if (reg->page == page && reg->addr == addr && reg->modulo == 0) {
+            vtss_state->phy_state[port_no].stat_total[i] += (reg_val & reg->mask);
+        }
+    }
+}
 
-    // Update 100/1000BASE-TX receive error counter
-    VTSS_RC(vtss_phy_page_std(vtss_state, port_no));
-    VTSS_RC(PHY_RD_PAGE(vtss_state, port_no, VTSS_PHY_ERROR_COUNTER_1, &reg_val));
-    statistic->rx_err_cnt_base_tx = reg_val & VTSS_M_PHY_ERROR_COUNTER_1_100_1000BASETX_RX_ERR_CNT;
+static vtss_rc vtss_phy_statistic_get_private(vtss_state_t *vtss_state,
+                                              const vtss_port_no_t port_no, vtss_phy_statistic_t *statistic)
+{
+    u16 *last = vtss_state->phy_state[port_no].stat_last;
 
+    VTSS_RC(vtss_phy_stat_update(vtss_state, port_no));
+    statistic->cu_good = last[VTSS_PHY_STAT_CU_GOOD];
+    statistic->cu_bad = last[VTSS_PHY_STAT_CU_BAD];
+    statistic->serdes_tx_good = last[VTSS_PHY_STAT_SERDES_TX_GOOD];
+    statistic->serdes_tx_bad = last[VTSS_PHY_STAT_SERDES_TX_BAD];
+    statistic->rx_err_cnt_base_tx = last[VTSS_PHY_STAT_RX_ERR_CNT_BASE_TX];
+    statistic->media_mac_serdes_good = last[VTSS_PHY_STAT_MEDIA_MAC_SERDES_GOOD];
+    statistic->media_mac_serdes_crc = last[VTSS_PHY_STAT_MEDIA_MAC_SERDES_CRC];
+    return VTSS_RC_OK;
+}
 
+static vtss_rc vtss_phy_statistic64_get_private(vtss_state_t *vtss_state,
+                                                const vtss_port_no_t port_no, vtss_phy_statistic64_t *const statistic)
+{
+    u64 *total = vtss_state->phy_state[port_no].stat_total;
 
+    VTSS_RC(vtss_phy_stat_update(vtss_state, port_no));
+    statistic->cu_good = total[VTSS_PHY_STAT_CU_GOOD];
+    statistic->cu_bad = total[VTSS_PHY_STAT_CU_BAD];
+    statistic->serdes_tx_good = total[VTSS_PHY_STAT_SERDES_TX_GOOD];
+    statistic->serdes_tx_bad = total[VTSS_PHY_STAT_SERDES_TX_BAD];
+    statistic->rx_err_cnt_base_tx = total[VTSS_PHY_STAT_RX_ERR_CNT_BASE_TX];
+    statistic->media_mac_serdes_good = total[VTSS_PHY_STAT_MEDIA_MAC_SERDES_GOOD];
+    statistic->media_mac_serdes_crc = total[VTSS_PHY_STAT_MEDIA_MAC_SERDES_CRC];
     return VTSS_RC_OK;
 }
 
@@ -12583,6 +12981,102 @@ vtss_rc vtss_phy_status_get(const vtss_inst_t    inst,
     return rc;
 }
 
+vtss_rc vtss_phy_status_refresh_set(const vtss_inst_t    inst,
+                                    const vtss_port_no_t port_no,
+                                    const u32            refresh_sec)
+{
+    vtss_state_t *vtss_state;
+    vtss_rc      rc;
+
+    VTSS_ENTER();
+    if ((rc = vtss_inst_port_no_check(inst, &vtss_state, port_no)) == VTSS_RC_OK) {
+        vtss_state->phy_state[port_no].status_refresh = refresh_sec;
+    }
+    VTSS_EXIT();
+    return rc;
+}
+
+vtss_rc vtss_phy_status_refresh_get(const vtss_inst_t    inst,
+                                    const vtss_port_no_t port_no,
+                                    u32                  *const refresh_sec)
+{
+    vtss_state_t *vtss_state;
+    vtss_rc      rc;
+
+    VTSS_ENTER();
+    if ((rc = vtss_inst_port_no_check(inst, &vtss_state, port_no)) == VTSS_RC_OK) {
+        *refresh_sec = vtss_state->phy_state[port_no].status_refresh;
+    }
+    VTSS_EXIT();
+    return rc;
+}
+
+vtss_rc vtss_phy_chip_temp_period_set(const vtss_inst_t    inst,
+                                      const vtss_port_no_t port_no,
+                                      const u32            period_sec)
+{
+    vtss_state_t          *vtss_state;
+    vtss_phy_port_state_t *bs;
+    vtss_rc               rc;
+
+    VTSS_ENTER();
+    if ((rc = vtss_inst_port_no_check(inst, &vtss_state, port_no)) == VTSS_RC_OK) {
+        bs = &vtss_state->phy_state[vtss_state->phy_state[port_no].type.base_port_no];
+        bs->temp_period = period_sec;
+    }
+    VTSS_EXIT();
+    return rc;
+}
+
+vtss_rc vtss_phy_chip_temp_period_get(const vtss_inst_t    inst,
+                                      const vtss_port_no_t port_no,
+                                      u32                  *const period_sec)
+{
+    vtss_state_t          *vtss_state;
+    vtss_phy_port_state_t *bs;
+    vtss_rc               rc;
+
+    VTSS_ENTER();
+    if ((rc = vtss_inst_port_no_check(inst, &vtss_state, port_no)) == VTSS_RC_OK) {
+        bs = &vtss_state->phy_state[vtss_state->phy_state[port_no].type.base_port_no];
+        *period_sec = bs->temp_period;
+    }
+    VTSS_EXIT();
+    return rc;
+}
+
+vtss_rc vtss_phy_chip_temp_age_get(const vtss_inst_t    inst,
+                                   const vtss_port_no_t port_no,
+                                   u32                  *const age_sec)
+{
+    vtss_state_t          *vtss_state;
+    vtss_phy_port_state_t *bs;
+    vtss_rc               rc;
+
+    VTSS_ENTER();
+    if ((rc = vtss_inst_port_no_check(inst, &vtss_state, port_no)) == VTSS_RC_OK) {
+        bs = &vtss_state->phy_state[vtss_state->phy_state[port_no].type.base_port_no];
+        *age_sec = (bs->temp_period && bs->temp_valid ? (u32)MEPA_UPTIME_SECONDS() - bs->temp_time : 0);
+    }
+    VTSS_EXIT();
+    return rc;
+}
+
+vtss_rc vtss_phy_status_fast_cnt_get(const vtss_inst_t    inst,
+                                     const vtss_port_no_t port_no,
+                                     u32                  *const cnt)
+{
+    vtss_state_t *vtss_state;
+    vtss_rc      rc;
+
+    VTSS_ENTER();
+    if ((rc = vtss_inst_port_no_check(inst, &vtss_state, port_no)) == VTSS_RC_OK) {
+        *cnt = vtss_state->phy_state[port_no].status_fast_cnt;
+    }
+    VTSS_EXIT();
+    return rc;
+}
+
 vtss_rc vtss_phy_status_inst_poll(const vtss_inst_t    inst,
                                   const vtss_port_no_t port_no,
                                   vtss_port_status_t   *const status)
@@ -12902,6 +13396,10 @@ vtss_rc vtss_phy_sync(vtss_state_t *vtss_state, const vtss_port_no_t port_no)
     VTSS_D("vtss_phy_sync, port_no:%d", port_no);
     vtss_state->sync_calling_private = TRUE;
 
+    // The page register may have been changed while the API was not running
+    vtss_phy_page_invalidate(vtss_state, port_no);
+    vtss_phy_status_fast_invalidate(vtss_state, port_no);
+
     // Starting with no registers changed.
     vtss_state->phy_state[port_no].warm_start_reg_changed = FALSE;
 
@@ -13211,6 +13709,69 @@ vtss_rc vtss_phy_statistic_get(const vtss_inst_t    inst,
 }
 
 
+vtss_rc vtss_phy_statistic64_get(const vtss_inst_t            inst,
+                                 const vtss_port_no_t         port_no,
+                                 vtss_phy_statistic64_t *const statistic)
+{
+    vtss_state_t *vtss_state;
+    vtss_rc      rc;
+
+    VTSS_ENTER();
+    if ((rc = vtss_inst_port_no_check(inst, &vtss_state, port_no)) == VTSS_RC_OK) {
+        rc = vtss_phy_statistic64_get_private(vtss_state, port_no, statistic);
+    }
+    VTSS_EXIT();
+    return rc;
+}
+
+vtss_rc vtss_phy_statistic64_clear(const vtss_inst_t    inst,
+                                   const vtss_port_no_t port_no)
+{
+    vtss_state_t *vtss_state;
+    vtss_rc      rc;
+
+    VTSS_ENTER();
+    if ((rc = vtss_inst_port_no_check(inst, &vtss_state, port_no)) == VTSS_RC_OK) {
+        // Collect the pending increments first, so they are not counted after the clear
+        vtss_state->phy_state[port_no].stat_valid = FALSE;
+        if ((rc = vtss_phy_stat_update(vtss_state, port_no)) == VTSS_RC_OK) {
+            memset(vtss_state->phy_state[port_no].stat_total, 0, sizeof(vtss_state->phy_state[port_no].stat_total));
+        }
+    }
+    VTSS_EXIT();
+    return rc;
+}
+
+vtss_rc vtss_phy_statistic_period_set(const vtss_inst_t    inst,
+                                      const vtss_port_no_t port_no,
+                                      const u32            period_sec)
+{
+    vtss_state_t *vtss_state;
+    vtss_rc      rc;
+
+    VTSS_ENTER();
+    if ((rc = vtss_inst_port_no_check(inst, &vtss_state, port_no)) == VTSS_RC_OK) {
+        vtss_state->phy_state[port_no].stat_period = period_sec;
+    }
+    VTSS_EXIT();
+    return rc;
+}
+
+vtss_rc vtss_phy_statistic_period_get(const vtss_inst_t    inst,
+                                      const vtss_port_no_t port_no,
+                                      u32                  *const period_sec)
+{
+    vtss_state_t *vtss_state;
+    vtss_rc      rc;
+
+    VTSS_ENTER();
+    if ((rc = vtss_inst_port_no_check(inst, &vtss_state, port_no)) == VTSS_RC_OK) {
+        *period_sec = vtss_state->phy_state[port_no].stat_period;
+    }
+    VTSS_EXIT();
+    return rc;
+}
+
 /* Read PHY register at a specific page  */
 vtss_rc vtss_phy_read_page(const vtss_inst_t    inst,
                            const vtss_port_no_t port_no,
@@ -13259,6 +13820,10 @@ vtss_rc vtss_phy_write(const vtss_inst_t    inst,
 
     VTSS_ENTER();
     if ((rc = vtss_inst_port_no_check(inst, &vtss_state, port_no)) == VTSS_RC_OK) {
+        if (addr == 31) {
+            // Raw page select - always written to the chip
+            vtss_phy_page_invalidate(vtss_state, port_no);
+        }
         rc = vtss_phy_wr(vtss_state, port_no, addr, value);
     }
     VTSS_EXIT();
@@ -13717,6 +14282,21 @@ vtss_rc vtss_phy_debug_phyinfo_print(const vtss_inst_t         inst,
     return rc;
 }
 
+// Print the register accesses of the init scripts
+vtss_rc vtss_phy_debug_script_print(const vtss_inst_t         inst,
+                                    const vtss_debug_printf_t pr)
+{
+    vtss_state_t *vtss_state;
+    vtss_rc rc = VTSS_RC_OK;
+
+    VTSS_ENTER();
+    if ((rc = vtss_inst_check(inst, &vtss_state)) == VTSS_RC_OK) {
+        vtss_phy_script_debug_print(pr);
+    }
+    VTSS_EXIT();
+    return rc;
+}
+
 static void vtss_phy_debug_reg_header(const vtss_debug_printf_t pr, const char *name)
 {
     pr("%-45s   DEV_ID REG_ADDR   VALUE\n", "REG_NAME");
@@ -13732,9 +14312,11 @@ static void vtss_phy_deb_pr_reg (vtss_state_t *vtss_state, const vtss_debug_prin
 
     /* Change page */
     if (page) {
+        vtss_phy_page_invalidate(vtss_state, port_no);
         miim_write_fn(vtss_state, port_no, 31, page);
     }
     miim_read_fn(vtss_state, port_no, addr, value);
+    vtss_phy_stat_fold(vtss_state, port_no, page, addr, *value);
     pr("%-45s:  0x%02x   0x%04x     0x%08x\n", name, page, addr, *value);
 
 }
@@ -13872,6 +14454,68 @@ static vtss_rc vtss_phy_debug_reg_dump_private(vtss_state_t *vtss_state,
     return rc;
 }
 
+// Register pages of the snapshot, covering the registers of vtss_phy_debug_reg_dump_private()
+static const struct {
+    u16 page;
+    u16 addr;
+    u16 cnt;
+} vtss_phy_snapshot_tbl[] = {
+    {VTSS_PHY_PAGE_STANDARD,    0, 32},
+    {VTSS_PHY_PAGE_EXTENDED,   16, 16},
+    {VTSS_PHY_PAGE_EXTENDED_2, 16, 16},
+    {VTSS_PHY_PAGE_EXTENDED_3, 16, 16},
+    {VTSS_PHY_PAGE_GPIO,       13, 19},
+};
+
+static vtss_rc vtss_phy_reg_snapshot_page_private(vtss_state_t                  *vtss_state,
+                                                  const vtss_port_no_t          port_no,
+                                                  vtss_phy_reg_snapshot_t *const snap)
+{
+    mepa_reg_snapshot_entry_t *entry = &snap->entry[snap->cnt];
+    u16                       page = vtss_phy_snapshot_tbl[snap->cursor].page;
+    u16                       addr = vtss_phy_snapshot_tbl[snap->cursor].addr;
+    u16                       i, value;
+
+    VTSS_RC(vtss_phy_wr(vtss_state, port_no, 31, page));
+    for (i = 0; i < vtss_phy_snapshot_tbl[snap->cursor].cnt; i++, entry++) {
+        VTSS_RC(vtss_phy_rd(vtss_state, port_no, addr + i, &value));
+        vtss_phy_stat_fold(vtss_state, port_no, page, addr + i, value);
+        entry->block = page;
+        entry->addr = addr + i;
+        entry->value = value;
+    }
+    snap->cnt += i;
+    return vtss_phy_page_std(vtss_state, port_no);
+}
+
+vtss_rc vtss_phy_reg_snapshot_get(const vtss_inst_t             inst,
+                                  const vtss_port_no_t          port_no,
+                                  vtss_phy_reg_snapshot_t *const snap)
+{
+    vtss_state_t *vtss_state;
+    vtss_rc      rc = VTSS_RC_OK;
+    u32          tbl_cnt = sizeof(vtss_phy_snapshot_tbl) / sizeof(vtss_phy_snapshot_tbl[0]);
+
+    // Only whole pages are read, releasing the API lock between them
+    while (rc == VTSS_RC_OK && snap->cursor < tbl_cnt &&
+           vtss_phy_snapshot_tbl[snap->cursor].cnt <= (snap->size - snap->cnt)) {
+        VTSS_ENTER();
+        if ((rc = vtss_inst_port_no_check(inst, &vtss_state, port_no)) == VTSS_RC_OK) {
+            rc = VTSS_RC_COLD(vtss_phy_reg_snapshot_page_private(vtss_state, port_no, snap));
+        }
+        VTSS_EXIT();
+        if (rc == VTSS_RC_OK) {
+            snap->cursor++;
+        }
+    }
+    snap->done = (snap->cursor >= tbl_cnt);
+    if (rc == VTSS_RC_OK && snap->cnt == 0 && !snap->done) {
+        VTSS_E("port_no %u: snapshot buffer of %u entries too small", port_no, snap->size);
+        rc = VTSS_RC_ERR_PARM;
+    }
+    return rc;
+}
+
 vtss_rc vtss_phy_debug_register_dump (const vtss_inst_t inst,
                                       const vtss_debug_printf_t pr,
                                       BOOL clear, const vtss_port_no_t port_no)
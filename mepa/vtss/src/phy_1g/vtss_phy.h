@@ -106,6 +106,18 @@ typedef enum {
 
 #define VTSS_FORCED_LONG_LINKUP_COUNTER_WINDOW   (3)  /* Max Offset Part of Work-Around for Long Linkup Time in Forced Mode */
 
+/* Counters of the statistics engine, in the order they are read */
+typedef enum {
+    VTSS_PHY_STAT_CU_GOOD,               /* 18E1: Cu media CRC good counter, modulo 10000 */
+    VTSS_PHY_STAT_CU_BAD,                /* 23E1: Cu media CRC error counter, clear on read */
+    VTSS_PHY_STAT_SERDES_TX_GOOD,        /* 21E3: SerDes Tx good packet counter, modulo 10000 */
+    VTSS_PHY_STAT_SERDES_TX_BAD,         /* 22E3: SerDes Tx CRC error counter, clear on read */
+    VTSS_PHY_STAT_MEDIA_MAC_SERDES_GOOD, /* 28E3: Media/MAC SerDes Rx good counter, modulo 10000 */
+    VTSS_PHY_STAT_MEDIA_MAC_SERDES_CRC,  /* 29E3: Media/MAC SerDes Rx CRC error counter, clear on read */
+    VTSS_PHY_STAT_RX_ERR_CNT_BASE_TX,    /* 19:   100/1000BASE-TX receive error counter, clear on read */
+    VTSS_PHY_STAT_CNT
+} vtss_phy_stat_t;
+
 typedef struct _vtss_phy_port_state_info_t {
     vtss_phy_reset_conf_t  reset;      /* Reset setup */
     vtss_phy_family_t      family;     /* Family */
@@ -146,6 +158,38 @@ typedef struct _vtss_phy_port_state_info_t {
     BOOL                   warm_start_reg_changed;
     u16                    mac_block_mtu; /* MAC Block MTU  */
     u16                    forced_long_linkup_counter;    /* Delay for Forced Mode Work-Around for Forced Mode Long Linkup Time issue  */
+
+    u16                    page_cur;      /* Mirror of the page register (reg 31), so the page is only written when it changes */
+    BOOL                   page_valid;    /* page_cur is known. Cleared on reset, warm start and raw register 31 access */
+    BOOL                   page_restore;  /* A page-encoded access left its page selected, see vtss_phy_rd_wr_masked() */
+    BOOL                   bcast;         /* SMI broadcast writes are enabled from this port, see vtss_phy_bcast_set() */
+    BOOL                   bcast_page_wr; /* The page register has been written while broadcasting */
+
+    BOOL                   macsec_csr_batch; /* MACsec CSR accesses are batched, see vtss_phy_macsec_csr_batch_set() */
+    BOOL                   macsec_csr_idle;  /* Batch only: The last MACsec CSR command has completed */
+    u16                    macsec_csr_tgt;   /* Batch only: Target held by MACsec register 20, 0xffff if unknown */
+
+    BOOL                   status_fast;       /* Link is up and the aneg/link partner result is known, so the status fast path may be used */
+    BOOL                   status_link_down;  /* The fast path has cleared a latched link down event, which the next full read must report */
+    u32                    status_refresh;    /* Seconds between full status reads while link is up, 0 disables the fast path */
+    u32                    status_full_time;  /* Uptime in seconds of the last full status read */
+    u32                    status_fast_cnt;   /* Number of status reads done by the fast path */
+
+    // Chip temperature sampler, only used in the base port
+    u32                    temp_period;       /* Seconds between temperature conversions, 0 converts on every read */
+    BOOL                   temp_valid;        /* temp holds a converted temperature */
+    BOOL                   temp_pending;      /* A conversion has been started and not yet collected */
+    i16                    temp;              /* Last converted chip temperature */
+    u32                    temp_time;         /* Uptime in seconds when the conversion of temp was started */
+    u32                    temp_start;        /* Uptime in seconds when the pending conversion was started */
+
+    // Statistics engine, see vtss_phy_stat_update()
+    u32                    stat_period;       /* Seconds between counter block reads, 0 reads on every request */
+    BOOL                   stat_valid;        /* stat_raw holds the wrapping counters of the last read */
+    u32                    stat_time;         /* Uptime in seconds of the last counter block read */
+    u16                    stat_raw[VTSS_PHY_STAT_CNT];   /* Counter contents of the last read */
+    u16                    stat_last[VTSS_PHY_STAT_CNT];  /* Counter values of the last read as returned by vtss_phy_statistic_get() */
+    u64                    stat_total[VTSS_PHY_STAT_CNT]; /* Counters extended to 64 bits */
 } vtss_phy_port_state_t;
 
 #define MAX_REGISTERS_PER_PAGE  32
@@ -252,6 +296,9 @@ vtss_rc vtss_phy_wr_page(struct vtss_state_s *vtss_state,
 #define PHY_RD_PAGE(vtss_state, port_no, page_addr, value) vtss_phy_rd_page(vtss_state, port_no, page_addr, value, __LINE__)
 
 vtss_rc vtss_phy_page_std(struct vtss_state_s *vtss_state, vtss_port_no_t port_no);
+void vtss_phy_page_invalidate(struct vtss_state_s *vtss_state, vtss_port_no_t port_no);
+vtss_rc vtss_phy_bcast_set(struct vtss_state_s *vtss_state, vtss_port_no_t port_no, BOOL enable);
+void vtss_phy_status_fast_invalidate(struct vtss_state_s *vtss_state, vtss_port_no_t port_no);
 vtss_rc vtss_phy_page_ext(struct vtss_state_s *vtss_state, vtss_port_no_t port_no);
 vtss_rc vtss_phy_page_ext2(struct vtss_state_s *vtss_state, vtss_port_no_t port_no);
 vtss_rc vtss_phy_page_ext3(struct vtss_state_s *vtss_state, vtss_port_no_t port_no);
@@ -298,6 +345,13 @@ vtss_rc vtss_phy_macsec_csr_wr_private(struct vtss_state_s *vtss_state,
                                        const u32            csr_reg_addr,
                                        const u32            value);
 
+// Start (enable = TRUE) or end a batch of MACsec CSR accesses on a port. Within a batch the page register is left at
+// the MACsec page between accesses, and the command busy wait and target setup are skipped when they are known to be
+// redundant. Only MACsec CSR accesses may be done to the port while the batch is open.
+vtss_rc vtss_phy_macsec_csr_batch_set(struct vtss_state_s  *vtss_state,
+                                      const vtss_port_no_t port_no,
+                                      const BOOL           enable);
+
 // Same as vtss_phy_1588_csr_rd defined in vtss_phy_api.h, but this function can be called within the API it-selves
 vtss_rc vtss_phy_macsec_csr_rd_private(struct vtss_state_s  *vtss_state,
                                        const vtss_port_no_t port_no,
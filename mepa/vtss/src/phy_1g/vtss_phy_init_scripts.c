@@ -77,6 +77,158 @@ const char *vtss_phy_family2txt(vtss_phy_family_t family)
     return "Unknown";
 }
 
+/************************************************************************/
+/* Init script engine                                                   */
+/************************************************************************/
+
+// The chip init scripts are tables of register operations run by vtss_phy_script_run().
+typedef enum {
+    VTSS_PHY_SCRIPT_OP_PAGE,       // Select <page>
+    VTSS_PHY_SCRIPT_OP_WR,         // Write <val> to <page>:<reg>
+    VTSS_PHY_SCRIPT_OP_WR_MASKED,  // Read-modify-write <val>/<mask> to <page>:<reg>
+    VTSS_PHY_SCRIPT_OP_BCAST,      // Enable (<val> = TRUE) or disable SMI broadcast writes, leaves the standard page selected
+    VTSS_PHY_SCRIPT_OP_IF_REV,     // Skip the next <mask> operations unless the revision is <val>
+    VTSS_PHY_SCRIPT_OP_IF_NOT_REV, // Skip the next <mask> operations if the revision is <val>
+} vtss_phy_script_op_type_t;
+
+typedef struct {
+    u8  op;   // vtss_phy_script_op_type_t
+    u8  reg;  // Register address
+    u16 page; // Page, for WR/WR_MASKED only used for the page check (see do_page_chk)
+    u16 val;  // Value
+    u16 mask; // Mask, or number of operations for IF_REV/IF_NOT_REV
+} vtss_phy_script_op_t;
+
+typedef struct {
+    const char                 *name;
+    const vtss_phy_script_op_t *ops;
+    u32                        cnt;
+} vtss_phy_script_t;
+
+// Register accesses done by a script
+typedef struct {
+    u32 ops;       // Operations done, skipped revision specific operations are not included
+    u32 page_wr;   // Page selects written
+    u32 page_skip; // Page selects skipped, because the page was already selected
+    u32 rd;        // Register reads (read part of masked writes)
+    u32 wr;        // Register writes
+} vtss_phy_script_cnt_t;
+
+#define VTSS_PHY_SCRIPT_OP_CNT(ops) (sizeof(ops) / sizeof(vtss_phy_script_op_t))
+
+// The register macros (e.g. VTSS_PHY_PAGE_TR_16) expand to "page, reg", hence the extra macro level.
+#define VTSS_PHY_SCRIPT_PAGE(page)                 {VTSS_PHY_SCRIPT_OP_PAGE, 31, page, page, 0xffff}
+#define VTSS_PHY_SCRIPT_WR(...)                    VTSS_PHY_SCRIPT_WR_(__VA_ARGS__)
+#define VTSS_PHY_SCRIPT_WR_(page, reg, val)        {VTSS_PHY_SCRIPT_OP_WR, reg, page, val, 0xffff}
+#define VTSS_PHY_SCRIPT_WR_MASKED(...)             VTSS_PHY_SCRIPT_WR_MASKED_(__VA_ARGS__)
+#define VTSS_PHY_SCRIPT_WR_MASKED_(page, reg, val, mask) {VTSS_PHY_SCRIPT_OP_WR_MASKED, reg, page, val, mask}
+#define VTSS_PHY_SCRIPT_BCAST(enable)              {VTSS_PHY_SCRIPT_OP_BCAST, 22, VTSS_PHY_PAGE_STANDARD, enable, 0x0001}
+#define VTSS_PHY_SCRIPT_IF_REV(rev, cnt)           {VTSS_PHY_SCRIPT_OP_IF_REV, 0, 0, rev, cnt}
+#define VTSS_PHY_SCRIPT_IF_NOT_REV(rev, cnt)       {VTSS_PHY_SCRIPT_OP_IF_NOT_REV, 0, 0, rev, cnt}
+
+#define VTSS_PHY_SCRIPT_PAGE_NONE 0xffff // Page register content unknown
+
+// Run a script in port_no, or only count its register accesses if vtss_state is NULL.
+// The page register content is unknown when the script starts, so counting and running
+// do the same accesses. Page selects of the page already selected are skipped.
+static vtss_rc vtss_phy_script_walk(vtss_state_t *vtss_state, vtss_port_no_t port_no,
+                                    const vtss_phy_script_t *script, u16 revision,
+                                    vtss_phy_script_cnt_t *cnt)
+{
+    const vtss_phy_script_op_t *op;
+    u32                        i;
+    u16                        page = VTSS_PHY_SCRIPT_PAGE_NONE;
+    BOOL                       match;
+    vtss_rc                    rc;
+
+    memset(cnt, 0, sizeof(*cnt));
+    for (i = 0; i < script->cnt; i++) {
+        op = &script->ops[i];
+        cnt->ops++;
+        switch (op->op) {
+        case VTSS_PHY_SCRIPT_OP_PAGE:
+            if (op->page == page) {
+                cnt->page_skip++;
+                break;
+            }
+            cnt->page_wr++;
+            page = op->page;
+            if (vtss_state != NULL) {
+                VTSS_RC(vtss_phy_wr(vtss_state, port_no, 31, page));
+            }
+            break;
+
+        case VTSS_PHY_SCRIPT_OP_WR:
+            cnt->wr++;
+            if (vtss_state != NULL &&
+                (rc = vtss_phy_wr_page(vtss_state, port_no, op->page, op->reg, op->val, __LINE__)) != VTSS_RC_OK) {
+                VTSS_E("script %s: write failed at index %u", script->name, i);
+                return rc;
+            }
+            break;
+
+        case VTSS_PHY_SCRIPT_OP_WR_MASKED:
+            cnt->rd++;
+            cnt->wr++;
+            if (vtss_state != NULL &&
+                (rc = vtss_phy_wr_masked_page(vtss_state, port_no, op->page, op->reg, op->val, op->mask, __LINE__)) != VTSS_RC_OK) {
+                VTSS_E("script %s: masked write failed at index %u", script->name, i);
+                return rc;
+            }
+            break;
+
+        case VTSS_PHY_SCRIPT_OP_BCAST:
+            // Standard page select followed by read-modify-write of register 22, see vtss_phy_bcast_set()
+            if (page == VTSS_PHY_PAGE_STANDARD) {
+                cnt->page_skip++;
+            } else {
+                cnt->page_wr++;
+                page = VTSS_PHY_PAGE_STANDARD;
+            }
+            cnt->rd++;
+            cnt->wr++;
+            if (vtss_state != NULL) {
+                VTSS_RC(vtss_phy_bcast_set(vtss_state, port_no, op->val ? TRUE : FALSE));
+            }
+            break;
+
+        case VTSS_PHY_SCRIPT_OP_IF_REV:
+        case VTSS_PHY_SCRIPT_OP_IF_NOT_REV:
+            match = (revision == op->val);
+            if (op->op == VTSS_PHY_SCRIPT_OP_IF_NOT_REV) {
+                match = !match;
+            }
+            if (!match) {
+                i += op->mask;
+            }
+            break;
+
+        default:
+            VTSS_E("script %s: illegal op %u at index %u", script->name, op->op, i);
+            return VTSS_RC_ERROR;
+        }
+    }
+    return VTSS_RC_OK;
+}
+
+// Run an init script
+//
+// In : port_no  : Any port within the chip.
+//      script   : The script.
+//      revision : Chip revision, selects the revision specific operations of the script.
+//
+// Return : VTSS_RC_OK if the script was run else error code.
+static vtss_rc vtss_phy_script_run(vtss_state_t *vtss_state, vtss_port_no_t port_no,
+                                   const vtss_phy_script_t *script, u16 revision)
+{
+    vtss_phy_script_cnt_t cnt;
+
+    VTSS_RC(vtss_phy_script_walk(vtss_state, port_no, script, revision, &cnt));
+    VTSS_I("script %s done, port_no:%u, ops:%u, page_wr:%u, page_skip:%u, rd:%u, wr:%u",
+           script->name, port_no, cnt.ops, cnt.page_wr, cnt.page_skip, cnt.rd, cnt.wr);
+    return VTSS_RC_OK;
+}
+
 
 // Function for downloading code into the internal 8051 CPU.
 // In : port_no - Any port within the chip where to download the 8051 code
@@ -785,6 +937,253 @@ static vtss_rc luton26_atom12_revC_patch(vtss_state_t *vtss_state, vtss_port_no_
     return VTSS_RC_OK;
 }
 
+static const vtss_phy_script_op_t vtss_phy_script_atom_rev_cd_ops[] = {
+    VTSS_PHY_SCRIPT_PAGE(VTSS_PHY_PAGE_STANDARD),
+
+    VTSS_PHY_SCRIPT_BCAST(TRUE),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_EXTENDED_PHY_CONTROL_2, 0x0040),
+    VTSS_PHY_SCRIPT_PAGE(VTSS_PHY_PAGE_EXTENDED_2),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_CU_PMD_TX_CTRL, 0x02be),
+    VTSS_PHY_SCRIPT_PAGE(VTSS_PHY_PAGE_TEST),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_TEST_PAGE_20, 0x4420),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_TEST_PAGE_24, 0x0c00),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_TEST_PAGE_9, 0x18c8),
+    VTSS_PHY_SCRIPT_WR_MASKED(VTSS_PHY_TEST_PAGE_8, 0x8000, 0x8000),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_TEST_PAGE_5, 0x1320),
+
+    VTSS_PHY_SCRIPT_PAGE(VTSS_PHY_PAGE_TR),
+    VTSS_PHY_SCRIPT_IF_REV(VTSS_PHY_ATOM_REV_D, 3),
+        VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0027),
+        VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x303d),
+        VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x9792),
+    VTSS_PHY_SCRIPT_IF_NOT_REV(VTSS_PHY_ATOM_REV_D, 3), //VTSS_PHY_ATOM_REV_C
+        VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0032),
+        VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x303d),
+        VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x9792),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x00a0),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0xf147),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x97a0),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0005),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x2f54),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x8fe4),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0004),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x01bd),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x8fae),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x000f),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x000f),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x8fac),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0000),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x0004),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x87fe),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0006),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x0150),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x8fe0),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0012),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x480a),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x8f82),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0000),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x0034),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x8f80),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0000),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x0012),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x82e0),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0005),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x0208),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x83a2),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0000),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x9186),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x83b2),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x000e),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x3700),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x8fb0),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0004),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x9fa1),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x9688),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0000),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0xffff),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x8fd2),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0003),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x9fa0),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x968a),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0020),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x640b),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x9690),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0000),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x2220),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x8258),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0000),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x2a20),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x825a),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0000),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x3060),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x825c),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0000),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x3fa0),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x825e),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0000),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0xe0f0),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x83a6),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0000),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x4489),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x8f92),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0000),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x7000),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x96a2),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0010),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x2048),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x96a6),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x00ff),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x0000),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x96a0),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0091),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x9880),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x8fe8),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0004),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0xd602),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x8fea),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x00ef),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0xef00),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x96b0),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0000),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x7100),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x96b2),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0000),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x5064),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x96b4),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0050),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x100f),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x87fa),
+#ifndef VTSS_10BASE_TE
+    VTSS_PHY_SCRIPT_PAGE(VTSS_PHY_PAGE_TR),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0071),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0xf6d9),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x8488),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0000),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x0db6),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x848e),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0059),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x6596),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x849c),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0000),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x0514),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x849e),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0041),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x0280),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x84a2),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0000),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x0000),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x84a4),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0000),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x0000),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x84a6),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0000),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x0000),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x84a8),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0000),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x0000),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x84aa),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x007d),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0xf7dd),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x84ae),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x006d),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x95d4),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x84b0),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0049),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x2410),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x84b2),
+#else //using 10BASE-Te
+    VTSS_PHY_SCRIPT_WR(31, 0x0002),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_EEE_CONTROL, 0x8000),
+    VTSS_PHY_SCRIPT_WR(31, 0x52b5),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0008),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0xa499),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x8486),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0075),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0xf759),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x8488),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0000),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x0914),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x848a),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x00f7),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0xff7b),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x848c),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0000),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x0eb9),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x848e),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0061),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x85d6),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x8490),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0055),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x44d2),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x8492),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0044),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0xa8aa),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x8494),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0000),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x0cb9),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x8496),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x00f7),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0xff79),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x8498),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0000),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x0caa),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x849a),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0061),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x8618),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x849c),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0000),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x0618),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x849e),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0000),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x0018),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x84a0),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0061),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x848a),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x84a2),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0000),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x0000),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x84a4),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0000),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x0000),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x84a6),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0000),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x0000),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x84a8),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0000),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x0000),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x84aa),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0029),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x265d),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x84ac),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x007d),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0xd658),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x84ae),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0061),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x8618),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x84b0),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0061),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x8618),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x84b2),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0061),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x8618),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x84b4),
+#endif
+
+    // Improve 100BASE-TX link startup robustness to address interop issue
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0068),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x8980),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x8f90),
+
+    VTSS_PHY_SCRIPT_PAGE(VTSS_PHY_PAGE_TEST),
+    VTSS_PHY_SCRIPT_WR_MASKED(VTSS_PHY_TEST_PAGE_8, 0x0000, 0x8000),
+    VTSS_PHY_SCRIPT_PAGE(VTSS_PHY_PAGE_STANDARD),
+    VTSS_PHY_SCRIPT_BCAST(FALSE),
+};
+
+static const vtss_phy_script_t vtss_phy_script_atom_rev_cd = {
+    "atom_rev_cd", vtss_phy_script_atom_rev_cd_ops, VTSS_PHY_SCRIPT_OP_CNT(vtss_phy_script_atom_rev_cd_ops)
+};
+
 // Initialization need for ATOM12 rev. C & D. (For whole chip and must be done before init. of the individual ports)
 //
 // In : phy - Any port with the chip.
@@ -793,247 +1192,7 @@ static vtss_rc luton26_atom12_revC_patch(vtss_state_t *vtss_state, vtss_port_no_
 // Date   : 30-10-2012
 static vtss_rc luton26_atom12_revCD_init_script(vtss_state_t *vtss_state, vtss_port_no_t port_no, u16 revision)
 {
-    VTSS_RC(vtss_phy_page_std(vtss_state, port_no));
-
-    VTSS_RC(PHY_WR_MASKED_PAGE(vtss_state, port_no, VTSS_PHY_EXTENDED_CONTROL_AND_STATUS, 0x0001, 0x0001));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_EXTENDED_PHY_CONTROL_2, 0x0040));
-    VTSS_RC(vtss_phy_page_ext2(vtss_state, port_no));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_CU_PMD_TX_CTRL, 0x02be));
-    VTSS_RC(vtss_phy_page_test(vtss_state, port_no));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_TEST_PAGE_20, 0x4420));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_TEST_PAGE_24, 0x0c00));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_TEST_PAGE_9, 0x18c8));
-    VTSS_RC(PHY_WR_MASKED_PAGE(vtss_state, port_no,  VTSS_PHY_TEST_PAGE_8, 0x8000, 0x8000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no,  VTSS_PHY_TEST_PAGE_5, 0x1320));
-
-    VTSS_RC(vtss_phy_page_tr(vtss_state, port_no));
-    if (revision == VTSS_PHY_ATOM_REV_D) {
-        VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0027));
-        VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x303d));
-        VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x9792));
-    } else { //VTSS_PHY_ATOM_REV_C
-        VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0032));
-        VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x303d));
-        VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x9792));
-    }
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x00a0));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0xf147));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x97a0));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0005));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x2f54));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x8fe4));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0004));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x01bd));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x8fae));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x000f));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x000f));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x8fac));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x0004));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x87fe));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0006));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x0150));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x8fe0));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0012));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x480a));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x8f82));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x0034));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x8f80));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x0012));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x82e0));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0005));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x0208));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x83a2));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x9186));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x83b2));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x000e));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x3700));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x8fb0));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0004));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x9fa1));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x9688));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0xffff));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x8fd2));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0003));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x9fa0));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x968a));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0020));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x640b));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x9690));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x2220));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x8258));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x2a20));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x825a));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x3060));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x825c));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x3fa0));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x825e));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0xe0f0));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x83a6));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x4489));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x8f92));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x7000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x96a2));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0010));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x2048));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x96a6));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x00ff));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x0000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x96a0));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0091));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x9880));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x8fe8));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0004));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0xd602));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x8fea));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x00ef));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0xef00));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x96b0));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x7100));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x96b2));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x5064));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x96b4));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0050));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x100f));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x87fa));
-#ifndef VTSS_10BASE_TE
-    VTSS_RC(vtss_phy_page_tr(vtss_state, port_no));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0071));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0xf6d9));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x8488));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x0db6));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x848e));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0059));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x6596));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x849c));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x0514));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x849e));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0041));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x0280));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x84a2));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x0000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x84a4));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x0000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x84a6));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x0000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x84a8));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x0000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x84aa));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x007d));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0xf7dd));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x84ae));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x006d));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x95d4));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x84b0));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0049));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x2410));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x84b2));
-#else //using 10BASE-Te
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, 31, 0x0002));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_EEE_CONTROL, 0x8000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, 31, 0x52b5));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0008));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0xa499));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x8486));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0075));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0xf759));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x8488));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x0914));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x848a));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x00f7));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0xff7b));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x848c));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x0eb9));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x848e));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0061));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x85d6));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x8490));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0055));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x44d2));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x8492));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0044));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0xa8aa));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x8494));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x0cb9));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x8496));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x00f7));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0xff79));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x8498));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x0caa));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x849a));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0061));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x8618));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x849c));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x0618));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x849e));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x0018));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x84a0));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0061));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x848a));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x84a2));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x0000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x84a4));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x0000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x84a6));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x0000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x84a8));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x0000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x84aa));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0029));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x265d));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x84ac));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x007d));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0xd658));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x84ae));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0061));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x8618));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x84b0));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0061));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x8618));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x84b2));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0061));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x8618));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x84b4));
-#endif
-
-    // Improve 100BASE-TX link startup robustness to address interop issue
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0068));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x8980));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x8f90));
-
-    VTSS_RC(vtss_phy_page_test(vtss_state, port_no));
-    VTSS_RC(PHY_WR_MASKED_PAGE(vtss_state, port_no,  VTSS_PHY_TEST_PAGE_8, 0x0000, 0x8000));
-    VTSS_RC(vtss_phy_page_std(vtss_state, port_no));
-    VTSS_RC(PHY_WR_MASKED_PAGE(vtss_state, port_no, VTSS_PHY_EXTENDED_CONTROL_AND_STATUS, 0x0000, 0x0001));
+    VTSS_RC(vtss_phy_script_run(vtss_state, port_no, &vtss_phy_script_atom_rev_cd, revision));
 
     VTSS_I("luton26_atom12_revCD_init_script done");
     return luton26_atom12_revC_patch(vtss_state, port_no);
@@ -1051,7 +1210,7 @@ static vtss_rc luton26_atom12_revB_init_script(vtss_state_t *vtss_state, vtss_po
 {
     VTSS_RC(vtss_phy_page_std(vtss_state, port_no));
 
-    VTSS_RC(PHY_WR_MASKED_PAGE(vtss_state, port_no, VTSS_PHY_EXTENDED_CONTROL_AND_STATUS, 0x0001, 0x0001)); //Turn ON broadcast to all 12 PHYs
+    VTSS_RC(vtss_phy_bcast_set(vtss_state, port_no, TRUE)); //Turn ON broadcast to all 12 PHYs
 
     VTSS_I("phy:%d", port_no);
     VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_MODE_CONTROL, 0x1000));
@@ -1173,7 +1332,7 @@ static vtss_rc luton26_atom12_revB_init_script(vtss_state_t *vtss_state, vtss_po
     VTSS_RC(luton26_atom12_revB_patch(vtss_state, port_no)); // Download Luton26/Atom12 Rev. B patch
 
     VTSS_RC(vtss_phy_page_std(vtss_state, port_no));
-    VTSS_RC(PHY_WR_MASKED_PAGE(vtss_state, port_no, VTSS_PHY_EXTENDED_CONTROL_AND_STATUS, 0x0000, 0x0001)); //Turn off broadcast to all 12 PHYs
+    VTSS_RC(vtss_phy_bcast_set(vtss_state, port_no, FALSE)); //Turn off broadcast to all 12 PHYs
 
     return VTSS_RC_OK;
 }
@@ -1791,7 +1950,7 @@ static vtss_rc vtss_phy_pre_init_seq_tesla_17_august_2011 (vtss_state_t *vtss_st
     // MII register writes and test-page register writes go here
     //using broadcast flag to speed things up
     VTSS_RC(vtss_phy_page_std(vtss_state, port_no));
-    VTSS_RC(PHY_WR_MASKED_PAGE(vtss_state, port_no, VTSS_PHY_EXTENDED_CONTROL_AND_STATUS, 0x0001, 0x0001)); //turn on broadcast writes
+    VTSS_RC(vtss_phy_bcast_set(vtss_state, port_no, TRUE)); //turn on broadcast writes
 
     VTSS_RC(vtss_phy_page_test(vtss_state, port_no)); //Switch to test register page
     VTSS_RC(PHY_WR_MASKED_PAGE(vtss_state, port_no, VTSS_PHY_TEST_PAGE_8,  0x8000, 0x8000)); //Enable token-ring during coma-mode
@@ -1863,7 +2022,7 @@ static vtss_rc vtss_phy_pre_init_seq_tesla_17_august_2011 (vtss_state_t *vtss_st
 
 
     VTSS_RC(vtss_phy_page_std(vtss_state, port_no));
-    VTSS_RC(PHY_WR_MASKED_PAGE(vtss_state, port_no, VTSS_PHY_EXTENDED_CONTROL_AND_STATUS, 0x0000, 0x0001)); // Turn off broadcast writes
+    VTSS_RC(vtss_phy_bcast_set(vtss_state, port_no, FALSE)); // Turn off broadcast writes
 
     VTSS_RC(tesla_revB_8051_patch(vtss_state, port_no)); //Load micro patch Tesla RevB
 
@@ -1884,7 +2043,7 @@ static vtss_rc vtss_phy_pre_init_seq_tesla_4_april_2011(vtss_state_t *vtss_state
     // MII register writes and test-page register writes go here
     //using broadcast flag to speed things up
     VTSS_RC(vtss_phy_page_std(vtss_state, port_no)); //Switch to main register page
-    VTSS_RC(PHY_WR_MASKED_PAGE(vtss_state, port_no, VTSS_PHY_EXTENDED_CONTROL_AND_STATUS, 0x0001, 0x0001)); // turn on broadcast writes
+    VTSS_RC(vtss_phy_bcast_set(vtss_state, port_no, TRUE)); // turn on broadcast writes
 
     // Set 100BASE-TX edge rate to optimal setting
     VTSS_RC(PHY_WR_MASKED_PAGE(vtss_state, port_no, VTSS_PHY_EXTENDED_PHY_CONTROL_2, 0x2000, 0xe000));
@@ -1999,263 +2158,271 @@ static vtss_rc vtss_phy_pre_init_seq_tesla_4_april_2011(vtss_state_t *vtss_state
 
 
     VTSS_RC(vtss_phy_page_std(vtss_state, port_no));
-    VTSS_RC(PHY_WR_MASKED_PAGE(vtss_state, port_no, VTSS_PHY_EXTENDED_CONTROL_AND_STATUS, 0x0000, 0x0001)); // Turn off broadcast writes
+    VTSS_RC(vtss_phy_bcast_set(vtss_state, port_no, FALSE)); // Turn off broadcast writes
 
     VTSS_RC(tesla_revA_8051_patch_9_27_2011(vtss_state, port_no)); //Load micro patch
     return VTSS_RC_OK;
 }
 
-// Initialization needed for Tesla. (For whole chip and must be done before init. of the individual ports)
-//
-// In : port_no : Port number (MUST be the first port for the chip)..
-//
-// Return : VTSS_RC_OK if configuration done else error code.
-// Date : 27-09-2012 - updated to address bugzilla #9871 and #9886
-static vtss_rc vtss_phy_pre_init_seq_tesla_rev_d(vtss_state_t *vtss_state, vtss_port_no_t port_no)
-{
-    VTSS_RC(vtss_phy_page_std(vtss_state, port_no));
-    VTSS_RC(PHY_WR_MASKED_PAGE(vtss_state, port_no, VTSS_PHY_EXTENDED_CONTROL_AND_STATUS, 0x0001, 0x0001));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_EXTENDED_PHY_CONTROL_2, 0x0040));
-    VTSS_RC(vtss_phy_page_ext2(vtss_state, port_no));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_CU_PMD_TX_CTRL, 0x02be));
-    VTSS_RC(vtss_phy_page_test(vtss_state, port_no));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_TEST_PAGE_20, 0x4420));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_TEST_PAGE_24, 0x0c00));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_TEST_PAGE_9, 0x18cc));
-    VTSS_RC(PHY_WR_MASKED_PAGE(vtss_state, port_no, VTSS_PHY_TEST_PAGE_8, 0x8000, 0x8000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_TEST_PAGE_5, 0x1320));
-    VTSS_RC(vtss_phy_page_tr(vtss_state, port_no));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0004));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x01bd));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x8fae));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x000f));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x000f));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x8fac));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x00a0));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0xf147));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x97a0));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0005));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x2f54));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x8fe4));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0027));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x303d));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x9792));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x0704));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x87fe));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0006));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x0150));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x8fe0));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0012));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x480a));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x8f82));
+static const vtss_phy_script_op_t vtss_phy_script_tesla_rev_d_ops[] = {
+    VTSS_PHY_SCRIPT_PAGE(VTSS_PHY_PAGE_STANDARD),
+    VTSS_PHY_SCRIPT_BCAST(TRUE),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_EXTENDED_PHY_CONTROL_2, 0x0040),
+    VTSS_PHY_SCRIPT_PAGE(VTSS_PHY_PAGE_EXTENDED_2),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_CU_PMD_TX_CTRL, 0x02be),
+    VTSS_PHY_SCRIPT_PAGE(VTSS_PHY_PAGE_TEST),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_TEST_PAGE_20, 0x4420),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_TEST_PAGE_24, 0x0c00),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_TEST_PAGE_9, 0x18cc),
+    VTSS_PHY_SCRIPT_WR_MASKED(VTSS_PHY_TEST_PAGE_8, 0x8000, 0x8000),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_TEST_PAGE_5, 0x1320),
+    VTSS_PHY_SCRIPT_PAGE(VTSS_PHY_PAGE_TR),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0004),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x01bd),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x8fae),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x000f),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x000f),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x8fac),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x00a0),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0xf147),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x97a0),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0005),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x2f54),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x8fe4),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0027),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x303d),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x9792),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0000),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x0704),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x87fe),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0006),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x0150),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x8fe0),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0012),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x480a),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x8f82),
     /*excluding this register configuraiton for tesla revisions <= D , 
       and have to taken care for tesla Rev-E*/
 #if 0
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x0034));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x8f80));
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0000),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x0034),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x8f80),
 #endif
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x0012));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x82e0));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0005));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x0208));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x83a2));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x9186));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x83b2));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x000e));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x3700));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x8fb0));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0004));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x9fa0));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x9688));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0xffff));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x8fd2));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0003));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x9fa0));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x968a));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0020));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x640b));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x9690));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x2220));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x8258));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x2a20));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x825a));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x3060));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x825c));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x3fa0));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x825e));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0xe0f0));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x83a6));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x4489));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x8f92));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x7000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x96a2));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0010));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x2048));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x96a6));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x00ff));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x0000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x96a0));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0091));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x9880));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x8fe8));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0004));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0xd602));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x8fea));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x00ef));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0xef00));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x96b0));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x7100));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x96b2));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x5064));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x96b4));
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0000),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x0012),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x82e0),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0005),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x0208),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x83a2),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0000),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x9186),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x83b2),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x000e),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x3700),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x8fb0),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0004),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x9fa0),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x9688),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0000),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0xffff),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x8fd2),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0003),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x9fa0),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x968a),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0020),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x640b),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x9690),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0000),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x2220),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x8258),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0000),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x2a20),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x825a),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0000),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x3060),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x825c),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0000),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x3fa0),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x825e),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0000),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0xe0f0),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x83a6),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0000),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x4489),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x8f92),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0000),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x7000),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x96a2),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0010),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x2048),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x96a6),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x00ff),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x0000),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x96a0),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0091),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x9880),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x8fe8),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0004),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0xd602),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x8fea),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x00ef),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0xef00),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x96b0),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0000),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x7100),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x96b2),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0000),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x5064),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x96b4),
 
     // Improve 100BASE-TX link startup robustness to address interop issue
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0068));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x8980));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x8f90));
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0068),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x8980),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x8f90),
     // Work-around solution for bugzilla#6859
     //Our solution is to force the BlindSampleTimer to 0x080 by setting
     //BlindSampleTimerForce to '1' (bit 22) and BlindSampleTimerForceVal to 0x080
     //(bits 21:13) in register 0x3d in the AutoNegDbgNode.  This increases the time
     //to wait for the link to come up before allowing the crossover state to switch
     //to ~511 ms.
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0050));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x100f));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x87fa));
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0050),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x100f),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x87fa),
 
 #ifndef VTSS_10BASE_TE
-    VTSS_RC(vtss_phy_page_tr(vtss_state, port_no));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0071));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0xf6d9));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x8488));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x0db6));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x848e));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0059));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x6596));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x849c));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x0514));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x849e));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0041));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x0280));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x84a2));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x0000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x84a4));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x0000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x84a6));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x0000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x84a8));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x0000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x84aa));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x007d));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0xf7dd));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x84ae));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x006d));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x95d4));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x84b0));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0049));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x2410));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x84b2));
+    VTSS_PHY_SCRIPT_PAGE(VTSS_PHY_PAGE_TR),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0071),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0xf6d9),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x8488),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0000),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x0db6),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x848e),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0059),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x6596),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x849c),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0000),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x0514),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x849e),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0041),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x0280),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x84a2),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0000),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x0000),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x84a4),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0000),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x0000),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x84a6),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0000),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x0000),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x84a8),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0000),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x0000),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x84aa),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x007d),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0xf7dd),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x84ae),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x006d),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x95d4),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x84b0),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0049),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x2410),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x84b2),
 #else //using 10BASE-Te
-    VTSS_RC(vtss_phy_page_ext2(vtss_state, port_no));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_EEE_CONTROL, 0x8000));
-    VTSS_RC(vtss_phy_page_tr(vtss_state, port_no));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0008));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0xa499));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x8486));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0075));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0xf759));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x8488));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x0914));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x848a));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x00f7));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0xff7b));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x848c));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x0eb9));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x848e));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0061));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x85d6));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x8490));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0055));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x44d2));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x8492));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0044));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0xa8aa));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x8494));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x0cb9));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x8496));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x00f7));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0xff79));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x8498));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x0caa));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x849a));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0061));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x8618));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x849c));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x0618));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x849e));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x0018));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x84a0));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0061));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x848a));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x84a2));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x0000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x84a4));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x0000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x84a6));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x0000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x84a8));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x0000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x84aa));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0029));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x265d));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x84ac));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x007d));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0xd658));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x84ae));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0061));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x8618));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x84b0));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0061));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x8618));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x84b2));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0061));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x8618));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x84b4));
+    VTSS_PHY_SCRIPT_PAGE(VTSS_PHY_PAGE_EXTENDED_2),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_EEE_CONTROL, 0x8000),
+    VTSS_PHY_SCRIPT_PAGE(VTSS_PHY_PAGE_TR),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0008),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0xa499),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x8486),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0075),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0xf759),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x8488),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0000),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x0914),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x848a),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x00f7),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0xff7b),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x848c),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0000),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x0eb9),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x848e),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0061),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x85d6),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x8490),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0055),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x44d2),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x8492),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0044),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0xa8aa),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x8494),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0000),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x0cb9),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x8496),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x00f7),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0xff79),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x8498),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0000),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x0caa),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x849a),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0061),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x8618),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x849c),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0000),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x0618),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x849e),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0000),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x0018),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x84a0),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0061),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x848a),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x84a2),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0000),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x0000),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x84a4),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0000),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x0000),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x84a6),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0000),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x0000),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x84a8),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0000),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x0000),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x84aa),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0029),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x265d),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x84ac),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x007d),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0xd658),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x84ae),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0061),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x8618),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x84b0),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0061),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x8618),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x84b2),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0061),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x8618),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x84b4),
 #endif //VTSS_10BASE_TE
-    VTSS_RC(vtss_phy_page_test(vtss_state, port_no));
-    VTSS_RC(PHY_WR_MASKED_PAGE(vtss_state, port_no,  VTSS_PHY_TEST_PAGE_8, 0x0000, 0x8000));
-    VTSS_RC(vtss_phy_page_std(vtss_state, port_no));
-    VTSS_RC(PHY_WR_MASKED_PAGE(vtss_state, port_no, VTSS_PHY_EXTENDED_CONTROL_AND_STATUS, 0x0000, 0x0001));
+    VTSS_PHY_SCRIPT_PAGE(VTSS_PHY_PAGE_TEST),
+    VTSS_PHY_SCRIPT_WR_MASKED(VTSS_PHY_TEST_PAGE_8, 0x0000, 0x8000),
+    VTSS_PHY_SCRIPT_PAGE(VTSS_PHY_PAGE_STANDARD),
+    VTSS_PHY_SCRIPT_BCAST(FALSE),
+};
+
+static const vtss_phy_script_t vtss_phy_script_tesla_rev_d = {
+    "tesla_rev_d", vtss_phy_script_tesla_rev_d_ops, VTSS_PHY_SCRIPT_OP_CNT(vtss_phy_script_tesla_rev_d_ops)
+};
+
+// Initialization needed for Tesla. (For whole chip and must be done before init. of the individual ports)
+//
+// In : port_no : Port number (MUST be the first port for the chip)..
+//
+// Return : VTSS_RC_OK if configuration done else error code.
+// Date : 27-09-2012 - updated to address bugzilla #9871 and #9886
+static vtss_rc vtss_phy_pre_init_seq_tesla_rev_d(vtss_state_t *vtss_state, vtss_port_no_t port_no)
+{
+    VTSS_RC(vtss_phy_script_run(vtss_state, port_no, &vtss_phy_script_tesla_rev_d, 0));
 
     VTSS_RC(tesla_revB_8051_patch(vtss_state, port_no)); // Rev D. uses the same patch as rev B.
 
@@ -2265,6 +2432,290 @@ static vtss_rc vtss_phy_pre_init_seq_tesla_rev_d(vtss_state_t *vtss_state, vtss_
 
 }
 
+static const vtss_phy_script_op_t vtss_phy_script_tesla_rev_e_ops[] = {
+    VTSS_PHY_SCRIPT_PAGE(VTSS_PHY_PAGE_STANDARD),
+    VTSS_PHY_SCRIPT_BCAST(TRUE),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_EXTENDED_PHY_CONTROL_2, 0x0040),
+    VTSS_PHY_SCRIPT_PAGE(VTSS_PHY_PAGE_EXTENDED_2),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_CU_PMD_TX_CTRL, 0x02be),
+    VTSS_PHY_SCRIPT_PAGE(VTSS_PHY_PAGE_TEST),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_TEST_PAGE_20, 0x4320),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_TEST_PAGE_24, 0x0c00),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_TEST_PAGE_9, 0x18ca),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_TEST_PAGE_5, 0x1b20),
+    VTSS_PHY_SCRIPT_WR_MASKED(VTSS_PHY_TEST_PAGE_8, 0x8000, 0x8000),
+    VTSS_PHY_SCRIPT_PAGE(VTSS_PHY_PAGE_TR),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0004),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x01bd),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x8fae),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x000f),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x000f),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x8fac),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x00a0),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0xf147),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x97a0),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0005),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x2f54),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x8fe4),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0027),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x303d),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x9792),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0000),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x0704),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x87fe),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0006),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x0150),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x8fe0),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0012),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0xb00a),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x8f82),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0000),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x0d74),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x8f80),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0000),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x0012),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x82e0),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0005),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x0208),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x83a2),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0000),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x9186),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x83b2),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x000e),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x3700),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x8fb0),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0004),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x9f81),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x9688),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0000),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0xffff),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x8fd2),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0003),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x9fa2),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x968a),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0020),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x640b),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x9690),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0000),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x2220),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x8258),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0000),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x2a20),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x825a),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0000),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x3060),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x825c),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0000),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x3fa0),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x825e),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0000),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0xe0f0),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x83a6),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0000),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x1489),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x8f92),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0000),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x7000),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x96a2),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0007),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x1448),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x96a6),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x00ee),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0xffdd),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x96a0),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0091),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0xb06c),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x8fe8),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0004),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x1600),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x8fea),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x00ee),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0xff00),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x96b0),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0000),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x7000),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x96b2),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0000),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x0814),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x96b4),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0068),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x8980),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x8f90),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0000),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0xd8f0),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x83a4),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0000),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x0400),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x8fc0),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0050),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x100f),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x87fa),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0000),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x0003),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x8796),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x00c3),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0xff98),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x87f8),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0018),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x292a),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x8fa4),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x00d2),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0xc46f),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x968c),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0000),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x0620),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x97a2),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0013),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x132f),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x96a4),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0000),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x0000),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x96a8),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x00c0),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0xa028),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x8ffc),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0090),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x1c09),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x8fec),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0004),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0xa6a1),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x8fee),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x00b0),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x1807),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x8ffe),
+#ifndef VTSS_10BASE_TE
+    VTSS_PHY_SCRIPT_PAGE(VTSS_PHY_PAGE_EXTENDED_2),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x028e),
+    VTSS_PHY_SCRIPT_PAGE(VTSS_PHY_PAGE_TR),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0008),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0xa518),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x8486),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x006d),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0xc696),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x8488),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0000),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x0912),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x848a),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0000),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x0db6),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x848e),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0059),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x6596),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x849c),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0000),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x0514),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x849e),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0041),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x0280),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x84a2),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0000),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x0000),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x84a4),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0000),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x0000),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x84a6),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0000),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x0000),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x84a8),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0000),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x0000),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x84aa),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x007d),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0xf7dd),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x84ae),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x006d),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x95d4),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x84b0),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0049),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x2410),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x84b2),
+#else //using 10BASE-Te
+    VTSS_PHY_SCRIPT_PAGE(VTSS_PHY_PAGE_EXTENDED_2),
+    VTSS_PHY_SCRIPT_WR_MASKED(VTSS_PHY_PAGE_TR_17, 0x8000, 0x8000),
+    VTSS_PHY_SCRIPT_PAGE(VTSS_PHY_PAGE_TR),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0008),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0xa499),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x8486),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0075),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0xf759),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x8488),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0000),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x0914),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x848a),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x00f7),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0xff7b),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x848c),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0000),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x0eb9),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x848e),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0061),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x85d6),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x8490),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0055),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x44d2),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x8492),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0044),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0xa8aa),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x8494),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0000),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x0cb9),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x8496),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x00f7),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0xff79),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x8498),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0000),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x0caa),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x849a),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0061),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x8618),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x849c),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0000),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x0618),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x849e),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0000),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x0018),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x84a0),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0061),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x848a),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x84a2),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0000),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x0000),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x84a4),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0000),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x0000),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x84a6),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0000),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x0000),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x84a8),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0000),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x0000),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x84aa),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0029),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x265d),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x84ac),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x007d),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0xd658),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x84ae),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0061),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x8618),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x84b0),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0061),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x8618),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x84b2),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0061),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x8618),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x84b4),
+#endif //using 10BASE-Te
+    VTSS_PHY_SCRIPT_PAGE(VTSS_PHY_PAGE_TEST),
+    VTSS_PHY_SCRIPT_WR_MASKED(VTSS_PHY_TEST_PAGE_8, 0x0000, 0x8000),
+    VTSS_PHY_SCRIPT_PAGE(VTSS_PHY_PAGE_STANDARD),
+    VTSS_PHY_SCRIPT_BCAST(FALSE),
+};
+
+static const vtss_phy_script_t vtss_phy_script_tesla_rev_e = {
+    "tesla_rev_e", vtss_phy_script_tesla_rev_e_ops, VTSS_PHY_SCRIPT_OP_CNT(vtss_phy_script_tesla_rev_e_ops)
+};
+
 // Initialization needed for Tesla Rev E. (For whole chip and must be done before init. of the individual ports)
 //
 // In : port_no : Port number (MUST be the first port for the chip)..
@@ -2273,283 +2724,7 @@ static vtss_rc vtss_phy_pre_init_seq_tesla_rev_d(vtss_state_t *vtss_state, vtss_
 // Date : Jan 12,2018 - updated to address bugzilla #9871 and #9886
 static vtss_rc vtss_phy_pre_init_seq_tesla_rev_e(vtss_state_t *vtss_state, vtss_port_no_t port_no)
 {
-    VTSS_RC(vtss_phy_page_std(vtss_state, port_no));
-    VTSS_RC(PHY_WR_MASKED_PAGE(vtss_state, port_no, VTSS_PHY_EXTENDED_CONTROL_AND_STATUS, 0x0001, 0x0001));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_EXTENDED_PHY_CONTROL_2, 0x0040));
-    VTSS_RC(vtss_phy_page_ext2(vtss_state, port_no));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_CU_PMD_TX_CTRL, 0x02be));
-    VTSS_RC(vtss_phy_page_test(vtss_state, port_no));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_TEST_PAGE_20, 0x4320));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_TEST_PAGE_24, 0x0c00));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_TEST_PAGE_9, 0x18ca));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_TEST_PAGE_5, 0x1b20));
-    VTSS_RC(PHY_WR_MASKED_PAGE(vtss_state, port_no, VTSS_PHY_TEST_PAGE_8, 0x8000, 0x8000));
-    VTSS_RC(vtss_phy_page_tr(vtss_state, port_no));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0004));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x01bd));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x8fae));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x000f));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x000f));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x8fac));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x00a0));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0xf147));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x97a0));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0005));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x2f54));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x8fe4));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0027));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x303d));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x9792));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x0704));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x87fe));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0006));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x0150));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x8fe0));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0012));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0xb00a));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x8f82));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x0d74));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x8f80));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x0012));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x82e0));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0005));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x0208));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x83a2));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x9186));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x83b2));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x000e));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x3700));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x8fb0));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0004));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x9f81));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x9688));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0xffff));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x8fd2));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0003));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x9fa2));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x968a));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0020));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x640b));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x9690));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x2220));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x8258));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x2a20));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x825a));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x3060));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x825c));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x3fa0));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x825e));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0xe0f0));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x83a6));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x1489));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x8f92));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x7000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x96a2));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0007));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x1448));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x96a6));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x00ee));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0xffdd));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x96a0));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0091));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0xb06c));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x8fe8));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0004));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x1600));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x8fea));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x00ee));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0xff00));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x96b0));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x7000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x96b2));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x0814));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x96b4));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0068));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x8980));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x8f90));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0xd8f0));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x83a4));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x0400));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x8fc0));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0050));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x100f));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x87fa));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x0003));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x8796));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x00c3));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0xff98));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x87f8));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0018));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x292a));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x8fa4));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x00d2));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0xc46f));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x968c));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x0620));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x97a2));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0013));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x132f));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x96a4));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x0000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x96a8));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x00c0));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0xa028));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x8ffc));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0090));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x1c09));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x8fec));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0004));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0xa6a1));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x8fee));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x00b0));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x1807));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x8ffe));
-#ifndef VTSS_10BASE_TE
-    VTSS_RC(vtss_phy_page_ext2(vtss_state, port_no));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x028e));
-    VTSS_RC(vtss_phy_page_tr(vtss_state, port_no));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0008));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0xa518));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x8486));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x006d));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0xc696));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x8488));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x0912));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x848a));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x0db6));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x848e));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0059));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x6596));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x849c));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x0514));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x849e));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0041));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x0280));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x84a2));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x0000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x84a4));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x0000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x84a6));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x0000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x84a8));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x0000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x84aa));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x007d));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0xf7dd));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x84ae));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x006d));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x95d4));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x84b0));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0049));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x2410));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x84b2));
-#else //using 10BASE-Te
-    VTSS_RC(vtss_phy_page_ext2(vtss_state, port_no));
-    VTSS_RC(PHY_WR_MASKED_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x8000, 0x8000));
-    VTSS_RC(vtss_phy_page_tr(vtss_state, port_no));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0008));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0xa499));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x8486));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0075));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0xf759));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x8488));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x0914));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x848a));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x00f7));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0xff7b));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x848c));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x0eb9));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x848e));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0061));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x85d6));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x8490));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0055));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x44d2));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x8492));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0044));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0xa8aa));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x8494));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x0cb9));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x8496));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x00f7));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0xff79));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x8498));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x0caa));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x849a));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0061));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x8618));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x849c));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x0618));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x849e));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x0018));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x84a0));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0061));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x848a));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x84a2));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x0000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x84a4));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x0000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x84a6));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x0000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x84a8));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x0000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x84aa));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0029));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x265d));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x84ac));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x007d));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0xd658));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x84ae));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0061));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x8618));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x84b0));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0061));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x8618));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x84b2));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0061));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x8618));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x84b4));
-#endif //using 10BASE-Te
-    VTSS_RC(vtss_phy_page_test(vtss_state, port_no));
-    VTSS_RC(PHY_WR_MASKED_PAGE(vtss_state, port_no,  VTSS_PHY_TEST_PAGE_8, 0x0000, 0x8000));
-    VTSS_RC(vtss_phy_page_std(vtss_state, port_no));
-    VTSS_RC(PHY_WR_MASKED_PAGE(vtss_state, port_no, VTSS_PHY_EXTENDED_CONTROL_AND_STATUS, 0x0000, 0x0001));
+    VTSS_RC(vtss_phy_script_run(vtss_state, port_no, &vtss_phy_script_tesla_rev_e, 0));
 
 #if defined (MICRO_PATCH_REV_TS_FIFO_2)
     VTSS_RC(tesla_revD_8051_patch(vtss_state, port_no)); // Rev D. This is for RevD Only
@@ -2790,28 +2965,19 @@ static vtss_rc viper_revB_8051_patch(vtss_state_t *vtss_state, vtss_port_no_t po
 }
 
 
-// Initialization needed for Viper. (For whole chip and must be done before init. of the individual ports)
-//
-// In : port_no : Port number (MUST be the first port for the chip)..
-//
-// Return : VTSS_RC_OK if configuration done else error code.
-// Date : 06-03-2013
-static vtss_rc vtss_phy_pre_init_seq_viper_rev_a(vtss_state_t *vtss_state, vtss_port_no_t port_no)
-{
-    vtss_phy_port_state_t *ps = &vtss_state->phy_state[port_no];
-
-    VTSS_RC(vtss_phy_page_std(vtss_state, port_no));
-    VTSS_RC(PHY_WR_MASKED_PAGE(vtss_state, port_no, VTSS_PHY_EXTENDED_CONTROL_AND_STATUS, 0x0001, 0x0001));
-    VTSS_RC(vtss_phy_page_test(vtss_state, port_no));
-    VTSS_RC(PHY_WR_MASKED_PAGE(vtss_state, port_no, VTSS_PHY_TEST_PAGE_8, 0x8000, 0x8000));
-    VTSS_RC(vtss_phy_page_tr(vtss_state, port_no));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0068));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x8980));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x8f90));
+static const vtss_phy_script_op_t vtss_phy_script_viper_rev_a_ops[] = {
+    VTSS_PHY_SCRIPT_PAGE(VTSS_PHY_PAGE_STANDARD),
+    VTSS_PHY_SCRIPT_BCAST(TRUE),
+    VTSS_PHY_SCRIPT_PAGE(VTSS_PHY_PAGE_TEST),
+    VTSS_PHY_SCRIPT_WR_MASKED(VTSS_PHY_TEST_PAGE_8, 0x8000, 0x8000),
+    VTSS_PHY_SCRIPT_PAGE(VTSS_PHY_PAGE_TR),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0068),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x8980),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x8f90),
     /*- The following code was added for bug 13269 */
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x0003));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x8796));
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0000),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x0003),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x8796),
     /*- End of added code for bug 13269 */
     // Work-around solution for bugzilla#6859
     //Our solution is to force the BlindSampleTimer to 0x080 by setting
@@ -2819,390 +2985,415 @@ static vtss_rc vtss_phy_pre_init_seq_viper_rev_a(vtss_state_t *vtss_state, vtss_
     //(bits 21:13) in register 0x3d in the AutoNegDbgNode.  This increases the time
     //to wait for the link to come up before allowing the crossover state to switch
     //to ~511 ms.
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0050));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x100f));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x87fa));
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0050),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x100f),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x87fa),
 
     /* Init script updates from James Bz#22267*/
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0068));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x8980));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x8f90));
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0068),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x8980),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x8f90),
 
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0xd8f0));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x83a4));
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0000),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0xd8f0),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x83a4),
 
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x0400));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x8fc0));
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0000),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x0400),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x8fc0),
 
     /* EEE updates from James Bz#22267*/
 
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0012));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0xb002));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x8f82));
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0012),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0xb002),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x8f82),
 
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x0004));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x9686));
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0000),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x0004),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x9686),
 
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x00d2));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0xc46f));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x968c));
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x00d2),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0xc46f),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x968c),
 
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x0620));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x97a2));
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0000),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x0620),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x97a2),
 
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x00ee));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0xffdd));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x96a0));
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x00ee),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0xffdd),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x96a0),
 
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0007));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x1448));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x96a6));
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0007),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x1448),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x96a6),
 
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0013));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x132f));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x96a4));
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0013),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x132f),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x96a4),
 
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x0000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x96a8));
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0000),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x0000),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x96a8),
 
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x00c0));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0xa028));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x8ffc));
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x00c0),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0xa028),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x8ffc),
 
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0091));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0xb06c));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x8fe8));
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0091),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0xb06c),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x8fe8),
 
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0004));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x1600));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x8fea));
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0004),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x1600),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x8fea),
 
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x00ff));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0xfaff));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x8f80));
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x00ff),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0xfaff),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x8f80),
 
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0090));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x1809));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x8fec));
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0090),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x1809),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x8fec),
 
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x00b0));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x1007));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x8ffe));
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x00b0),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x1007),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x8ffe),
 
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x00ee));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0xff00));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x96b0));
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x00ee),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0xff00),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x96b0),
 
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x7000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x96b2));
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0000),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x7000),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x96b2),
 
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x0814));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x96b4));
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0000),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x0814),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x96b4),
 
 #ifndef VTSS_10BASE_TE
 #else //using 10BASE-Te
-    VTSS_RC(vtss_phy_page_ext2(vtss_state, port_no));
-    VTSS_RC(PHY_WR_MASKED_PAGE(vtss_state, port_no, 17, 0x8000, 0x8000));
-    VTSS_RC(vtss_phy_page_tr(vtss_state, port_no));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0008));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0xa499));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x8486));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0075));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0xf759));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x8488));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x0914));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x848a));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x00f7));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0xff7b));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x848c));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x0eb9));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x848e));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0061));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x85d6));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x8490));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0055));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x44d2));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x8492));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0044));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0xa8aa));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x8494));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x0cb9));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x8496));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x00f7));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0xff79));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x8498));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x0caa));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x849a));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0061));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x8618));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x849c));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x0618));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x849e));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x0018));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x84a0));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0061));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x848a));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x84a2));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x0000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x84a4));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x0000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x84a6));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x0000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x84a8));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x0000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x84aa));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0029));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x265d));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x84ac));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x007d));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0xd658));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x84ae));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0061));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x8618));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x84b0));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0061));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x8618));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x84b2));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0061));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x8618));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x84b4));
+    VTSS_PHY_SCRIPT_PAGE(VTSS_PHY_PAGE_EXTENDED_2),
+    VTSS_PHY_SCRIPT_WR_MASKED(17, 0x8000, 0x8000),
+    VTSS_PHY_SCRIPT_PAGE(VTSS_PHY_PAGE_TR),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0008),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0xa499),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x8486),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0075),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0xf759),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x8488),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0000),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x0914),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x848a),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x00f7),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0xff7b),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x848c),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0000),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x0eb9),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x848e),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0061),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x85d6),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x8490),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0055),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x44d2),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x8492),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0044),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0xa8aa),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x8494),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0000),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x0cb9),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x8496),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x00f7),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0xff79),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x8498),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0000),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x0caa),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x849a),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0061),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x8618),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x849c),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0000),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x0618),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x849e),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0000),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x0018),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x84a0),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0061),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x848a),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x84a2),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0000),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x0000),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x84a4),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0000),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x0000),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x84a6),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0000),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x0000),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x84a8),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0000),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x0000),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x84aa),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0029),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x265d),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x84ac),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x007d),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0xd658),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x84ae),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0061),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x8618),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x84b0),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0061),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x8618),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x84b2),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0061),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x8618),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x84b4),
 #endif
-    VTSS_RC(vtss_phy_page_test(vtss_state, port_no));
-    VTSS_RC(PHY_WR_MASKED_PAGE(vtss_state, port_no, VTSS_PHY_TEST_PAGE_8, 0x0000, 0x8000));
-    VTSS_RC(vtss_phy_page_std(vtss_state, port_no));
-    VTSS_RC(PHY_WR_MASKED_PAGE(vtss_state, port_no, VTSS_PHY_EXTENDED_CONTROL_AND_STATUS, 0x0000, 0x0001));
+    VTSS_PHY_SCRIPT_PAGE(VTSS_PHY_PAGE_TEST),
+    VTSS_PHY_SCRIPT_WR_MASKED(VTSS_PHY_TEST_PAGE_8, 0x0000, 0x8000),
+    VTSS_PHY_SCRIPT_PAGE(VTSS_PHY_PAGE_STANDARD),
+    VTSS_PHY_SCRIPT_BCAST(FALSE),
+};
 
-    // According James new chip revision must not use the rev. A micro, even if they are using the Rev. A init settings.
-    if (ps->type.revision == VTSS_PHY_VIPER_REV_A) {
-        VTSS_RC(viper_revA_8051_patch(vtss_state, port_no)); //Load micro patch
-    }
-    return VTSS_RC_OK;
-}
+static const vtss_phy_script_t vtss_phy_script_viper_rev_a = {
+    "viper_rev_a", vtss_phy_script_viper_rev_a_ops, VTSS_PHY_SCRIPT_OP_CNT(vtss_phy_script_viper_rev_a_ops)
+};
 
-// Initialization needed for Viper Rev B Silicon.
-// Note: For whole chip and must be done before init. of the individual ports
+// Initialization needed for Viper. (For whole chip and must be done before init. of the individual ports)
 //
 // In : port_no : Port number (MUST be the first port for the chip)..
 //
 // Return : VTSS_RC_OK if configuration done else error code.
-// Date : 07-08-2015
-static vtss_rc vtss_phy_pre_init_seq_viper_rev_b(vtss_state_t *vtss_state, vtss_port_no_t port_no)
+// Date : 06-03-2013
+static vtss_rc vtss_phy_pre_init_seq_viper_rev_a(vtss_state_t *vtss_state, vtss_port_no_t port_no)
 {
     vtss_phy_port_state_t *ps = &vtss_state->phy_state[port_no];
 
-    VTSS_RC(vtss_phy_page_std(vtss_state, port_no));
-    VTSS_RC(PHY_WR_MASKED_PAGE(vtss_state, port_no, VTSS_PHY_EXTENDED_CONTROL_AND_STATUS, 0x0001, 0x0001));
-    VTSS_RC(PHY_WR_MASKED_PAGE(vtss_state, port_no, VTSS_PHY_BYPASS_CONTROL, 0x0008, 0x0008));
-    VTSS_RC(vtss_phy_page_ext3(vtss_state, port_no));
+    VTSS_RC(vtss_phy_script_run(vtss_state, port_no, &vtss_phy_script_viper_rev_a, 0));
+
+    // According James new chip revision must not use the rev. A micro, even if they are using the Rev. A init settings.
+    if (ps->type.revision == VTSS_PHY_VIPER_REV_A) {
+        VTSS_RC(viper_revA_8051_patch(vtss_state, port_no)); //Load micro patch
+    }
+    return VTSS_RC_OK;
+}
+
+static const vtss_phy_script_op_t vtss_phy_script_viper_rev_b_ops[] = {
+    VTSS_PHY_SCRIPT_PAGE(VTSS_PHY_PAGE_STANDARD),
+    VTSS_PHY_SCRIPT_BCAST(TRUE),
+    VTSS_PHY_SCRIPT_WR_MASKED(VTSS_PHY_BYPASS_CONTROL, 0x0008, 0x0008),
+    VTSS_PHY_SCRIPT_PAGE(VTSS_PHY_PAGE_EXTENDED_3),
     // Breaks frame preemption: VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_MEDIA_SERDES_TX_CRC_ERROR_COUNTER, 0x2000));
-    VTSS_RC(vtss_phy_page_test(vtss_state, port_no));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_TEST_PAGE_5, 0x1f20));
-    VTSS_RC(PHY_WR_MASKED_PAGE(vtss_state, port_no, VTSS_PHY_TEST_PAGE_8, 0x8000, 0x8000));
-    VTSS_RC(vtss_phy_page_tr(vtss_state, port_no));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0xafa4)); 
-    VTSS_RC(PHY_WR_MASKED_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0019, 0x007f));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x8fa4));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0050));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x100f));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x87fa));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0004));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x9f81));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x9688));
+    VTSS_PHY_SCRIPT_PAGE(VTSS_PHY_PAGE_TEST),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_TEST_PAGE_5, 0x1f20),
+    VTSS_PHY_SCRIPT_WR_MASKED(VTSS_PHY_TEST_PAGE_8, 0x8000, 0x8000),
+    VTSS_PHY_SCRIPT_PAGE(VTSS_PHY_PAGE_TR),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0xafa4),
+    VTSS_PHY_SCRIPT_WR_MASKED(VTSS_PHY_PAGE_TR_18, 0x0019, 0x007f),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x8fa4),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0050),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x100f),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x87fa),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0004),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x9f81),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x9688),
 
     /* Init script updates from James Bz#22267*/
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0068));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x8980));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x8f90));
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0068),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x8980),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x8f90),
 
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0xd8f0));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x83a4));
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0000),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0xd8f0),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x83a4),
 
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x0400));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x8fc0));
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0000),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x0400),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x8fc0),
 
     /* EEE updates from James Bz#22267*/
 
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0012));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0xb002));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x8f82));
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0012),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0xb002),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x8f82),
 
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x0004));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x9686));
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0000),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x0004),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x9686),
 
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x00d2));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0xc46f));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x968c));
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x00d2),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0xc46f),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x968c),
 
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x0620));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x97a2));
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0000),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x0620),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x97a2),
 
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x00ee));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0xffdd));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x96a0));
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x00ee),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0xffdd),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x96a0),
 
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0007));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x1448));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x96a6));
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0007),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x1448),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x96a6),
 
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0013));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x132f));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x96a4));
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0013),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x132f),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x96a4),
 
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x0000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x96a8));
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0000),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x0000),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x96a8),
 
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x00c0));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0xa028));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x8ffc));
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x00c0),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0xa028),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x8ffc),
 
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0091));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0xb06c));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x8fe8));
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0091),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0xb06c),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x8fe8),
 
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0004));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x1600));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x8fea));
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0004),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x1600),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x8fea),
 
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x00ff));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0xfaff));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x8f80));
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x00ff),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0xfaff),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x8f80),
 
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0090));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x1809));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x8fec));
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0090),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x1809),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x8fec),
 
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x00b0));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x1007));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x8ffe));
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x00b0),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x1007),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x8ffe),
 
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x00ee));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0xff00));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x96b0));
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x00ee),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0xff00),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x96b0),
 
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x7000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x96b2));
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0000),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x7000),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x96b2),
 
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x0814));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x96b4));
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0000),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x0814),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x96b4),
 
 #ifndef VTSS_10BASE_TE
-    VTSS_RC(vtss_phy_page_ext2(vtss_state, port_no));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_CU_PMD_TX_CTRL, 0x028e));
-    VTSS_RC(vtss_phy_page_tr(vtss_state, port_no));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0008));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0xa518));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x8486));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x006d));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0xc696));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x8488));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x0912));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x848a));
+    VTSS_PHY_SCRIPT_PAGE(VTSS_PHY_PAGE_EXTENDED_2),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_CU_PMD_TX_CTRL, 0x028e),
+    VTSS_PHY_SCRIPT_PAGE(VTSS_PHY_PAGE_TR),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0008),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0xa518),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x8486),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x006d),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0xc696),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x8488),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0000),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x0912),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x848a),
 #else //using 10BASE-Te
-    VTSS_RC(vtss_phy_page_ext2(vtss_state, port_no));
-    VTSS_RC(PHY_WR_MASKED_PAGE(vtss_state, port_no, VTSS_PHY_EEE_CONTROL, 0x8000, 0x8000));
-    VTSS_RC(vtss_phy_page_tr(vtss_state, port_no));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0008));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0xa499));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x8486));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0075));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0xf759));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x8488));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x0914));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x848a));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x00f7));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0xff7b));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x848c));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x0eb9));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x848e));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0061));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x85d6));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x8490));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0055));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x44d2));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x8492));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0044));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0xa8aa));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x8494));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x0cb9));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x8496));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x00f7));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0xff79));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x8498));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x0caa));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x849a));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0061));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x8618));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x849c));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x0618));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x849e));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x0018));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x84a0));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0061));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x848a));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x84a2));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x0000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x84a4));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x0000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x84a6));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x0000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x84a8));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x0000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x84aa));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0029));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x265d));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x84ac));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x007d));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0xd658));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x84ae));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0061));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x8618));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x84b0));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0061));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x8618));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x84b2));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0061));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x8618));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x84b4));
+    VTSS_PHY_SCRIPT_PAGE(VTSS_PHY_PAGE_EXTENDED_2),
+    VTSS_PHY_SCRIPT_WR_MASKED(VTSS_PHY_EEE_CONTROL, 0x8000, 0x8000),
+    VTSS_PHY_SCRIPT_PAGE(VTSS_PHY_PAGE_TR),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0008),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0xa499),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x8486),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0075),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0xf759),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x8488),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0000),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x0914),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x848a),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x00f7),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0xff7b),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x848c),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0000),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x0eb9),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x848e),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0061),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x85d6),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x8490),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0055),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x44d2),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x8492),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0044),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0xa8aa),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x8494),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0000),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x0cb9),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x8496),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x00f7),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0xff79),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x8498),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0000),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x0caa),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x849a),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0061),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x8618),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x849c),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0000),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x0618),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x849e),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0000),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x0018),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x84a0),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0061),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x848a),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x84a2),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0000),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x0000),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x84a4),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0000),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x0000),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x84a6),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0000),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x0000),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x84a8),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0000),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x0000),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x84aa),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0029),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x265d),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x84ac),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x007d),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0xd658),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x84ae),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0061),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x8618),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x84b0),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0061),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x8618),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x84b2),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0061),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x8618),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x84b4),
 #endif //using 10BASE-Te
-    VTSS_RC(vtss_phy_page_test(vtss_state, port_no));
-    VTSS_RC(PHY_WR_MASKED_PAGE(vtss_state, port_no, VTSS_PHY_TEST_PAGE_8, 0x0000, 0x8000));
-    VTSS_RC(vtss_phy_page_std(vtss_state, port_no));
-    VTSS_RC(PHY_WR_MASKED_PAGE(vtss_state, port_no, VTSS_PHY_EXTENDED_CONTROL_AND_STATUS, 0x0000, 0x0001));
+    VTSS_PHY_SCRIPT_PAGE(VTSS_PHY_PAGE_TEST),
+    VTSS_PHY_SCRIPT_WR_MASKED(VTSS_PHY_TEST_PAGE_8, 0x0000, 0x8000),
+    VTSS_PHY_SCRIPT_PAGE(VTSS_PHY_PAGE_STANDARD),
+    VTSS_PHY_SCRIPT_BCAST(FALSE),
+};
+
+static const vtss_phy_script_t vtss_phy_script_viper_rev_b = {
+    "viper_rev_b", vtss_phy_script_viper_rev_b_ops, VTSS_PHY_SCRIPT_OP_CNT(vtss_phy_script_viper_rev_b_ops)
+};
+
+// Initialization needed for Viper Rev B Silicon.
+// Note: For whole chip and must be done before init. of the individual ports
+//
+// In : port_no : Port number (MUST be the first port for the chip)..
+//
+// Return : VTSS_RC_OK if configuration done else error code.
+// Date : 07-08-2015
+static vtss_rc vtss_phy_pre_init_seq_viper_rev_b(vtss_state_t *vtss_state, vtss_port_no_t port_no)
+{
+    vtss_phy_port_state_t *ps = &vtss_state->phy_state[port_no];
+
+    VTSS_RC(vtss_phy_script_run(vtss_state, port_no, &vtss_phy_script_viper_rev_b, 0));
 
     // NOTE: Viper Rev B. does not have a micro patch at the moment
     // According James new chip revision must not use the rev. A micro, even if they are using the Rev. A init settings.
@@ -3248,192 +3439,198 @@ static vtss_rc vtss_phy_pre_init_seq_viper(vtss_state_t *vtss_state, vtss_port_n
     return VTSS_RC_OK;
 }
 
-/************************************************************************/
-/* ELISE family functions                                               */
-/************************************************************************/
-// Initialization needed for ELISE. (For whole chip and must be done before init. of the individual ports)
-//
-// In : port_no : Port number (MUST be the first port for the chip)..
-//
-// Return : VTSS_RC_OK if configuration done else error code.
-static vtss_rc vtss_phy_pre_init_seq_elise_rev_a(vtss_state_t *vtss_state, vtss_port_no_t port_no)
-{
-    VTSS_RC(vtss_phy_page_std(vtss_state, port_no));
-    VTSS_RC(PHY_WR_MASKED_PAGE(vtss_state, port_no, VTSS_PHY_EXTENDED_CONTROL_AND_STATUS, 0x0001, 0x0001));
-    VTSS_RC(vtss_phy_page_test(vtss_state, port_no));
-    VTSS_RC(PHY_WR_MASKED_PAGE(vtss_state, port_no, VTSS_PHY_TEST_PAGE_8, 0x8000, 0x8000));
-    VTSS_RC(vtss_phy_page_tr(vtss_state, port_no));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0068));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x8980));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x8f90));
+static const vtss_phy_script_op_t vtss_phy_script_elise_rev_a_ops[] = {
+    VTSS_PHY_SCRIPT_PAGE(VTSS_PHY_PAGE_STANDARD),
+    VTSS_PHY_SCRIPT_BCAST(TRUE),
+    VTSS_PHY_SCRIPT_PAGE(VTSS_PHY_PAGE_TEST),
+    VTSS_PHY_SCRIPT_WR_MASKED(VTSS_PHY_TEST_PAGE_8, 0x8000, 0x8000),
+    VTSS_PHY_SCRIPT_PAGE(VTSS_PHY_PAGE_TR),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0068),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x8980),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x8f90),
     /*- The following code was added for bug 13269 */
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x0003));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x8796));
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0000),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x0003),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x8796),
     // Work-around solution for bugzilla#6859
     //Our solution is to force the BlindSampleTimer to 0x080 by setting
     //BlindSampleTimerForce to '1' (bit 22) and BlindSampleTimerForceVal to 0x080
     //(bits 21:13) in register 0x3d in the AutoNegDbgNode.  This increases the time
     //to wait for the link to come up before allowing the crossover state to switch
     //to ~511 ms.
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0050));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x100f));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x87fa));
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0050),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x100f),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x87fa),
 
     /* EEE updates from James Bz#22266*/
 
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0012));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0xb002));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x8f82));
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0012),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0xb002),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x8f82),
 
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x0004));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x9686));
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0000),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x0004),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x9686),
 
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x00d2));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0xc46f));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x968c));
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x00d2),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0xc46f),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x968c),
 
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x0620));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x97a2));
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0000),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x0620),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x97a2),
 
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x00ee));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0xffdd));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x96a0));
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x00ee),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0xffdd),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x96a0),
 
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0007));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x1448));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x96a6));
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0007),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x1448),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x96a6),
 
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0013));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x132f));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x96a4));
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0013),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x132f),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x96a4),
 
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x0000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x96a8));
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0000),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x0000),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x96a8),
 
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x00c0));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0xa028));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x8ffc));
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x00c0),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0xa028),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x8ffc),
 
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0091));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0xb06c));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x8fe8));
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0091),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0xb06c),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x8fe8),
 
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0004));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x1600));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x8fea));
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0004),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x1600),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x8fea),
 
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x00ff));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0xfaff));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x8f80));
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x00ff),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0xfaff),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x8f80),
 
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0090));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x1809));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x8fec));
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0090),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x1809),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x8fec),
 
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x00b0));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x1007));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x8ffe));
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x00b0),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x1007),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x8ffe),
 
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x00ee));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0xff00));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x96b0));
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x00ee),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0xff00),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x96b0),
 
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x7000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x96b2));
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0000),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x7000),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x96b2),
 
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x0814));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x96b4));
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0000),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x0814),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x96b4),
 
 #ifndef VTSS_10BASE_TE
 #else //using 10BASE-Te
-    VTSS_RC(vtss_phy_page_ext2(vtss_state, port_no));
-    VTSS_RC(PHY_WR_MASKED_PAGE(vtss_state, port_no, 17, 0x8000, 0x8000));
-    VTSS_RC(vtss_phy_page_tr(vtss_state, port_no));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0008));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0xa499));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x8486));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0075));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0xf759));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x8488));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x0914));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x848a));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x00f7));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0xff7b));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x848c));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x0eb9));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x848e));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0061));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x85d6));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x8490));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0055));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x44d2));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x8492));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0044));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0xa8aa));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x8494));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x0cb9));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x8496));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x00f7));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0xff79));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x8498));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x0caa));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x849a));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0061));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x8618));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x849c));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x0618));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x849e));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x0018));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x84a0));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0061));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x848a));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x84a2));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x0000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x84a4));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x0000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x84a6));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x0000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x84a8));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x0000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x84aa));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0029));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x265d));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x84ac));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x007d));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0xd658));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x84ae));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0061));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x8618));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x84b0));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0061));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x8618));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x84b2));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0061));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x8618));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x84b4));
+    VTSS_PHY_SCRIPT_PAGE(VTSS_PHY_PAGE_EXTENDED_2),
+    VTSS_PHY_SCRIPT_WR_MASKED(17, 0x8000, 0x8000),
+    VTSS_PHY_SCRIPT_PAGE(VTSS_PHY_PAGE_TR),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0008),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0xa499),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x8486),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0075),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0xf759),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x8488),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0000),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x0914),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x848a),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x00f7),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0xff7b),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x848c),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0000),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x0eb9),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x848e),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0061),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x85d6),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x8490),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0055),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x44d2),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x8492),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0044),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0xa8aa),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x8494),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0000),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x0cb9),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x8496),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x00f7),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0xff79),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x8498),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0000),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x0caa),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x849a),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0061),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x8618),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x849c),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0000),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x0618),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x849e),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0000),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x0018),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x84a0),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0061),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x848a),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x84a2),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0000),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x0000),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x84a4),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0000),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x0000),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x84a6),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0000),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x0000),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x84a8),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0000),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x0000),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x84aa),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0029),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x265d),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x84ac),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x007d),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0xd658),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x84ae),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0061),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x8618),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x84b0),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0061),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x8618),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x84b2),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0061),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x8618),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x84b4),
 #endif
-    VTSS_RC(vtss_phy_page_test(vtss_state, port_no));
-    VTSS_RC(PHY_WR_MASKED_PAGE(vtss_state, port_no, VTSS_PHY_TEST_PAGE_8, 0x0000, 0x8000));
-    VTSS_RC(vtss_phy_page_std(vtss_state, port_no));
-    VTSS_RC(PHY_WR_MASKED_PAGE(vtss_state, port_no, VTSS_PHY_EXTENDED_CONTROL_AND_STATUS, 0x0000, 0x0001));
+    VTSS_PHY_SCRIPT_PAGE(VTSS_PHY_PAGE_TEST),
+    VTSS_PHY_SCRIPT_WR_MASKED(VTSS_PHY_TEST_PAGE_8, 0x0000, 0x8000),
+    VTSS_PHY_SCRIPT_PAGE(VTSS_PHY_PAGE_STANDARD),
+    VTSS_PHY_SCRIPT_BCAST(FALSE),
+};
 
-    return VTSS_RC_OK;
+static const vtss_phy_script_t vtss_phy_script_elise_rev_a = {
+    "elise_rev_a", vtss_phy_script_elise_rev_a_ops, VTSS_PHY_SCRIPT_OP_CNT(vtss_phy_script_elise_rev_a_ops)
+};
+
+/************************************************************************/
+/* ELISE family functions                                               */
+/************************************************************************/
+// Initialization needed for ELISE. (For whole chip and must be done before init. of the individual ports)
+//
+// In : port_no : Port number (MUST be the first port for the chip)..
+//
+// Return : VTSS_RC_OK if configuration done else error code.
+static vtss_rc vtss_phy_pre_init_seq_elise_rev_a(vtss_state_t *vtss_state, vtss_port_no_t port_no)
+{
+    return vtss_phy_script_run(vtss_state, port_no, &vtss_phy_script_elise_rev_a, 0);
 }
 
 // Initialization needed for Elise. (For whole chip and must be done before init. of the individual ports)
@@ -3454,197 +3651,257 @@ static vtss_rc vtss_phy_pre_init_seq_elise(vtss_state_t *vtss_state, vtss_port_n
     return VTSS_RC_OK;
 }
 
-/************************************************************************/
-/* NANO family functions                                                */
-/************************************************************************/
-// Initialization needed for NANO. (For whole chip and must be done before init. of the individual ports)
-//
-// In : port_no : Port number (MUST be the first port for the chip)..
-//
-// Return : VTSS_RC_OK if configuration done else error code.
-static vtss_rc vtss_phy_pre_init_seq_nano_rev_a(vtss_state_t *vtss_state, vtss_port_no_t port_no)
-{
-    VTSS_RC(vtss_phy_page_std(vtss_state, port_no));
-    VTSS_RC(PHY_WR_MASKED_PAGE(vtss_state, port_no, VTSS_PHY_EXTENDED_CONTROL_AND_STATUS, 0x0001, 0x0001)); // Reg 22, Turn on Broadcast Writes
-    VTSS_RC(vtss_phy_page_test(vtss_state, port_no));
-    VTSS_RC(PHY_WR_MASKED_PAGE(vtss_state, port_no, VTSS_PHY_TEST_PAGE_24, 0x0000, 0x0400));  // UNH 1.8.1 Clear bias bit for UNH 1000BT Distortion
-    VTSS_RC(PHY_WR_MASKED_PAGE(vtss_state, port_no, VTSS_PHY_TEST_PAGE_5, 0x0c00, 0x0e00));   // UNH 1.8.7 Optimize pre-emphasis for 100BaseTx UNH 100BW fix
-    VTSS_RC(PHY_WR_MASKED_PAGE(vtss_state, port_no, VTSS_PHY_TEST_PAGE_8, 0x8000, 0x8000));   // Enable Token-Ring during Coma Mode
-    VTSS_RC(vtss_phy_page_tr(vtss_state, port_no));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0068));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x8980));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x8f90));
+static const vtss_phy_script_op_t vtss_phy_script_nano_rev_a_ops[] = {
+    VTSS_PHY_SCRIPT_PAGE(VTSS_PHY_PAGE_STANDARD),
+    VTSS_PHY_SCRIPT_BCAST(TRUE), // Reg 22, Turn on Broadcast Writes
+    VTSS_PHY_SCRIPT_PAGE(VTSS_PHY_PAGE_TEST),
+    VTSS_PHY_SCRIPT_WR_MASKED(VTSS_PHY_TEST_PAGE_24, 0x0000, 0x0400), // UNH 1.8.1 Clear bias bit for UNH 1000BT Distortion
+    VTSS_PHY_SCRIPT_WR_MASKED(VTSS_PHY_TEST_PAGE_5, 0x0c00, 0x0e00), // UNH 1.8.7 Optimize pre-emphasis for 100BaseTx UNH 100BW fix
+    VTSS_PHY_SCRIPT_WR_MASKED(VTSS_PHY_TEST_PAGE_8, 0x8000, 0x8000), // Enable Token-Ring during Coma Mode
+    VTSS_PHY_SCRIPT_PAGE(VTSS_PHY_PAGE_TR),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0068),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x8980),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x8f90),
     /*- The following code was added for bug 13269 */
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x0003));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x8796));
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0000),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x0003),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x8796),
     // Work-around solution for bugzilla#6859
     //Our solution is to force the BlindSampleTimer to 0x080 by setting
     //BlindSampleTimerForce to '1' (bit 22) and BlindSampleTimerForceVal to 0x080
     //(bits 21:13) in register 0x3d in the AutoNegDbgNode.  This increases the time
     //to wait for the link to come up before allowing the crossover state to switch
     //to ~511 ms.
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0050));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x100f));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x87fa));
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0050),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x100f),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x87fa),
 
     /* EEE updates from James Bz#22266*/
 
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0012));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0xb002));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x8f82));
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0012),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0xb002),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x8f82),
 
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x0004));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x9686));
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0000),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x0004),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x9686),
 
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x00d2));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0xc46f));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x968c));
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x00d2),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0xc46f),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x968c),
 
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x0620));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x97a2));
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0000),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x0620),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x97a2),
 
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x00ee));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0xffdd));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x96a0));
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x00ee),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0xffdd),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x96a0),
 
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0007));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x1448));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x96a6));
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0007),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x1448),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x96a6),
 
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0013));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x132f));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x96a4));
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0013),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x132f),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x96a4),
 
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x0000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x96a8));
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0000),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x0000),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x96a8),
 
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x00c0));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0xa028));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x8ffc));
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x00c0),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0xa028),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x8ffc),
 
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0091));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0xb06c));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x8fe8));
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0091),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0xb06c),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x8fe8),
 
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0004));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x1600));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x8fea));
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0004),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x1600),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x8fea),
 
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x00ff));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0xfaff));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x8f80));
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x00ff),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0xfaff),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x8f80),
 
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0090));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x1809));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x8fec));
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0090),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x1809),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x8fec),
 
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x00b0));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x1007));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x8ffe));
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x00b0),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x1007),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x8ffe),
 
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x00ee));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0xff00));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x96b0));
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x00ee),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0xff00),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x96b0),
 
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x7000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x96b2));
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0000),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x7000),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x96b2),
 
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x0814));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x96b4));
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0000),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x0814),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x96b4),
 
 
 #ifndef VTSS_10BASE_TE
 #else //using 10BASE-Te
-    VTSS_RC(vtss_phy_page_ext2(vtss_state, port_no));
-    VTSS_RC(PHY_WR_MASKED_PAGE(vtss_state, port_no, 17, 0x8000, 0x8000));
-    VTSS_RC(vtss_phy_page_tr(vtss_state, port_no));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0008));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0xa499));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x8486));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0075));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0xf759));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x8488));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x0914));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x848a));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x00f7));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0xff7b));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x848c));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x0eb9));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x848e));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0061));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x85d6));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x8490));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0055));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x44d2));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x8492));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0044));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0xa8aa));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x8494));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x0cb9));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x8496));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x00f7));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0xff79));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x8498));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x0caa));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x849a));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0061));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x8618));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x849c));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x0618));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x849e));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x0018));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x84a0));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0061));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x848a));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x84a2));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x0000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x84a4));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x0000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x84a6));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x0000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x84a8));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x0000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x84aa));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0029));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x265d));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x84ac));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x007d));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0xd658));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x84ae));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0061));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x8618));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x84b0));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0061));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x8618));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x84b2));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0061));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x8618));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x84b4));
+    VTSS_PHY_SCRIPT_PAGE(VTSS_PHY_PAGE_EXTENDED_2),
+    VTSS_PHY_SCRIPT_WR_MASKED(17, 0x8000, 0x8000),
+    VTSS_PHY_SCRIPT_PAGE(VTSS_PHY_PAGE_TR),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0008),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0xa499),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x8486),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0075),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0xf759),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x8488),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0000),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x0914),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x848a),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x00f7),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0xff7b),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x848c),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0000),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x0eb9),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x848e),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0061),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x85d6),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x8490),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0055),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x44d2),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x8492),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0044),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0xa8aa),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x8494),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0000),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x0cb9),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x8496),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x00f7),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0xff79),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x8498),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0000),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x0caa),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x849a),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0061),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x8618),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x849c),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0000),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x0618),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x849e),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0000),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x0018),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x84a0),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0061),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x848a),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x84a2),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0000),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x0000),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x84a4),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0000),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x0000),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x84a6),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0000),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x0000),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x84a8),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0000),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x0000),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x84aa),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0029),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x265d),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x84ac),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x007d),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0xd658),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x84ae),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0061),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x8618),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x84b0),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0061),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x8618),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x84b2),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0061),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x8618),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x84b4),
 #endif
-    VTSS_RC(vtss_phy_page_test(vtss_state, port_no));
-    VTSS_RC(PHY_WR_MASKED_PAGE(vtss_state, port_no, VTSS_PHY_TEST_PAGE_8, 0x0000, 0x8000)); // Disable Token-Ring during Coma Mode
-    VTSS_RC(vtss_phy_page_std(vtss_state, port_no));
-    VTSS_RC(PHY_WR_MASKED_PAGE(vtss_state, port_no, VTSS_PHY_EXTENDED_CONTROL_AND_STATUS, 0x0000, 0x0001)); // Turn off Broadcast Writes
+    VTSS_PHY_SCRIPT_PAGE(VTSS_PHY_PAGE_TEST),
+    VTSS_PHY_SCRIPT_WR_MASKED(VTSS_PHY_TEST_PAGE_8, 0x0000, 0x8000), // Disable Token-Ring during Coma Mode
+    VTSS_PHY_SCRIPT_PAGE(VTSS_PHY_PAGE_STANDARD),
+    VTSS_PHY_SCRIPT_BCAST(FALSE), // Turn off Broadcast Writes
+};
 
-    return VTSS_RC_OK;
+static const vtss_phy_script_t vtss_phy_script_nano_rev_a = {
+    "nano_rev_a", vtss_phy_script_nano_rev_a_ops, VTSS_PHY_SCRIPT_OP_CNT(vtss_phy_script_nano_rev_a_ops)
+};
+
+/************************************************************************/
+/* NANO family functions                                                */
+/************************************************************************/
+// Initialization needed for NANO. (For whole chip and must be done before init. of the individual ports)
+//
+// In : port_no : Port number (MUST be the first port for the chip)..
+//
+// Return : VTSS_RC_OK if configuration done else error code.
+static vtss_rc vtss_phy_pre_init_seq_nano_rev_a(vtss_state_t *vtss_state, vtss_port_no_t port_no)
+{
+    return vtss_phy_script_run(vtss_state, port_no, &vtss_phy_script_nano_rev_a, 0);
 }
 
+static const vtss_phy_script_op_t vtss_phy_script_nano_7435_ops[] = {
+    VTSS_PHY_SCRIPT_PAGE(VTSS_PHY_PAGE_STANDARD),
+    VTSS_PHY_SCRIPT_BCAST(TRUE), // Reg 22, Turn on Broadcast Writes
+    VTSS_PHY_SCRIPT_PAGE(VTSS_PHY_PAGE_TEST),
+    VTSS_PHY_SCRIPT_WR_MASKED(VTSS_PHY_TEST_PAGE_5, 0x0c00, 0x0e00), // UNH 1.8.7 Optimize pre-emphasis for 100BaseTx UNH 100BW fix
+    VTSS_PHY_SCRIPT_WR_MASKED(VTSS_PHY_TEST_PAGE_24, 0x0000, 0x0600), // UNH 1.8.1 Clear bias bit for UNH 1000BT Distortion
+    VTSS_PHY_SCRIPT_WR_MASKED(VTSS_PHY_TEST_PAGE_8, 0x8000, 0x8000), // Enable Token-Ring during Coma Mode
+    VTSS_PHY_SCRIPT_PAGE(VTSS_PHY_PAGE_TR),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0008),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0xa518),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x8486),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x006d),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0xc696),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x8488),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0000),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x0912),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x848a),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x00c3),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0xff98),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x87f8),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0050),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x100f),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x87fa),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0000),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x0704),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x87fe),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0000),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x0003),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x8796),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0000),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0xa0f0),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x83a4),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0004),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x9f81),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x9688),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0000),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x0400),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x8fc0),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0068),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0x8980),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x8f90),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_18, 0x0004),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_17, 0xaf54),
+    VTSS_PHY_SCRIPT_WR(VTSS_PHY_PAGE_TR_16, 0x8fe4),
+    VTSS_PHY_SCRIPT_PAGE(VTSS_PHY_PAGE_TEST),
+    VTSS_PHY_SCRIPT_WR_MASKED(VTSS_PHY_TEST_PAGE_8, 0x0000, 0x8000), // Disable Token-Ring during Coma Mode
+    VTSS_PHY_SCRIPT_PAGE(VTSS_PHY_PAGE_STANDARD),
+    VTSS_PHY_SCRIPT_BCAST(FALSE), // Turn off Broadcast Writes
+};
+
+static const vtss_phy_script_t vtss_phy_script_nano_7435 = {
+    "nano_7435", vtss_phy_script_nano_7435_ops, VTSS_PHY_SCRIPT_OP_CNT(vtss_phy_script_nano_7435_ops)
+};
+
 /************************************************************************/
 /* Serval_T-NANO Init Scripts                                           */
 /************************************************************************/
@@ -3656,55 +3913,7 @@ static vtss_rc vtss_phy_pre_init_seq_nano_rev_a(vtss_state_t *vtss_state, vtss_p
 // Return : VTSS_RC_OK if configuration done else error code.
 vtss_rc vtss_phy_pre_init_seq_nano_7435(vtss_state_t *vtss_state, vtss_port_no_t port_no)
 {
-    VTSS_RC(vtss_phy_page_std(vtss_state, port_no));
-    VTSS_RC(PHY_WR_MASKED_PAGE(vtss_state, port_no, VTSS_PHY_EXTENDED_CONTROL_AND_STATUS, 0x0001, 0x0001)); // Reg 22, Turn on Broadcast Writes
-    VTSS_RC(vtss_phy_page_test(vtss_state, port_no));
-    VTSS_RC(PHY_WR_MASKED_PAGE(vtss_state, port_no, VTSS_PHY_TEST_PAGE_5, 0x0c00, 0x0e00));   // UNH 1.8.7 Optimize pre-emphasis for 100BaseTx UNH 100BW fix
-    VTSS_RC(PHY_WR_MASKED_PAGE(vtss_state, port_no, VTSS_PHY_TEST_PAGE_24, 0x0000, 0x0600));  // UNH 1.8.1 Clear bias bit for UNH 1000BT Distortion
-    VTSS_RC(PHY_WR_MASKED_PAGE(vtss_state, port_no, VTSS_PHY_TEST_PAGE_8, 0x8000, 0x8000));   // Enable Token-Ring during Coma Mode
-    VTSS_RC(vtss_phy_page_tr(vtss_state, port_no));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0008));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0xa518));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x8486));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x006d));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0xc696));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x8488));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x0912));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x848a));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x00c3));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0xff98));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x87f8));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0050));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x100f));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x87fa));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x0704));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x87fe));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x0003));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x8796));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0xa0f0));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x83a4));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0004));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x9f81));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x9688));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0000));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x0400));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x8fc0));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0068));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0x8980));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x8f90));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_18, 0x0004));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_17, 0xaf54));
-    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_TR_16, 0x8fe4));
-    VTSS_RC(vtss_phy_page_test(vtss_state, port_no));
-    VTSS_RC(PHY_WR_MASKED_PAGE(vtss_state, port_no, VTSS_PHY_TEST_PAGE_8, 0x0000, 0x8000)); // Disable Token-Ring during Coma Mode
-    VTSS_RC(vtss_phy_page_std(vtss_state, port_no));
-    VTSS_RC(PHY_WR_MASKED_PAGE(vtss_state, port_no, VTSS_PHY_EXTENDED_CONTROL_AND_STATUS, 0x0000, 0x0001)); // Turn off Broadcast Writes
-
-    return VTSS_RC_OK;
+    return vtss_phy_script_run(vtss_state, port_no, &vtss_phy_script_nano_7435, 0);
 }
 
 
@@ -3787,6 +3996,42 @@ vtss_rc vtss_phy_pre_reset_private(vtss_state_t *vtss_state, const vtss_port_no_
     return rc;
 }
 
+// The table driven init scripts, per family and revision
+static const struct {
+    vtss_phy_family_t       family;
+    u16                     revision;
+    const vtss_phy_script_t *script;
+} vtss_phy_script_tbl[] = {
+    {VTSS_PHY_FAMILY_ATOM,  VTSS_PHY_ATOM_REV_C,  &vtss_phy_script_atom_rev_cd},
+    {VTSS_PHY_FAMILY_ATOM,  VTSS_PHY_ATOM_REV_D,  &vtss_phy_script_atom_rev_cd},
+    {VTSS_PHY_FAMILY_TESLA, VTSS_PHY_TESLA_REV_D, &vtss_phy_script_tesla_rev_d},
+    {VTSS_PHY_FAMILY_TESLA, VTSS_PHY_TESLA_REV_E, &vtss_phy_script_tesla_rev_e},
+    {VTSS_PHY_FAMILY_VIPER, VTSS_PHY_VIPER_REV_A, &vtss_phy_script_viper_rev_a},
+    {VTSS_PHY_FAMILY_VIPER, VTSS_PHY_VIPER_REV_B, &vtss_phy_script_viper_rev_b},
+    {VTSS_PHY_FAMILY_ELISE, VTSS_PHY_ELISE_REV_A, &vtss_phy_script_elise_rev_a},
+    {VTSS_PHY_FAMILY_NANO,  VTSS_PHY_NANO_REV_A,  &vtss_phy_script_nano_rev_a},
+    {VTSS_PHY_FAMILY_NANO,  VTSS_PHY_NANO_REV_A,  &vtss_phy_script_nano_7435},
+};
+
+// Print the register accesses of the table driven init scripts. The MDIO column is the
+// number of MDIO transactions, page selects included.
+void vtss_phy_script_debug_print(const vtss_debug_printf_t pr)
+{
+    vtss_phy_script_cnt_t cnt;
+    u32                   i;
+
+    pr("%-9s %-4s %-12s %-5s %-7s %-9s %-5s %-5s %-5s\n", "Family", "Rev", "Script", "Ops", "Page Wr", "Page Skip", "Rd", "Wr", "MDIO");
+    pr("%-9s %-4s %-12s %-5s %-7s %-9s %-5s %-5s %-5s\n", "---------", "----", "------------", "-----", "-------", "---------", "-----", "-----", "-----");
+    for (i = 0; i < sizeof(vtss_phy_script_tbl) / sizeof(vtss_phy_script_tbl[0]); i++) {
+        if (vtss_phy_script_walk(NULL, 0, vtss_phy_script_tbl[i].script, vtss_phy_script_tbl[i].revision, &cnt) != VTSS_RC_OK) {
+            continue;
+        }
+        pr("%-9s %-4u %-12s %-5u %-7u %-9u %-5u %-5u %-5u\n",
+           vtss_phy_family2txt(vtss_phy_script_tbl[i].family), vtss_phy_script_tbl[i].revision,
+           vtss_phy_script_tbl[i].script->name, cnt.ops, cnt.page_wr, cnt.page_skip, cnt.rd, cnt.wr,
+           cnt.page_wr + cnt.rd + cnt.wr);
+    }
+}
 
 #endif
 
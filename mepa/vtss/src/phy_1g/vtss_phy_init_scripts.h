@@ -25,6 +25,7 @@ vtss_rc vtss_phy_is_8051_crc_ok_private (struct vtss_state_s *vtss_state,
                                          BOOL first_time);
 
 const char *vtss_phy_family2txt(vtss_phy_family_t family);
+void vtss_phy_script_debug_print(const vtss_debug_printf_t pr);
 
 vtss_rc vtss_phy_init_seq_blazer(struct vtss_state_s *vtss_state,
                                  vtss_phy_port_state_t *ps,
@@ -1231,45 +1231,54 @@ static vtss_rc vtss_phy_ewis_path_acti_get(vtss_state_t *vtss_state,
     return VTSS_RC_OK;
 }
 
-static vtss_rc vtss_phy_ewis_perf_get(vtss_state_t *vtss_state,
-                                      vtss_port_no_t port_no, vtss_ewis_perf_t *const perf)
+/* Read cnt consecutive registers starting at addr */
+static vtss_rc vtss_phy_ewis_block_read(vtss_state_t         *vtss_state,
+                                        const vtss_port_no_t port_no,
+                                        const u16            mmd,
+                                        const u32            addr,
+                                        const u32            cnt,
+                                        u16                  *value)
 {
-    u16 lsw = 0x0000, msw = 0x0000;
-
-
-    /* E-WIS S-BIP Error Counter 1 (MSW) (2xECB0) */
-    VTSS_RC(vtss_phy_ewis_read(vtss_state, port_no, MMD_WIS, 0xECB0, &msw));
-    /* E-WIS S-BIP Error Counter 0 (LSW) (2xECB1) */
-    VTSS_RC(vtss_phy_ewis_read(vtss_state, port_no, MMD_WIS, 0xECB1, &lsw));
-    perf->pn_ebc_s = ((msw << 16) | lsw);
-
-    /* E-WIS L-BIP Error Counter 1 (MSW) (2xECB2) */
-    VTSS_RC(vtss_phy_ewis_read(vtss_state, port_no, MMD_WIS, 0xECB2, &msw));
-    /* E-WIS L-BIP Error Counter 0 (LSW) (2xECB3) */
-    VTSS_RC(vtss_phy_ewis_read(vtss_state, port_no, MMD_WIS, 0xECB3, &lsw));
-    perf->pn_ebc_l = ((msw << 16) | lsw);
-
-    /* E-WIS L-REI Counter 1 (MSW) (2xEC90) */
-    VTSS_RC(vtss_phy_ewis_read(vtss_state, port_no, MMD_WIS, 0xEC90, &msw));
-    /* E-WIS L-REI Counter 0 (LSW) (2xEC91)  */
-    VTSS_RC(vtss_phy_ewis_read(vtss_state, port_no, MMD_WIS, 0xECB5, &lsw));
-    perf->pf_ebc_l = ((msw << 16) | lsw);
-
-    /* E-WIS P-BIP Error Counter 1 (MSW) (2xECB4) */
-    VTSS_RC(vtss_phy_ewis_read(vtss_state, port_no, MMD_WIS, 0xECB4, &msw));
-    /* E-WIS P-BIP Error Counter 0 (LSW) (2xECB5) */
-    VTSS_RC(vtss_phy_ewis_read(vtss_state, port_no, MMD_WIS, 0xECB5, &lsw));
-    perf->pn_ebc_p = ((msw << 16) | lsw);
-
-    /* E-WIS P-REI Counter 1 (MSW) (2xEC80) */
-    VTSS_RC(vtss_phy_ewis_read(vtss_state, port_no, MMD_WIS, 0xEC80, &msw));
-    /* E-WIS P-REI Counter 0 (LSW) (2xEC81) */
-    VTSS_RC(vtss_phy_ewis_read(vtss_state, port_no, MMD_WIS, 0xEC81, &lsw));
-    perf->pf_ebc_p = ((msw << 16) | lsw);
+    u32 i;
 
+    for (i = 0; i < cnt; i++) {
+        VTSS_RC(vtss_phy_ewis_read(vtss_state, port_no, mmd, addr + i, &value[i]));
+    }
     return VTSS_RC_OK;
 }
 
+static vtss_rc vtss_phy_ewis_perf_read(vtss_state_t *vtss_state,
+                                       vtss_port_no_t port_no, vtss_ewis_perf_t *const perf)
+{
+    u16 bip[6], reil[2], reip[2];
+
+    /* E-WIS S/L/P-BIP Error Counters, MSW before LSW (2xECB0 - 2xECB5) */
+    VTSS_RC(vtss_phy_ewis_block_read(vtss_state, port_no, MMD_WIS, 0xECB0, 6, bip));
+    /* E-WIS L-REI Counter 1 (MSW) and 0 (LSW) (2xEC90 - 2xEC91) */
+    VTSS_RC(vtss_phy_ewis_block_read(vtss_state, port_no, MMD_WIS, 0xEC90, 2, reil));
+    /* E-WIS P-REI Counter 1 (MSW) and 0 (LSW) (2xEC80 - 2xEC81) */
+    VTSS_RC(vtss_phy_ewis_block_read(vtss_state, port_no, MMD_WIS, 0xEC80, 2, reip));
+
+    perf->pn_ebc_s = (((u32)bip[0] << 16) | bip[1]);
+    perf->pn_ebc_l = (((u32)bip[2] << 16) | bip[3]);
+    perf->pn_ebc_p = (((u32)bip[4] << 16) | bip[5]);
+    perf->pf_ebc_l = (((u32)reil[0] << 16) | reil[1]);
+    perf->pf_ebc_p = (((u32)reip[0] << 16) | reip[1]);
+
+    return VTSS_RC_OK;
+}
+
+static vtss_rc vtss_phy_ewis_perf_get(vtss_state_t *vtss_state,
+                                      vtss_port_no_t port_no, vtss_ewis_perf_t *const perf)
+{
+    /* The PM engine owns the per second registers while it is running */
+    if (vtss_state->ewis_pm[port_no].pm.enable) {
+        *perf = vtss_state->ewis_pm[port_no].pm.last;
+        return VTSS_RC_OK;
+    }
+    return vtss_phy_ewis_perf_read(vtss_state, port_no, perf);
+}
+
 static vtss_rc vtss_phy_ewis_counter_get(vtss_state_t *vtss_state,
                                          vtss_port_no_t port_no, vtss_ewis_counter_t *const counter)
 {
@@ -1354,6 +1363,89 @@ static vtss_rc vtss_phy_ewis_counter_threshold_set(vtss_state_t *vtss_state,
     return VTSS_RC_OK;
 }
 
+#define VTSS_EWIS_PM_THRESH_EV (VTSS_PHY_EWIS_B1_THRESH_EV | VTSS_PHY_EWIS_B2_THRESH_EV | VTSS_PHY_EWIS_B3_THRESH_EV | \
+                                VTSS_PHY_EWIS_REIL_THRESH_EV | VTSS_PHY_EWIS_REIP_THRESH_EV)
+#define VTSS_EWIS_PM_SKIP_MAX  10  /* Read the counters at least every 10 seconds */
+#define VTSS_EWIS_PM_15MIN     (15 * 60)
+#define VTSS_EWIS_PM_24H       (24 * 60 * 60)
+
+static BOOL vtss_phy_ewis_pm_defect_any(const vtss_ewis_defects_t *def)
+{
+    return (def->dlos_s || def->doof_s || def->dlof_s || def->dais_l || def->drdi_l || def->dais_p ||
+            def->dlop_p || def->duneq_p || def->drdi_p || def->dlcd_p || def->dplm_p ||
+            def->dfais_p || def->dfplm_p || def->dfuneq_p);
+}
+
+static BOOL vtss_phy_ewis_pm_bin_update(vtss_ewis_pm_bin_t *bin, const vtss_ewis_perf_t *perf,
+                                        const vtss_ewis_defects_t *def, BOOL skipped)
+{
+    BOOL es_s, es_l, es_p, fes_l, fes_p;
+
+    es_s = (perf->pn_ebc_s || def->dlos_s || def->dlof_s);
+    es_l = (perf->pn_ebc_l || def->dais_l || def->dlos_s || def->dlof_s);
+    es_p = (perf->pn_ebc_p || def->dais_p || def->dlop_p || def->dlcd_p || def->dplm_p || def->duneq_p);
+    fes_l = (perf->pf_ebc_l || def->drdi_l);
+    fes_p = (perf->pf_ebc_p || def->drdi_p || def->dfais_p || def->dfplm_p || def->dfuneq_p);
+
+    bin->perf.pn_ebc_s += perf->pn_ebc_s;
+    bin->perf.pn_ebc_l += perf->pn_ebc_l;
+    bin->perf.pf_ebc_l += perf->pf_ebc_l;
+    bin->perf.pn_ebc_p += perf->pn_ebc_p;
+    bin->perf.pf_ebc_p += perf->pf_ebc_p;
+    bin->es_s += es_s;
+    bin->es_l += es_l;
+    bin->es_p += es_p;
+    bin->fes_l += fes_l;
+    bin->fes_p += fes_p;
+    bin->skipped += skipped;
+    bin->secs++;
+
+    return (es_s || es_l || es_p || fes_l || fes_p);
+}
+
+static vtss_rc vtss_phy_ewis_pm_tick(vtss_state_t *vtss_state,
+                                     const vtss_port_no_t port_no)
+{
+    vtss_ewis_pm_state_t *pms = &vtss_state->ewis_pm[port_no];
+    vtss_ewis_pm_t       *pm = &pms->pm;
+    BOOL                 idle, errored;
+
+    if (!pm->enable) {
+        VTSS_E("port_no %u, PM engine not enabled", port_no);
+        return VTSS_RC_ERROR;
+    }
+
+    /* Defects are sampled every second, so the start of a defect is never missed */
+    VTSS_RC(vtss_phy_ewis_defects_get(vtss_state, port_no, &pm->defects));
+
+    /* With all threshold events enabled, the counters of a quiet error free port do not need to be read */
+    idle = ((vtss_state->phy_10g_state[port_no].ev_mask & VTSS_EWIS_PM_THRESH_EV) == VTSS_EWIS_PM_THRESH_EV &&
+            pms->ev_latch == 0 && !pms->errored && !vtss_phy_ewis_pm_defect_any(&pm->defects) &&
+            pms->skip_cnt < VTSS_EWIS_PM_SKIP_MAX);
+    pms->ev_latch = 0;
+    if (idle) {
+        memset(&pm->last, 0, sizeof(pm->last));
+        pms->skip_cnt++;
+    } else {
+        VTSS_RC(vtss_phy_ewis_perf_read(vtss_state, port_no, &pm->last));
+        pms->skip_cnt = 0;
+    }
+
+    errored = vtss_phy_ewis_pm_bin_update(&pm->cur_15min, &pm->last, &pm->defects, idle);
+    (void)vtss_phy_ewis_pm_bin_update(&pm->cur_24h, &pm->last, &pm->defects, idle);
+    pms->errored = errored;
+
+    if (pm->cur_15min.secs >= VTSS_EWIS_PM_15MIN) {
+        pm->prev_15min = pm->cur_15min;
+        memset(&pm->cur_15min, 0, sizeof(pm->cur_15min));
+    }
+    if (pm->cur_24h.secs >= VTSS_EWIS_PM_24H) {
+        pm->prev_24h = pm->cur_24h;
+        memset(&pm->cur_24h, 0, sizeof(pm->cur_24h));
+    }
+    return VTSS_RC_OK;
+}
+
 static const vtss_ewis_cons_act_t act_default = {
     .aisl = {
         .ais_on_los       = FALSE,
@@ -1476,6 +1568,7 @@ vtss_rc vtss_phy_inst_ewis_create(vtss_state_t *vtss_state)
     func->ewis_perf_get               = vtss_phy_ewis_perf_get;
     func->ewis_counter_get            = vtss_phy_ewis_counter_get;
     func->ewis_counter_threshold_set  = vtss_phy_ewis_counter_threshold_set;
+    func->ewis_pm_tick                = vtss_phy_ewis_pm_tick;
 
     for (port_no = 0 ; port_no < VTSS_PORT_ARRAY_SIZE; port_no++) {
         vtss_state->ewis_conf[port_no].static_conf = static_default;
@@ -1152,6 +1152,7 @@ vtss_rc vtss_phy_ts_read_csr(vtss_state_t *vtss_state,
 //            VTSS_D("Read CSR: port %u, blk_id %d, adr %x, value %x", port_no, blk_id, csr_address, *value);
         } else {
             /* 1588 - Page Selection */
+            vtss_phy_page_invalidate(vtss_state, cfg_port);
             VTSS_RC(miim_write_func(vtss_state, cfg_port, VTSS_PHY_TS_1G_ADDR_EXT_REG, 0x1588));
 
             reg_value = (VTSS_PHY_TS_1G_BIU_ADDR_REG_EXE_CMD  |
@@ -1212,6 +1213,7 @@ vtss_rc vtss_phy_ts_write_csr(vtss_state_t *vtss_state,
     BOOL                       gen = FALSE;
 
     VTSS_D("Write CSR: port %u, blk_id %d, adr %x, value %x", port_no, blk_id, csr_address, *value);
+    vtss_state->phy_ts_port_conf[port_no].csr_wr_cnt++;
 
 #if defined(VTSS_CHIP_10G_PHY) || defined(VTSS_CHIP_CU_PHY)
     u16                        reg_value_upper, reg_value_lower;
@@ -1420,6 +1422,7 @@ vtss_rc vtss_phy_ts_write_csr(vtss_state_t *vtss_state,
             VTSS_RC(miim_read_func(vtss_state, cfg_port, VTSS_PHY_TS_1G_CSR_DATA_UPPER, &base_reg_value));
 
             /* 1588 - Page Selection */
+            vtss_phy_page_invalidate(vtss_state, cfg_port);
             VTSS_RC(miim_write_func(vtss_state, cfg_port, VTSS_PHY_TS_1G_ADDR_EXT_REG, 0x1588));
 
             /* Write the upper word data (upper 16 bits) to register 18 */
@@ -1862,6 +1865,7 @@ static vtss_rc vtss_phy_ts_block_init(vtss_state_t *vtss_state, const vtss_port_
     case VTSS_PHY_TYPE_8586:
         /* initial setup of extended register 29 and 30 in 1588 extended page */
         /* 1588 - Page Selection */
+        vtss_phy_page_invalidate(vtss_state, base_port_no);
         VTSS_RC(vtss_state->init_conf.miim_write(vtss_state, base_port_no, VTSS_PHY_TS_1G_ADDR_EXT_REG, 0x1588));
         /* Write the lower word data to register 29 */
         VTSS_RC(vtss_state->init_conf.miim_write(vtss_state, base_port_no, 29, 0x7ae0));
@@ -6576,6 +6580,28 @@ typedef struct {
     const u8                      flow_end_index;
 } vtss_ts_engine_parm_t;
 
+/* Number of VLAN match registers written per Ethernet flow:
+   MATCH_MODE, VLAN_TAG_RANGE_I_TAG, VLAN_TAG1 and VLAN_TAG2_I_TAG */
+#define VTSS_PHY_TS_ETH_VLAN_REG_CNT 4
+
+/* Delta programming: the VLAN match registers of a flow only need to be written
+   when the flow or the PBB mode has changed since they were last written */
+static BOOL vtss_phy_ts_eth_vlan_unchanged(vtss_state_t                 *vtss_state,
+                                           const vtss_ts_engine_parm_t  *const eng_parm,
+                                           const vtss_phy_ts_eng_conf_t *const eng_conf,
+                                           const vtss_phy_ts_eth_conf_t *const old_eth_conf,
+                                           const vtss_phy_ts_eth_conf_t *const new_eth_conf,
+                                           u32                          flow)
+{
+    if ((eng_conf->vlan_prog_mask & (1 << flow)) == 0 ||
+        old_eth_conf->comm_opt.pbb_en != new_eth_conf->comm_opt.pbb_en ||
+        memcmp(&old_eth_conf->flow_opt[flow], &new_eth_conf->flow_opt[flow], sizeof(vtss_phy_ts_eth_flow_conf_t))) {
+        return FALSE;
+    }
+    vtss_state->phy_ts_port_conf[eng_parm->port_no].csr_wr_saved += VTSS_PHY_TS_ETH_VLAN_REG_CNT;
+    return TRUE;
+}
+
 typedef enum {
     VTSS_PHY_TS_NEXT_COMP_NONE    = 0,
     VTSS_PHY_TS_NEXT_COMP_ETH2    = 1,
@@ -7598,6 +7624,9 @@ static vtss_rc vtss_phy_ts_eth1_flow_conf_set_priv(
                has different config based on combination of number of tag, tag_type
                and tag range. So it's better to set these reg everytime flow config
                is set. This will be set only for enabled flow */
+            if (vtss_phy_ts_eth_vlan_unchanged(vtss_state, eng_parm, eng_conf, old_eth_conf, new_eth_conf, i)) {
+                continue;
+            }
             /* ETH1_MATCH_MODE */
             VTSS_RC(VTSS_PHY_TS_READ_CSR(port_no, blk_id, VTSS_ANA_ETH1_FLOW_CFG_ETH1_MATCH_MODE(i), &match_mode_val));
             temp = VTSS_F_ANA_ETH1_FLOW_CFG_ETH1_MATCH_MODE_ETH1_VLAN_TAGS(new_eth_conf->flow_opt[i].num_tag);
@@ -7853,6 +7882,9 @@ static vtss_rc vtss_phy_ts_eth1_flow_conf_set_priv(
                has different config based on combination of number of tag, tag_type
                and tag range. So it's better to set these reg everytime flow config
                is set. This will be set only for enabled flow */
+            if (vtss_phy_ts_eth_vlan_unchanged(vtss_state, eng_parm, eng_conf, old_eth_conf, new_eth_conf, i)) {
+                continue;
+            }
             /* ETH1_MATCH_MODE */
             VTSS_RC(VTSS_PHY_TS_READ_CSR(port_no, blk_id, VTSS_ANA_OAM_ETH1_FLOW_CFG_ETH1_MATCH_MODE(i), &match_mode_val));
             temp = VTSS_F_ANA_OAM_ETH1_FLOW_CFG_ETH1_MATCH_MODE_ETH1_VLAN_TAGS(new_eth_conf->flow_opt[i].num_tag);
@@ -8161,6 +8193,9 @@ static vtss_rc vtss_phy_ts_eth2_flow_conf_set_priv(
                has different config based on combination of number of tag, tag_type
                and tag range. So it's better to set these reg everytime flow config
                is set. This will be set only for enabled flow */
+            if (vtss_phy_ts_eth_vlan_unchanged(vtss_state, eng_parm, eng_conf, old_eth_conf, new_eth_conf, i)) {
+                continue;
+            }
             /* ETH2_MATCH_MODE */
             VTSS_RC(VTSS_PHY_TS_READ_CSR(port_no, blk_id, VTSS_ANA_ETH2_FLOW_CFG_ETH2_MATCH_MODE(i), &match_mode_val));
             temp = VTSS_F_ANA_ETH2_FLOW_CFG_ETH2_MATCH_MODE_ETH2_VLAN_TAGS(new_eth_conf->flow_opt[i].num_tag);
@@ -8363,6 +8398,9 @@ static vtss_rc vtss_phy_ts_eth2_flow_conf_set_priv(
                has different config based on combination of number of tag, tag_type
                and tag range. So it's better to set these reg everytime flow config
                is set. This will be set only for enabled flow */
+            if (vtss_phy_ts_eth_vlan_unchanged(vtss_state, eng_parm, eng_conf, old_eth_conf, new_eth_conf, i)) {
+                continue;
+            }
             /* ETH2_MATCH_MODE */
             VTSS_RC(VTSS_PHY_TS_READ_CSR(port_no, blk_id, VTSS_ANA_OAM_ETH2_FLOW_CFG_ETH2_MATCH_MODE(i), &match_mode_val));
             temp = VTSS_F_ANA_OAM_ETH2_FLOW_CFG_ETH2_MATCH_MODE_ETH2_VLAN_TAG_MODE(new_eth_conf->flow_opt[i].tag_range_mode);
@@ -10182,6 +10220,9 @@ static vtss_rc vtss_phy_ts_engine_init_priv(
     /* reset flow_conf and action_conf */
     memset(flow_conf, 0, sizeof(vtss_phy_ts_engine_flow_conf_t));
     memset(action_conf, 0, sizeof(vtss_phy_ts_engine_action_t));
+    /* nothing is programmed yet, so delta programming must write everything */
+    base_port_eng_conf->vlan_prog_mask = 0;
+    memset(base_port_eng_conf->ptp_action_wr_cnt, 0, sizeof(base_port_eng_conf->ptp_action_wr_cnt));
 
     /* By default all the flows are associated with init port */
     for (i = flow_st_index; i <= flow_end_index; i++) {
@@ -11783,6 +11824,7 @@ vtss_rc vtss_phy_ts_ingress_engine_clear(const vtss_inst_t  inst,
 
         /* clear the engine config */
         memset(flow_conf, 0, sizeof(vtss_phy_ts_engine_flow_conf_t));
+        eng_conf->vlan_prog_mask = 0;
         eng_conf->eng_used = FALSE;
         eng_conf->flow_st_index = 0;
         eng_conf->flow_end_index = 0;
@@ -11973,6 +12015,7 @@ vtss_rc vtss_phy_ts_egress_engine_clear(const vtss_inst_t  inst,
                                                         bport, eng_id));
         /* clear the engine config */
         memset(flow_conf, 0, sizeof(vtss_phy_ts_engine_flow_conf_t));
+        eng_conf->vlan_prog_mask = 0;
         eng_conf->eng_used = FALSE;
         eng_conf->flow_st_index = 0;
         eng_conf->flow_end_index = 0;
@@ -12275,6 +12318,15 @@ static vtss_rc vtss_phy_ts_engine_flow_set_priv(
         break;
     }
 
+    /* The VLAN match registers of all flows now follow new_flow_conf. If the
+       configuration failed half way, force a full rewrite on the next call */
+    eng_conf->vlan_prog_mask = 0;
+    if (rc == VTSS_RC_OK) {
+        for (i = eng_parm->flow_st_index; i <= eng_parm->flow_end_index; i++) {
+            eng_conf->vlan_prog_mask |= (1 << i);
+        }
+    }
+
     /* enable the engine if it say so in conf: for engine 2A or 2B
        if other engine is enable and disable at the beginning of config
        we need to enable the whole OAM engine */
@@ -15106,6 +15158,66 @@ static vtss_rc vtss_phy_ts_gen_action_def_conf_priv(
     return VTSS_RC_OK;
 }
 
+/* Delta programming of a PTP action where only the domain match has changed:
+   rewrite the domain words of the flows mapped to the action instead of
+   deleting and re-adding all of them */
+static vtss_rc vtss_phy_ts_engine_ptp_action_domain_set_priv(
+    vtss_state_t *vtss_state,
+    const vtss_port_no_t                  port_no,
+    const vtss_phy_ts_blk_id_t            blk_id,
+    const vtss_phy_ts_eng_conf_t          *const eng_conf,
+    const vtss_phy_ts_ptp_conf_t          *const old_ptp_conf,
+    const vtss_phy_ts_ptp_conf_t          *const new_ptp_conf,
+    const u8                              action_id)
+{
+    u32 value, j;
+
+    for (j = 0; j < 6; j++) {
+        if (eng_conf->action_flow_map[j] != (action_id + 1)) {
+            continue;
+        }
+        if (new_ptp_conf->range_en) {
+            value = VTSS_F_ANA_PTP_FLOW_PTP_DOMAIN_RANGE_PTP_DOMAIN_RANGE_ENA;
+            value |= VTSS_F_ANA_PTP_FLOW_PTP_DOMAIN_RANGE_PTP_DOMAIN_RANGE_OFFSET(4);
+            value |= VTSS_F_ANA_PTP_FLOW_PTP_DOMAIN_RANGE_PTP_DOMAIN_RANGE_UPPER(new_ptp_conf->domain.range.upper);
+            value |= VTSS_F_ANA_PTP_FLOW_PTP_DOMAIN_RANGE_PTP_DOMAIN_RANGE_LOWER(new_ptp_conf->domain.range.lower);
+            VTSS_RC(VTSS_PHY_TS_WRITE_CSR(port_no, blk_id, VTSS_ANA_PTP_FLOW_PTP_DOMAIN_RANGE(j), &value));
+            continue;
+        }
+        /* PTP_FLOW_MATCH_LOWER: domain number which will be MB byte */
+        if (old_ptp_conf->domain.value.mask != new_ptp_conf->domain.value.mask) {
+            VTSS_RC(VTSS_PHY_TS_READ_CSR(port_no, blk_id, VTSS_ANA_PTP_FLOW_PTP_FLOW_MASK_LOWER(j), &value));
+            value = (value & 0x00FFFFFF) | (new_ptp_conf->domain.value.mask << 24);
+            VTSS_RC(VTSS_PHY_TS_WRITE_CSR(port_no, blk_id, VTSS_ANA_PTP_FLOW_PTP_FLOW_MASK_LOWER(j), &value));
+        }
+        if (old_ptp_conf->domain.value.val != new_ptp_conf->domain.value.val) {
+            VTSS_RC(VTSS_PHY_TS_READ_CSR(port_no, blk_id, VTSS_ANA_PTP_FLOW_PTP_FLOW_MATCH_LOWER(j), &value));
+            value = (value & 0x00FFFFFF) | (new_ptp_conf->domain.value.val << 24);
+            VTSS_RC(VTSS_PHY_TS_WRITE_CSR(port_no, blk_id, VTSS_ANA_PTP_FLOW_PTP_FLOW_MATCH_LOWER(j), &value));
+        }
+    }
+
+    return VTSS_RC_OK;
+}
+
+/* TRUE if the two PTP actions only differ in the domain match of an enabled
+   action on engine 0 or 1, which can be programmed with vtss_phy_ts_engine_ptp_action_domain_set_priv() */
+static BOOL vtss_phy_ts_ptp_action_domain_only(const vtss_phy_ts_engine_t                 eng_id,
+                                               const vtss_phy_ts_ptp_engine_action_t *const old_action,
+                                               const vtss_phy_ts_ptp_engine_action_t *const new_action)
+{
+    vtss_phy_ts_ptp_engine_action_t action;
+
+    if ((eng_id != VTSS_PHY_TS_PTP_ENGINE_ID_0 && eng_id != VTSS_PHY_TS_PTP_ENGINE_ID_1) ||
+        !old_action->enable || !new_action->enable ||
+        old_action->ptp_conf.range_en != new_action->ptp_conf.range_en) {
+        return FALSE;
+    }
+    action = *new_action;
+    action.ptp_conf = old_action->ptp_conf;
+    return (memcmp(&action, old_action, sizeof(vtss_phy_ts_ptp_engine_action_t)) == 0);
+}
+
 static vtss_rc vtss_phy_ts_engine_action_set_priv(
     vtss_state_t *vtss_state,
     BOOL  ingress,
@@ -15116,9 +15228,10 @@ static vtss_rc vtss_phy_ts_engine_action_set_priv(
     const vtss_phy_ts_engine_action_t *const new_action_conf)
 {
     vtss_phy_ts_blk_id_t blk_id;
-    u32 i, j;
+    u32 i, j, wr_cnt;
     vtss_phy_ts_engine_action_t  *old_action_conf;
     vtss_phy_ts_eng_conf_t *alt_eng_conf = NULL;
+    vtss_phy_ts_port_conf_t *port_conf = &vtss_state->phy_ts_port_conf[port_no];
 
     old_action_conf = &eng_conf->action_conf;
     VTSS_RC(vtss_phy_ts_ana_blk_id_get(eng_id, ingress, &blk_id));
@@ -15148,6 +15261,12 @@ static vtss_rc vtss_phy_ts_engine_action_set_priv(
         }
     }
 
+    /* Nothing to program if the action is unchanged: skip the engine disable/enable */
+    if (memcmp(old_action_conf, new_action_conf, sizeof(vtss_phy_ts_engine_action_t)) == 0) {
+        port_conf->csr_wr_saved += 2;
+        return VTSS_RC_OK;
+    }
+
     if (eng_id == VTSS_PHY_TS_OAM_ENGINE_ID_2A) {
         alt_eng_conf = (ingress ? &vtss_state->phy_ts_port_conf[base_port_no].ingress_eng_conf[VTSS_PHY_TS_OAM_ENGINE_ID_2B] :
                         &vtss_state->phy_ts_port_conf[base_port_no].egress_eng_conf[VTSS_PHY_TS_OAM_ENGINE_ID_2B]);
@@ -15171,6 +15290,19 @@ static vtss_rc vtss_phy_ts_engine_action_set_priv(
             if (memcmp(&old_action_conf->action.ptp_conf[i],
                        &new_action_conf->action.ptp_conf[i],
                        sizeof(vtss_phy_ts_ptp_engine_action_t))) {
+                wr_cnt = port_conf->csr_wr_cnt;
+                if (vtss_phy_ts_ptp_action_domain_only(eng_id, &old_action_conf->action.ptp_conf[i],
+                                                       &new_action_conf->action.ptp_conf[i])) {
+                    /* Only the domain match changed: update the flows in place */
+                    VTSS_RC(vtss_phy_ts_engine_ptp_action_domain_set_priv(vtss_state, port_no, blk_id, eng_conf,
+                                                                          &old_action_conf->action.ptp_conf[i].ptp_conf,
+                                                                          &new_action_conf->action.ptp_conf[i].ptp_conf, i));
+                    wr_cnt = port_conf->csr_wr_cnt - wr_cnt;
+                    if (eng_conf->ptp_action_wr_cnt[i] > wr_cnt) {
+                        port_conf->csr_wr_saved += eng_conf->ptp_action_wr_cnt[i] - wr_cnt;
+                    }
+                    continue;
+                }
                 if (old_action_conf->action.ptp_conf[i].enable) {
                     /* Delete all the old flow related to this action */
                     for (j = 0; j < 6; j++) {
@@ -15186,6 +15318,7 @@ static vtss_rc vtss_phy_ts_engine_action_set_priv(
                                                                    port_no, base_port_no, blk_id, eng_id, eng_conf,
                                                                    &new_action_conf->action.ptp_conf[i], i));
                 }
+                eng_conf->ptp_action_wr_cnt[i] = port_conf->csr_wr_cnt - wr_cnt;
             }
         }
 
@@ -16981,6 +17114,7 @@ static vtss_rc vtss_phy_ts_block_sync(
         /* initial setup of extended register 29 and 30 in 1588 extended page */
         /* 1588 - Page Selection */
 #ifdef VTSS_CHIP_CU_PHY
+        vtss_phy_page_invalidate(vtss_state, port_no);
         VTSS_RC(vtss_state->init_conf.miim_write(vtss_state, port_no, VTSS_PHY_TS_1G_ADDR_EXT_REG, 0x1588));
         /* Read the lower word data from register 29
          */
@@ -22466,6 +22600,8 @@ static void vtss_1588_api_dis_state(vtss_state_t *vtss_state, vtss_port_no_t por
     pr("chk_ing_modified  :: %s\n", pconf->chk_ing_modified ? "True" : "False");
     pr("auto_clear_ls     :: %s\n", pconf->auto_clear_ls ? "True" : "False");
     pr("macsec            :: %s\n", pconf->macsec_ena ? "Enabled" : "Disabled");
+    pr("CSR writes        :: %u\n", pconf->csr_wr_cnt);
+    pr("CSR writes saved  :: %u\n", pconf->csr_wr_saved);
 }
 #if !defined(VTSS_PHY_TS_DISP_CSR)
 #define VTSS_PHY_TS_DISP_CSR(c,b,a,v) \
@@ -82,6 +82,26 @@ static vtss_rc spi_read_write (const vtss_inst_t inst,
     return inst->callout[port_no]->spi_write(inst->callout_ctx[port_no], port_no, dev, reg_num, data);
 }
 
+static vtss_rc spi_batch(const vtss_inst_t   inst,
+                         vtss_port_no_t      port_no,
+                         u32                 cnt,
+                         vtss_spi_32bit_op_t *const ops)
+{
+    mepa_spi_op_t mepa_ops[VTSS_SPI_BATCH_MAX];
+    u32           i;
+
+    if (cnt > VTSS_SPI_BATCH_MAX || cnt > MEPA_SPI_BATCH_MAX) {
+        return VTSS_RC_ERROR;
+    }
+    for (i = 0; i < cnt; i++) {
+        mepa_ops[i].read = ops[i].read;
+        mepa_ops[i].mmd = ops[i].dev;
+        mepa_ops[i].addr = ops[i].reg_num;
+        mepa_ops[i].value = ops[i].data;
+    }
+    return inst->callout[port_no]->spi_batch(inst->callout_ctx[port_no], port_no, cnt, mepa_ops);
+}
+
 static void trace_func(const vtss_phy_trace_group_t group,
                        const vtss_phy_trace_level_t level,
                        const char                   *location,
@@ -388,6 +408,8 @@ static mepa_rc mscc_vtss_create(const mepa_callout_t    MEPA_SHARED_PTR *callout
         conf.trace_func = trace_func;
         if(callout->spi_read && callout->spi_write)
             conf.spi_32bit_read_write = spi_read_write;
+        if (callout->spi_read && callout->spi_write && callout->spi_batch)
+            conf.spi_32bit_batch = spi_batch;
         // No need for delegate as the callouts are binary compatible
         conf.lock_enter = callout->lock_enter;
         conf.lock_exit = callout->lock_exit;
@@ -591,7 +613,7 @@ static mepa_rc mscc_1g_poll(mepa_device_t *dev,
     return MEPA_RC_OK;
 }
 
-static mepa_rc mscc_1g_conf_set(mepa_device_t *dev, const mepa_conf_t *config)
+static mepa_rc mscc_1g_conf_update(mepa_device_t *dev, const mepa_conf_t *config, mepa_conf_change_t chg)
 {
     phy_data_t *data = (phy_data_t *)dev->data;
     vtss_phy_conf_t phy_config = {};
@@ -619,6 +641,10 @@ static mepa_rc mscc_1g_conf_set(mepa_device_t *dev, const mepa_conf_t *config)
         phy_config.aneg.speed_100m_fdx = config->aneg.speed_100m_fdx;
         phy_config.aneg.speed_1g_fdx = config->aneg.speed_1g_fdx;
         phy_config.aneg.no_restart_aneg = config->aneg.no_restart_aneg;
+        if (!(chg & MEPA_CONF_CHG_LINK)) {
+            // Nothing advertised to the link partner has changed
+            phy_config.aneg.no_restart_aneg = TRUE;
+        }
 
         // Translate MDI mode
         phy_config.mdi = VTSS_PHY_MDIX_AUTO;
@@ -650,7 +676,13 @@ static mepa_rc mscc_1g_conf_set(mepa_device_t *dev, const mepa_conf_t *config)
             phy_config.force_ams_sel = MEPA_PHY_MEDIA_FORCE_AMS_SEL_NORMAL;
         }
 
-        (void)vtss_phy_conf_1g_set(data->vtss_instance, data->port_no, &cfg_neg);
+        if (chg & MEPA_CONF_CHG_MAN_NEG) {
+            (void)vtss_phy_conf_1g_set(data->vtss_instance, data->port_no, &cfg_neg);
+        }
+        if (!(chg & ~(MEPA_CONF_CHG_MAN_NEG | MEPA_CONF_CHG_CONF_10G))) {
+            // Nothing else used by the 1G PHY has changed
+            return MEPA_RC_OK;
+        }
         phy_config.forced.speed = config->speed;
         phy_config.forced.fdx = config->fdx;
 
@@ -662,6 +694,11 @@ static mepa_rc mscc_1g_conf_set(mepa_device_t *dev, const mepa_conf_t *config)
     return vtss_phy_conf_set(data->vtss_instance, data->port_no, &phy_config);
 }
 
+static mepa_rc mscc_1g_conf_set(mepa_device_t *dev, const mepa_conf_t *config)
+{
+    return mscc_1g_conf_update(dev, config, MEPA_CONF_CHG_ALL);
+}
+
 static mepa_rc phy_1g_conf_get(mepa_device_t *dev, mepa_conf_t *const conf)
 {
     vtss_phy_conf_t phy_conf;
@@ -1033,6 +1070,22 @@ static mepa_rc phy_1g_chip_temp_get(mepa_device_t *dev,
     return vtss_phy_chip_temp_get(data->vtss_instance,data->port_no,temp);
 }
 
+static mepa_rc phy_1g_chip_temp_period_set(mepa_device_t *dev,
+                                           const uint32_t period_sec)
+{
+    phy_data_t *data = (phy_data_t*)(dev->data);
+
+    return vtss_phy_chip_temp_period_set(data->vtss_instance, data->port_no, period_sec);
+}
+
+static mepa_rc phy_1g_chip_temp_age_get(mepa_device_t *dev,
+                                        uint32_t *const age_sec)
+{
+    phy_data_t *data = (phy_data_t*)(dev->data);
+
+    return vtss_phy_chip_temp_age_get(data->vtss_instance, data->port_no, age_sec);
+}
+
 static mepa_rc phy_10g_delete(mepa_device_t *dev)
 {
     (void)mscc_vtss_destroy(dev);
@@ -1527,6 +1580,22 @@ mepa_rc phy_debug_info_dump(struct mepa_device *dev,
     return vtss_phy_debug_info_print(data->vtss_instance, pr, &phy_info);
 }
 
+static mepa_rc mscc_1g_reg_snapshot_get(struct mepa_device *dev,
+                                        mepa_reg_snapshot_t *const snap)
+{
+    phy_data_t *data = (phy_data_t *)(dev->data);
+
+    return vtss_phy_reg_snapshot_get(data->vtss_instance, data->port_no, snap);
+}
+
+static mepa_rc phy_10g_reg_snapshot_get(struct mepa_device *dev,
+                                        mepa_reg_snapshot_t *const snap)
+{
+    phy_data_t *data = (phy_data_t *)(dev->data);
+
+    return vtss_phy_10g_reg_snapshot_get(data->vtss_instance, data->port_no, snap);
+}
+
 /*
 Address is in this format
 [15:0] -> Register address
@@ -1767,6 +1836,8 @@ mepa_drivers_t mepa_mscc_driver_init()
             .mepa_driver_reset = mscc_1g_reset,
             .mepa_driver_poll = mscc_1g_poll,
             .mepa_driver_conf_set = mscc_1g_conf_set,
+            .mepa_driver_conf_update = mscc_1g_conf_update,
+            .mepa_reg_snapshot_get = mscc_1g_reg_snapshot_get,
             .mepa_driver_conf_get = phy_1g_conf_get,
             .mepa_driver_if_set = mscc_if_set,
             .mepa_driver_if_get = mscc_1g_if_get,
@@ -1799,6 +1870,8 @@ mepa_drivers_t mepa_mscc_driver_init()
             .mepa_driver_reset = mscc_1g_reset,
             .mepa_driver_poll = mscc_1g_poll,
             .mepa_driver_conf_set = mscc_1g_conf_set,
+            .mepa_driver_conf_update = mscc_1g_conf_update,
+            .mepa_reg_snapshot_get = mscc_1g_reg_snapshot_get,
             .mepa_driver_conf_get = phy_1g_conf_get,
             .mepa_driver_if_set = mscc_if_set,
             .mepa_driver_if_get = mscc_1g_if_get,
@@ -1823,6 +1896,8 @@ mepa_drivers_t mepa_mscc_driver_init()
             .mepa_driver_phy_info_get = phy_1g_info_get,
             .mepa_driver_isolate_mode_conf = phy_isolate_mode_conf,
             .mepa_driver_chip_temp_get = phy_1g_chip_temp_get,
+            .mepa_driver_chip_temp_period_set = phy_1g_chip_temp_period_set,
+            .mepa_driver_chip_temp_age_get = phy_1g_chip_temp_age_get,
             .mepa_driver_phy_i2c_read = phy_1g_i2c_read,
             .mepa_driver_phy_i2c_write = phy_1g_i2c_write,
             .mepa_driver_phy_i2c_clock_select = phy_1g_i2c_clock_select,
@@ -1843,6 +1918,8 @@ mepa_drivers_t mepa_mscc_driver_init()
             .mepa_driver_reset = mscc_1g_reset,
             .mepa_driver_poll = mscc_1g_poll,
             .mepa_driver_conf_set = mscc_1g_conf_set,
+            .mepa_driver_conf_update = mscc_1g_conf_update,
+            .mepa_reg_snapshot_get = mscc_1g_reg_snapshot_get,
             .mepa_driver_conf_get = phy_1g_conf_get,
             .mepa_driver_if_set = mscc_if_set,
             .mepa_driver_if_get = mscc_1g_if_get,
@@ -1875,6 +1952,8 @@ mepa_drivers_t mepa_mscc_driver_init()
             .mepa_driver_phy_fefi_get = phy_1g_fefi_get,
             .mepa_driver_phy_fefi_detect = phy_1g_fefi_detect,
             .mepa_driver_chip_temp_get = phy_1g_chip_temp_get,
+            .mepa_driver_chip_temp_period_set = phy_1g_chip_temp_period_set,
+            .mepa_driver_chip_temp_age_get = phy_1g_chip_temp_age_get,
             .mepa_driver_warmrestart_conf_get = phy_1g_warmrestart_conf_get,
             .mepa_driver_warmrestart_conf_end = phy_1g_warmrestart_conf_end,
             .mepa_driver_warmrestart_conf_set = phy_1g_warmrestart_conf_set,
@@ -1892,6 +1971,8 @@ mepa_drivers_t mepa_mscc_driver_init()
             .mepa_driver_reset = mscc_1g_reset,
             .mepa_driver_poll = mscc_1g_poll,
             .mepa_driver_conf_set = mscc_1g_conf_set,
+            .mepa_driver_conf_update = mscc_1g_conf_update,
+            .mepa_reg_snapshot_get = mscc_1g_reg_snapshot_get,
             .mepa_driver_conf_get = phy_1g_conf_get,
             .mepa_driver_if_set = mscc_if_set,
             .mepa_driver_if_get = mscc_1g_if_get,
@@ -1925,6 +2006,8 @@ mepa_drivers_t mepa_mscc_driver_init()
             .mepa_driver_reset = mscc_1g_reset,
             .mepa_driver_poll = mscc_1g_poll,
             .mepa_driver_conf_set = mscc_1g_conf_set,
+            .mepa_driver_conf_update = mscc_1g_conf_update,
+            .mepa_reg_snapshot_get = mscc_1g_reg_snapshot_get,
             .mepa_driver_conf_get = phy_1g_conf_get,
             .mepa_driver_if_set = mscc_if_set,
             .mepa_driver_if_get = mscc_1g_if_get,
@@ -1992,6 +2075,7 @@ mepa_drivers_t mepa_malibu_driver_init()
             .mepa_driver_warmrestart_conf_end = phy_10g_warmrestart_conf_end,
             .mepa_driver_warmrestart_conf_set = phy_10g_warmrestart_conf_set,
             .mepa_debug_info_dump = phy_debug_info_dump,
+            .mepa_reg_snapshot_get = phy_10g_reg_snapshot_get,
             .mepa_ts = &vtss_ts_drivers,
             .mepa_macsec = &vtss_macsec_drivers,
         }
@@ -2018,6 +2102,7 @@ mepa_drivers_t mepa_venice_driver_init()
             .mepa_driver_if_get = venice_10g_if_get,
             .mepa_driver_probe = phy_10g_probe,
             .mepa_driver_phy_info_get = phy_10g_info_get,
+            .mepa_reg_snapshot_get = phy_10g_reg_snapshot_get,
             .mepa_ts = &vtss_ts_drivers,
         }
     };
@@ -2039,6 +2124,8 @@ mepa_drivers_t mepa_default_phy_driver_init()
             .mepa_driver_reset = mscc_1g_reset,
             .mepa_driver_poll = mscc_1g_poll,
             .mepa_driver_conf_set = mscc_1g_conf_set,
+            .mepa_driver_conf_update = mscc_1g_conf_update,
+            .mepa_reg_snapshot_get = mscc_1g_reg_snapshot_get,
             .mepa_driver_conf_get = phy_1g_conf_get,
             .mepa_driver_if_set = mscc_if_set,
             .mepa_driver_if_get = mscc_1g_if_get,
@@ -504,6 +504,15 @@ static mepa_rc vtss_phy_macsec_pattern_get(struct mepa_device *dev,
     return vtss_macsec_pattern_get(data->vtss_instance, port, direction, action, pattern);
 }
 
+static mepa_rc vtss_phy_macsec_txn_commit(struct mepa_device *dev,
+                                          const uint32_t cnt,
+                                          const mepa_macsec_txn_secy_t *const secy,
+                                          uint32_t *const failed)
+{
+    phy_data_t *data = (phy_data_t *)dev->data;
+    return vtss_macsec_txn_commit(data->vtss_instance, cnt, secy, failed);
+}
+
 static mepa_rc vtss_phy_macsec_default_action_set(struct mepa_device *dev,
                                                   const mepa_port_no_t port_no,
                                                   const mepa_macsec_default_action_policy_t *const policy)
@@ -586,6 +595,15 @@ static mepa_rc vtss_phy_macsec_frame_get(struct mepa_device *dev,
     return vtss_macsec_frame_get(data->vtss_instance, port_no, buf_length, return_length, frame);
 }
 
+static mepa_rc vtss_phy_macsec_frame_ring_get(struct mepa_device *dev,
+                                              const mepa_port_no_t port_no,
+                                              mepa_macsec_capture_ring_t *const ring,
+                                              uint32_t *const cnt)
+{
+    phy_data_t *data = (phy_data_t *)dev->data;
+    return vtss_macsec_frame_ring_get(data->vtss_instance, port_no, ring, cnt);
+}
+
 static mepa_rc vtss_phy_macsec_event_enable_set(struct mepa_device *dev,
                                                 const mepa_port_no_t port_no,
                                                 const mepa_macsec_event_t ev_mask,
@@ -637,6 +655,15 @@ static mepa_rc vtss_phy_macsec_egr_intr_sa_get(struct mepa_device *dev,
     return vtss_macsec_egr_intr_sa_get(data->vtss_instance, port_no, port, an);
 }
 
+static mepa_rc vtss_phy_macsec_sa_event_poll(struct mepa_device *dev,
+                                             const uint32_t max_cnt,
+                                             mepa_macsec_sa_event_t *const events,
+                                             uint32_t *const cnt)
+{
+    phy_data_t *data = (phy_data_t *)dev->data;
+    return vtss_macsec_sa_event_poll(data->vtss_instance, max_cnt, events, cnt);
+}
+
 static mepa_rc vtss_phy_macsec_csr_read(struct mepa_device *dev,
                                         const mepa_port_no_t port_no,
                                         const uint16_t mmd,
@@ -930,6 +957,7 @@ mepa_macsec_driver_t vtss_macsec_drivers = {
     .mepa_macsec_pattern_set = vtss_phy_macsec_pattern_set,
     .mepa_macsec_pattern_del = vtss_phy_macsec_pattern_del,
     .mepa_macsec_pattern_get = vtss_phy_macsec_pattern_get,
+    .mepa_macsec_txn_commit = vtss_phy_macsec_txn_commit,
     .mepa_macsec_default_action_set = vtss_phy_macsec_default_action_set,
     .mepa_macsec_default_action_get = vtss_phy_macsec_default_action_get,
     .mepa_macsec_bypass_mode_set = vtss_phy_macsec_bypass_mode_set,
@@ -940,12 +968,14 @@ mepa_macsec_driver_t vtss_macsec_drivers = {
     .mepa_macsec_mtu_get = vtss_phy_macsec_mtu_get,
     .mepa_macsec_frame_capture_set = vtss_phy_macsec_frame_capture_set,
     .mepa_macsec_frame_get = vtss_phy_macsec_frame_get,
+    .mepa_macsec_frame_ring_get = vtss_phy_macsec_frame_ring_get,
     .mepa_macsec_event_enable_set = vtss_phy_macsec_event_enable_set,
     .mepa_macsec_event_enable_get = vtss_phy_macsec_event_enable_get,
     .mepa_macsec_event_poll = vtss_phy_macsec_event_poll,
     .mepa_macsec_event_seq_threshold_set = vtss_phy_macsec_event_seq_threshold_set,
     .mepa_macsec_event_seq_threshold_get = vtss_phy_macsec_event_seq_threshold_get,
     .mepa_macsec_egr_intr_sa_get = vtss_phy_macsec_egr_intr_sa_get,
+    .mepa_macsec_sa_event_poll = vtss_phy_macsec_sa_event_poll,
     .mepa_macsec_csr_read = vtss_phy_macsec_csr_read,
     .mepa_macsec_csr_write = vtss_phy_macsec_csr_write,
     .mepa_macsec_dbg_counter_get = vtss_phy_macsec_dbg_counter_get,
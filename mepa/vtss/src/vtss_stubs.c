@@ -284,6 +284,11 @@ vtss_rc vtss_macsec_pattern_get(const vtss_inst_t inst, const vtss_macsec_port_t
     return VTSS_RC_NOT_IMPLEMENTED;
 }
 
+vtss_rc vtss_macsec_txn_commit(const vtss_inst_t inst, const u32 cnt, const vtss_macsec_txn_secy_t *const secy, u32 *const failed)
+{
+    return VTSS_RC_NOT_IMPLEMENTED;
+}
+
 vtss_rc vtss_macsec_default_action_set(const vtss_inst_t inst, const vtss_port_no_t port_no, const vtss_macsec_default_action_policy_t *const policy)
 {
     return VTSS_RC_NOT_IMPLEMENTED;
@@ -334,6 +339,11 @@ vtss_rc vtss_macsec_frame_get(const vtss_inst_t inst, const vtss_port_no_t port_
     return VTSS_RC_NOT_IMPLEMENTED;
 }
 
+vtss_rc vtss_macsec_frame_ring_get(const vtss_inst_t inst, const vtss_port_no_t port_no, vtss_macsec_capture_ring_t *const ring, u32 *const cnt)
+{
+    return VTSS_RC_NOT_IMPLEMENTED;
+}
+
 vtss_rc vtss_macsec_event_enable_set(const vtss_inst_t inst, const vtss_port_no_t port_no, const vtss_macsec_event_t ev_mask, const BOOL enable)
 {
     return VTSS_RC_NOT_IMPLEMENTED;
@@ -494,6 +504,11 @@ vtss_rc vtss_macsec_egr_intr_sa_get(const vtss_inst_t inst, const vtss_port_no_t
     return VTSS_RC_NOT_IMPLEMENTED;
 }
 
+vtss_rc vtss_macsec_sa_event_poll(const vtss_inst_t inst, const u32 max_cnt, vtss_macsec_sa_event_t *const events, u32 *const cnt)
+{
+    return VTSS_RC_NOT_IMPLEMENTED;
+}
+
 vtss_rc vtss_macsec_inst_count_get(const vtss_inst_t inst, const vtss_port_no_t port_no, vtss_macsec_inst_count_t *count)
 {
     return VTSS_RC_NOT_IMPLEMENTED;
@@ -803,6 +818,11 @@ vtss_rc vtss_phy_10g_vscope_scan_status_get(const vtss_inst_t inst, const vtss_p
     return VTSS_RC_NOT_IMPLEMENTED;
 }
 
+vtss_rc vtss_phy_10g_vscope_scan_status_multi_get(const vtss_inst_t inst, const u32 port_cnt, const vtss_port_no_t *const port_list, vtss_phy_10g_vscope_scan_status_t *const conf_list)
+{
+    return VTSS_RC_NOT_IMPLEMENTED;
+}
+
 vtss_rc vtss_phy_10g_prbs_generator_conf_get(const vtss_inst_t inst, const vtss_port_no_t port_no, const vtss_phy_10g_prbs_type_t type, const vtss_phy_10g_direction_t direction, vtss_phy_10g_prbs_generator_conf_t *const conf)
 {
     return VTSS_RC_NOT_IMPLEMENTED;
@@ -927,11 +947,21 @@ vtss_rc vtss_phy_10g_poll_1sec(const vtss_inst_t inst)
     return VTSS_RC_NOT_IMPLEMENTED;
 }
 
+vtss_rc vtss_phy_10g_poll_1sec_port(const vtss_inst_t inst, const vtss_port_no_t port_no)
+{
+    return VTSS_RC_NOT_IMPLEMENTED;
+}
+
 vtss_rc vtss_phy_10g_edc_fw_status_get(const vtss_inst_t inst, const vtss_port_no_t port_no, vtss_phy_10g_fw_status_t *const status)
 {
     return VTSS_RC_NOT_IMPLEMENTED;
 }
 
+vtss_rc vtss_phy_10g_reg_snapshot_get(const vtss_inst_t inst, const vtss_port_no_t port_no, vtss_phy_reg_snapshot_t *const snap)
+{
+    return VTSS_RC_NOT_IMPLEMENTED;
+}
+
 vtss_rc vtss_phy_10g_csr_read(const vtss_inst_t inst, const vtss_port_no_t port_no, const u32 dev, const u32 addr, u32 *const value)
 {
     return VTSS_RC_NOT_IMPLEMENTED;
@@ -1014,6 +1044,21 @@ vtss_rc vtss_phy_chip_temp_init(const vtss_inst_t inst, const vtss_port_no_t por
     return VTSS_RC_NOT_IMPLEMENTED;
 }
 
+vtss_rc vtss_phy_chip_temp_period_set(const vtss_inst_t inst, const vtss_port_no_t port_no, const u32 period_sec)
+{
+    return VTSS_RC_NOT_IMPLEMENTED;
+}
+
+vtss_rc vtss_phy_chip_temp_period_get(const vtss_inst_t inst, const vtss_port_no_t port_no, u32 *const period_sec)
+{
+    return VTSS_RC_NOT_IMPLEMENTED;
+}
+
+vtss_rc vtss_phy_chip_temp_age_get(const vtss_inst_t inst, const vtss_port_no_t port_no, u32 *const age_sec)
+{
+    return VTSS_RC_NOT_IMPLEMENTED;
+}
+
 vtss_rc vtss_phy_conf_get(const vtss_inst_t inst, const vtss_port_no_t port_no, vtss_phy_conf_t *const conf)
 {
     return VTSS_RC_NOT_IMPLEMENTED;
@@ -1029,6 +1074,21 @@ vtss_rc vtss_phy_status_get(const vtss_inst_t inst, const vtss_port_no_t port_no
     return VTSS_RC_NOT_IMPLEMENTED;
 }
 
+vtss_rc vtss_phy_status_refresh_set(const vtss_inst_t inst, const vtss_port_no_t port_no, const u32 refresh_sec)
+{
+    return VTSS_RC_NOT_IMPLEMENTED;
+}
+
+vtss_rc vtss_phy_status_refresh_get(const vtss_inst_t inst, const vtss_port_no_t port_no, u32 *const refresh_sec)
+{
+    return VTSS_RC_NOT_IMPLEMENTED;
+}
+
+vtss_rc vtss_phy_status_fast_cnt_get(const vtss_inst_t inst, const vtss_port_no_t port_no, u32 *const cnt)
+{
+    return VTSS_RC_NOT_IMPLEMENTED;
+}
+
 vtss_rc vtss_phy_cl37_lp_abil_get(const vtss_inst_t inst, const vtss_port_no_t port_no, vtss_port_status_t *const status)
 {
     return VTSS_RC_NOT_IMPLEMENTED;
@@ -1263,6 +1323,26 @@ vtss_rc vtss_phy_statistic_get(const vtss_inst_t inst, const vtss_port_no_t port
     return VTSS_RC_NOT_IMPLEMENTED;
 }
 
+vtss_rc vtss_phy_statistic64_get(const vtss_inst_t inst, const vtss_port_no_t port_no, vtss_phy_statistic64_t *const statistics)
+{
+    return VTSS_RC_NOT_IMPLEMENTED;
+}
+
+vtss_rc vtss_phy_statistic64_clear(const vtss_inst_t inst, const vtss_port_no_t port_no)
+{
+    return VTSS_RC_NOT_IMPLEMENTED;
+}
+
+vtss_rc vtss_phy_statistic_period_set(const vtss_inst_t inst, const vtss_port_no_t port_no, const u32 period_sec)
+{
+    return VTSS_RC_NOT_IMPLEMENTED;
+}
+
+vtss_rc vtss_phy_statistic_period_get(const vtss_inst_t inst, const vtss_port_no_t port_no, u32 *const period_sec)
+{
+    return VTSS_RC_NOT_IMPLEMENTED;
+}
+
 vtss_rc vtss_phy_do_page_chk_set(const vtss_inst_t inst, const BOOL enable)
 {
     return VTSS_RC_NOT_IMPLEMENTED;
@@ -1337,11 +1417,21 @@ vtss_rc vtss_phy_debug_phyinfo_print(const vtss_inst_t inst, const vtss_debug_pr
     return VTSS_RC_NOT_IMPLEMENTED;
 }
 
+vtss_rc vtss_phy_debug_script_print(const vtss_inst_t inst, const vtss_debug_printf_t pr)
+{
+    return VTSS_RC_NOT_IMPLEMENTED;
+}
+
 vtss_rc vtss_phy_debug_register_dump(const vtss_inst_t inst, const vtss_debug_printf_t pr, BOOL clear, const vtss_port_no_t port_no)
 {
     return VTSS_RC_NOT_IMPLEMENTED;
 }
 
+vtss_rc vtss_phy_reg_snapshot_get(const vtss_inst_t inst, const vtss_port_no_t port_no, vtss_phy_reg_snapshot_t *const snap)
+{
+    return VTSS_RC_NOT_IMPLEMENTED;
+}
+
 vtss_rc vtss_phy_detect_base_ports(const vtss_inst_t inst)
 {
     return VTSS_RC_NOT_IMPLEMENTED;
@@ -1975,6 +2065,21 @@ vtss_rc vtss_ewis_perf_mode_get(const vtss_inst_t inst, const vtss_port_no_t por
     return VTSS_RC_NOT_IMPLEMENTED;
 }
 
+vtss_rc vtss_ewis_pm_enable_set(const vtss_inst_t inst, const vtss_port_no_t port_no, const BOOL enable)
+{
+    return VTSS_RC_NOT_IMPLEMENTED;
+}
+
+vtss_rc vtss_ewis_pm_tick(const vtss_inst_t inst, const vtss_port_no_t port_no)
+{
+    return VTSS_RC_NOT_IMPLEMENTED;
+}
+
+vtss_rc vtss_ewis_pm_get(const vtss_inst_t inst, const vtss_port_no_t port_no, vtss_ewis_pm_t *const pm)
+{
+    return VTSS_RC_NOT_IMPLEMENTED;
+}
+
 vtss_rc vtss_phy_10g_extended2_event_enable_get(const vtss_inst_t inst, const vtss_port_no_t port_no, vtss_phy_10g_extnd2_event_t *const ex2_ev_mask)
 {
     return VTSS_RC_NOT_IMPLEMENTED;
@@ -10,6 +10,7 @@
 #include "main.h"
 #include "trace.h"
 #include "cli.h"
+#include "port.h"
 
 static mscc_appl_trace_module_t trace_module = {
     .name = "intr"
@@ -152,6 +153,18 @@ static void intr_event(meba_event_t ev, uint32_t idx)
     }
     info = &intr_ev_table[ev];
     T_I("event: %u (%s), idx: %u", ev, info->name, idx);
+    switch (ev) {
+    case MEBA_EVENT_LOS:
+    case MEBA_EVENT_FLNK:
+    case MEBA_EVENT_AMS:
+    case MEBA_EVENT_MOD_DET:
+    case MEBA_EVENT_KR:
+        // Port state may have changed, poll it soon
+        port_poll_hint(idx);
+        break;
+    default:
+        break;
+    }
     if (idx > port_cnt) {
         // Exceeded index
         idx = port_cnt;
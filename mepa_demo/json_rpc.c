@@ -7,6 +7,8 @@
 #include <unistd.h>
 #include <sys/socket.h>
 #include <errno.h>
+#include <time.h>
+#include <inttypes.h>
 #include <netinet/in.h>
 #include "microchip/ethernet/switch/api.h"
 #include "microchip/ethernet/board/api.h"
@@ -36,6 +38,9 @@ static mscc_appl_trace_group_t trace_groups[TRACE_GROUP_CNT] = {
 // Message format: 4 bytes length field followed by data
 #define JSON_RPC_HDR_LEN 4
 
+// JSON-RPC 2.0 error code for a request that is not a valid request object
+#define JSON_RPC_INVALID_REQUEST (-32600)
+
 /* - Error handling ------------------------------------------------ */
 
 mesa_rc json_rpc_call(json_rpc_req_t *req, mesa_rc rc)
@@ -1534,6 +1539,171 @@ static mesa_rc mesa_rpc_meba_phy_macsec_frame_get(json_rpc_req_t *req)
     return MESA_RC_OK;
 }
 
+/* - Multi-port methods -------------------------------------------- */
+
+// Maximum number of registers read per port by one multi call
+#define JSON_RPC_MULTI_REG_MAX 32
+
+// Add the result of one port to the object keyed by port number. The value of a port is always an
+// array holding the output values of the port, in the order the single-port method returns them.
+// A NULL object is added for failed ports.
+static mesa_rc json_rpc_multi_add(json_rpc_req_t *req, json_object *obj, mesa_port_no_t port_no, json_object *obj_value)
+{
+    char name[16];
+
+    sprintf(name, "%u", port_no);
+    json_object_object_add(obj, name, obj_value);
+    return MESA_RC_OK;
+}
+
+static mesa_rc appl_port_status_get_multi(json_rpc_req_t *req)
+{
+    mesa_port_list_t   port_list;
+    mesa_port_no_t     port_no;
+    mesa_port_status_t status;
+    uint32_t           port_cnt = mesa_port_cnt(NULL);
+    json_object        *obj, *obj_port;
+
+    MESA_RC(json_rpc_get_idx_mesa_port_list_t(req, req->params, &req->idx, &port_list));
+    MESA_RC(json_rpc_add_json_null(req, req->result));
+    MESA_RC(json_rpc_new(req, &obj));
+    MESA_RC(json_rpc_add_json_array(req, req->result, obj));
+    for (port_no = 0; port_no < port_cnt; port_no++) {
+        if (!mesa_port_list_get(&port_list, port_no)) {
+            continue;
+        }
+        if (mscc_appl_port_status_get(port_no, &status) != MESA_RC_OK) {
+            MESA_RC(json_rpc_multi_add(req, obj, port_no, NULL));
+            continue;
+        }
+        MESA_RC(json_rpc_array_new(req, &obj_port));
+        MESA_RC(json_rpc_multi_add(req, obj, port_no, obj_port));
+        MESA_RC(json_rpc_add_mesa_port_status_t(req, obj_port, &status));
+    }
+    return MESA_RC_OK;
+}
+
+static mesa_rc mesa_rpc_meba_phy_clause22_read_multi(json_rpc_req_t *req)
+{
+    mesa_port_list_t port_list;
+    mesa_port_no_t   port_no;
+    uint32_t         port_cnt = mesa_port_cnt(NULL);
+    uint32_t         address, cnt, i;
+    uint16_t         value;
+    json_object      *obj, *obj_port;
+
+    MESA_RC(json_rpc_get_idx_mesa_port_list_t(req, req->params, &req->idx, &port_list));
+    MESA_RC(json_rpc_get_idx_uint32_t(req, req->params, &req->idx, &address));
+    MESA_RC(json_rpc_get_idx_uint32_t(req, req->params, &req->idx, &cnt));
+    if (cnt == 0 || cnt > JSON_RPC_MULTI_REG_MAX) {
+        sprintf(req->ptr, "register count: %u, max: %u", cnt, JSON_RPC_MULTI_REG_MAX);
+        MESA_RC(MESA_RC_ERROR);
+    }
+    MESA_RC(json_rpc_add_json_null(req, req->result));
+    MESA_RC(json_rpc_add_json_null(req, req->result));
+    MESA_RC(json_rpc_add_json_null(req, req->result));
+    MESA_RC(json_rpc_new(req, &obj));
+    MESA_RC(json_rpc_add_json_array(req, req->result, obj));
+    for (port_no = 0; port_no < port_cnt; port_no++) {
+        if (!mesa_port_list_get(&port_list, port_no)) {
+            continue;
+        }
+        MESA_RC(json_rpc_array_new(req, &obj_port));
+        MESA_RC(json_rpc_multi_add(req, obj, port_no, obj_port));
+        for (i = 0; i < cnt; i++) {
+            // Failed reads are returned as null, so the register offset is kept
+            if (meba_phy_clause22_read(meba_global_inst, port_no, address + i, &value) != MESA_RC_OK) {
+                MESA_RC(json_rpc_add_json_null(req, obj_port));
+            } else {
+                MESA_RC(json_rpc_add_uint16_t(req, obj_port, &value));
+            }
+        }
+    }
+    return MESA_RC_OK;
+}
+
+static mesa_rc mesa_rpc_meba_phy_ts_stats_get_multi(json_rpc_req_t *req)
+{
+    mesa_port_list_t port_list;
+    mesa_port_no_t   port_no;
+    uint32_t         port_cnt = mesa_port_cnt(NULL);
+    mepa_ts_stats_t  stats;
+    json_object      *obj, *obj_port, *obj_val;
+
+    MESA_RC(json_rpc_get_idx_mesa_port_list_t(req, req->params, &req->idx, &port_list));
+    MESA_RC(json_rpc_add_json_null(req, req->result));
+    MESA_RC(json_rpc_new(req, &obj));
+    MESA_RC(json_rpc_add_json_array(req, req->result, obj));
+    for (port_no = 0; port_no < port_cnt; port_no++) {
+        if (!mesa_port_list_get(&port_list, port_no)) {
+            continue;
+        }
+        if (meba_phy_ts_stats_get(meba_global_inst, port_no, &stats) != MESA_RC_OK) {
+            MESA_RC(json_rpc_multi_add(req, obj, port_no, NULL));
+            continue;
+        }
+        MESA_RC(json_rpc_array_new(req, &obj_port));
+        MESA_RC(json_rpc_multi_add(req, obj, port_no, obj_port));
+        MESA_RC(json_rpc_new(req, &obj_val));
+        MESA_RC(json_rpc_add_json_array(req, obj_port, obj_val));
+        MESA_RC(json_rpc_add_name_uint32_t(req, obj_val, "ingr_pream_shrink_err", &stats.ingr_pream_shrink_err));
+        MESA_RC(json_rpc_add_name_uint32_t(req, obj_val, "egr_pream_shrink_err", &stats.egr_pream_shrink_err));
+        MESA_RC(json_rpc_add_name_uint32_t(req, obj_val, "ingr_fcs_err", &stats.ingr_fcs_err));
+        MESA_RC(json_rpc_add_name_uint32_t(req, obj_val, "egr_fcs_err", &stats.egr_fcs_err));
+        MESA_RC(json_rpc_add_name_uint32_t(req, obj_val, "ingr_frm_mod_cnt", &stats.ingr_frm_mod_cnt));
+        MESA_RC(json_rpc_add_name_uint32_t(req, obj_val, "egr_frm_mod_cnt", &stats.egr_frm_mod_cnt));
+        MESA_RC(json_rpc_add_name_uint32_t(req, obj_val, "ts_fifo_tx_cnt", &stats.ts_fifo_tx_cnt));
+        MESA_RC(json_rpc_add_name_uint32_t(req, obj_val, "ts_fifo_drop_cnt", &stats.ts_fifo_drop_cnt));
+    }
+    return MESA_RC_OK;
+}
+
+static mesa_rc mesa_rpc_meba_phy_macsec_secy_counters_get_multi(json_rpc_req_t *req)
+{
+    mesa_port_list_t            port_list;
+    mesa_port_no_t              port_no;
+    uint32_t                    port_cnt = mesa_port_cnt(NULL);
+    mepa_macsec_port_t          port = {};
+    mepa_macsec_secy_counters_t cnt;
+    json_object                 *obj, *obj_port, *obj_val;
+
+    MESA_RC(json_rpc_get_idx_mesa_port_list_t(req, req->params, &req->idx, &port_list));
+    MESA_RC(json_rpc_get_idx_uint32_t(req, req->params, &req->idx, &port.service_id));
+    MESA_RC(json_rpc_get_idx_uint16_t(req, req->params, &req->idx, &port.port_id));
+    MESA_RC(json_rpc_add_json_null(req, req->result));
+    MESA_RC(json_rpc_add_json_null(req, req->result));
+    MESA_RC(json_rpc_add_json_null(req, req->result));
+    MESA_RC(json_rpc_new(req, &obj));
+    MESA_RC(json_rpc_add_json_array(req, req->result, obj));
+    for (port_no = 0; port_no < port_cnt; port_no++) {
+        if (!mesa_port_list_get(&port_list, port_no)) {
+            continue;
+        }
+        port.port_no = port_no;
+        if (meba_phy_macsec_secy_counters_get(meba_global_inst, port_no, port, &cnt) != MESA_RC_OK) {
+            MESA_RC(json_rpc_multi_add(req, obj, port_no, NULL));
+            continue;
+        }
+        MESA_RC(json_rpc_array_new(req, &obj_port));
+        MESA_RC(json_rpc_multi_add(req, obj, port_no, obj_port));
+        MESA_RC(json_rpc_new(req, &obj_val));
+        MESA_RC(json_rpc_add_json_array(req, obj_port, obj_val));
+        MESA_RC(json_rpc_add_name_uint64_t(req, obj_val, "in_pkts_untagged", &cnt.in_pkts_untagged));
+        MESA_RC(json_rpc_add_name_uint64_t(req, obj_val, "in_pkts_no_tag", &cnt.in_pkts_no_tag));
+        MESA_RC(json_rpc_add_name_uint64_t(req, obj_val, "in_pkts_bad_tag", &cnt.in_pkts_bad_tag));
+        MESA_RC(json_rpc_add_name_uint64_t(req, obj_val, "in_pkts_unknown_sci", &cnt.in_pkts_unknown_sci));
+        MESA_RC(json_rpc_add_name_uint64_t(req, obj_val, "in_pkts_no_sci", &cnt.in_pkts_no_sci));
+        MESA_RC(json_rpc_add_name_uint64_t(req, obj_val, "in_pkts_overrun", &cnt.in_pkts_overrun));
+        MESA_RC(json_rpc_add_name_uint64_t(req, obj_val, "in_octets_validated", &cnt.in_octets_validated));
+        MESA_RC(json_rpc_add_name_uint64_t(req, obj_val, "in_octets_decrypted", &cnt.in_octets_decrypted));
+        MESA_RC(json_rpc_add_name_uint64_t(req, obj_val, "out_pkts_untagged", &cnt.out_pkts_untagged));
+        MESA_RC(json_rpc_add_name_uint64_t(req, obj_val, "out_pkts_too_long", &cnt.out_pkts_too_long));
+        MESA_RC(json_rpc_add_name_uint64_t(req, obj_val, "out_octets_protected", &cnt.out_octets_protected));
+        MESA_RC(json_rpc_add_name_uint64_t(req, obj_val, "out_octets_encrypted", &cnt.out_octets_encrypted));
+    }
+    return MESA_RC_OK;
+}
+
 static json_rpc_method_t json_rpc_static_table[] = {
     { "mesa_qos_dscp_dpl_conf_get", mesa_rpc_mesa_qos_dscp_dpl_conf_get },
     { "mesa_qos_dscp_dpl_conf_set", mesa_rpc_mesa_qos_dscp_dpl_conf_set },
@@ -1545,12 +1715,16 @@ static json_rpc_method_t json_rpc_static_table[] = {
     { "mesa_misc_get", misc_get },
     { "mesa_packet_tx_frame", mesa_rpc_packet_tx_frame },
     { "mesa_event_get", event_get },
+    { "mscc_appl_port_status_get_multi", appl_port_status_get_multi },
     { NULL, NULL}
 };
 
 static json_rpc_method_t json_rpc_phy_static_table[] = {
     { "meba_phy_ts_fifo_read_install" , mesa_rpc_meba_phy_ts_fifo_read_install },
     {"meba_phy_macsec_frame_get",mesa_rpc_meba_phy_macsec_frame_get},
+    { "meba_phy_clause22_read_multi", mesa_rpc_meba_phy_clause22_read_multi },
+    { "meba_phy_ts_stats_get_multi", mesa_rpc_meba_phy_ts_stats_get_multi },
+    { "meba_phy_macsec_secy_counters_get_multi", mesa_rpc_meba_phy_macsec_secy_counters_get_multi },
     { NULL , NULL }
 };
 
@@ -1675,22 +1849,42 @@ static cli_cmd_t cli_cmd_table[] = {
     },
 };
 
-static int json_rpc_parse(int fd, char *msg)
+// JSON-RPC 2.0 error reply for a batch element that is not a valid request. The id is null unless
+// it can be taken from the element.
+static json_object *json_rpc_invalid_reply(json_object *obj_req)
 {
-    json_object       *obj_req, *obj_rep, *obj_result, *obj_error, *obj_method, *obj_id;
-    const char        *method_name, *reply;
-    json_rpc_req_t    req = {};
-    int               send_reply = 0, found = 0;
-    uint32_t          len, *p;
-    char              hdr[JSON_RPC_HDR_LEN];
+    json_object *obj_rep, *obj_error, *obj_id = NULL;
 
-    T_N("request: %s", msg);
+    if ((obj_rep = json_object_new_object()) == NULL || (obj_error = json_object_new_object()) == NULL) {
+        json_object_put(obj_rep);
+        return NULL;
+    }
+    if (obj_req != NULL && json_object_get_type(obj_req) == json_type_object) {
+        json_object_object_get_ex(obj_req, "id", &obj_id);
+    }
+    json_object_object_add(obj_error, "code", json_object_new_int(JSON_RPC_INVALID_REQUEST));
+    json_object_object_add(obj_error, "message", json_object_new_string("Invalid Request"));
+    json_object_object_add(obj_rep, "result", NULL);
+    json_object_object_add(obj_rep, "error", obj_error);
+    json_object_object_add(obj_rep, "id", json_object_get(obj_id));
+    return obj_rep;
+}
+
+// Execute one request object and return the reply object, or NULL if no reply must be sent.
+// Requests without an id are notifications and get no reply. In a batch, an invalid request
+// gets an Invalid Request error reply, otherwise it is dropped.
+static json_object *json_rpc_exec(json_object *obj_req, int batch)
+{
+    json_object       *obj_rep = NULL, *obj_result, *obj_error, *obj_method, *obj_id;
+    const char        *method_name;
+    json_rpc_req_t    req = {};
+    int               send_reply = 0, found = 0, invalid = 1;
 
     req.idx = 0;
     req.result = NULL;
     sprintf(req.buf, "internal error");
-    if ((obj_req = json_tokener_parse(msg)) == NULL) {
-        T_I("json_tokener_parse failed");
+    if (json_object_get_type(obj_req) != json_type_object) {
+        T_I("request not object");
     } else if (!json_object_object_get_ex(obj_req, "method", &obj_method)) {
         T_I("method object not found");
     } else if (json_object_get_type(obj_method) != json_type_string) {
@@ -1701,11 +1895,14 @@ static int json_rpc_parse(int fd, char *msg)
         T_I("params object not array");
     } else if (!json_object_object_get_ex(obj_req, "id", &obj_id)) {
         T_I("id object not found");
+        invalid = 0;
     } else if ((req.result = json_object_new_array()) == NULL) {
         T_I("alloc reply object failed");
+        invalid = 0;
     } else {
         // Lookup and call method
         send_reply = 1;
+        invalid = 0;
         method_name = json_object_get_string(obj_method);
         req.ptr = req.buf;
         req.ptr += sprintf(req.ptr, "method '%s': ", method_name);
@@ -1717,7 +1914,7 @@ static int json_rpc_parse(int fd, char *msg)
             req.error = 1;
         }
     }
-    
+
     if (send_reply && (obj_rep = json_object_new_object()) != NULL) {
         if (req.error) {
             obj_result = NULL;
@@ -1730,6 +1927,85 @@ static int json_rpc_parse(int fd, char *msg)
         json_object_object_add(obj_rep, "result", obj_result);
         json_object_object_add(obj_rep, "error", obj_error);
         json_object_object_add(obj_rep, "id", json_object_get(obj_id));
+    }
+
+    // Free result (the call ignores NULL object)
+    json_object_put(req.result);
+
+    if (batch && invalid) {
+        obj_rep = json_rpc_invalid_reply(obj_req);
+    }
+    return obj_rep;
+}
+
+static uint64_t json_rpc_time_us(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ((uint64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000);
+}
+
+// Execute a batch (JSON-RPC 2.0 array of requests) in one go. Each reply carries the time
+// spent in its own call ("elapsed_us") and in the complete batch ("batch_us").
+static json_object *json_rpc_exec_batch(json_object *obj_req)
+{
+    json_object *obj_rep, *obj_elem;
+    int         i, cnt = json_object_array_length(obj_req);
+    uint64_t    start, t, batch_us;
+
+    if (cnt == 0) {
+        // An empty batch is one invalid request, answered by a single reply
+        T_I("empty batch");
+        return json_rpc_invalid_reply(NULL);
+    }
+    if ((obj_rep = json_object_new_array()) == NULL) {
+        T_I("alloc reply failed");
+        return NULL;
+    }
+
+    start = json_rpc_time_us();
+    for (i = 0; i < cnt; i++) {
+        t = json_rpc_time_us();
+        if ((obj_elem = json_rpc_exec(json_object_array_get_idx(obj_req, i), 1)) != NULL) {
+            json_object_object_add(obj_elem, "elapsed_us", json_object_new_int64(json_rpc_time_us() - t));
+            json_object_array_add(obj_rep, obj_elem);
+        }
+    }
+    batch_us = (json_rpc_time_us() - start);
+    cnt = json_object_array_length(obj_rep);
+    for (i = 0; i < cnt; i++) {
+        json_object_object_add(json_object_array_get_idx(obj_rep, i), "batch_us", json_object_new_int64(batch_us));
+    }
+    T_I("batch: %d replies, %" PRIu64 " usec", cnt, batch_us);
+
+    if (cnt == 0) {
+        // Only notifications, no reply
+        json_object_put(obj_rep);
+        obj_rep = NULL;
+    }
+    return obj_rep;
+}
+
+static int json_rpc_parse(int fd, char *msg)
+{
+    json_object       *obj_req, *obj_rep;
+    const char        *reply;
+    uint32_t          len, *p;
+    char              hdr[JSON_RPC_HDR_LEN];
+
+    T_N("request: %s", msg);
+
+    if ((obj_req = json_tokener_parse(msg)) == NULL) {
+        T_I("json_tokener_parse failed");
+        obj_rep = NULL;
+    } else if (json_object_get_type(obj_req) == json_type_array) {
+        obj_rep = json_rpc_exec_batch(obj_req);
+    } else {
+        obj_rep = json_rpc_exec(obj_req, 0);
+    }
+
+    if (obj_rep != NULL) {
         reply = json_object_to_json_string(obj_rep);
         len = strlen(reply);
         p = (uint32_t *)hdr;
@@ -1745,7 +2021,6 @@ static int json_rpc_parse(int fd, char *msg)
 
     // Free objects (the call ignores NULL object)
     json_object_put(obj_req);
-    json_object_put(req.result);
 
     return 0;
 }
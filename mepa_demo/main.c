@@ -749,6 +749,31 @@ static mscc_appl_opt_t main_opt_loop_port = {
     loop_port_opt
 };
 
+static mesa_rc arena_option(char *parm)
+{
+    uint32_t kbytes;
+    char     *end;
+    void     *base;
+
+    kbytes = strtoul(parm, &end, 0);
+    if (*end != '\0' || kbytes == 0) {
+        fprintf(stderr, "Illegal arena size\n");
+        return MESA_RC_ERROR;
+    }
+    if ((base = malloc(kbytes * 1024)) == NULL || mepa_arena_set(base, kbytes * 1024) != MEPA_RC_OK) {
+        fprintf(stderr, "Arena setup failed\n");
+        return MESA_RC_ERROR;
+    }
+    return MESA_RC_OK;
+}
+
+static mscc_appl_opt_t main_opt_arena = {
+    "m:",
+    "<kbytes>",
+    "Allocate PHY instances from one memory arena of the given size",
+    arena_option
+};
+
 static void cli_cmd_warm_start(cli_req_t *req)
 {
     mesa_inst_create_t create;
@@ -960,6 +985,7 @@ static void main_init(mscc_appl_init_t *init)
         mscc_appl_opt_reg(&main_opt_foreground);
         mscc_appl_opt_reg(&main_opt_warm);
         mscc_appl_opt_reg(&main_opt_loop_port);
+        mscc_appl_opt_reg(&main_opt_arena);
         mscc_appl_opt_reg(&main_opt_reset);
         mscc_appl_opt_reg(&main_opt_spidev);
         mscc_appl_opt_reg(&main_opt_vlan_counters_disable);
@@ -1001,6 +1027,7 @@ static void init_modules(mscc_appl_init_t *init)
     mepa_demo_appl_gpio_lp_demo(init);
     mscc_appl_phy_loopback_init(init);
     mscc_appl_phy_diagnostics_demo(init);
+    mscc_appl_sched_init(init);
 }
 
 typedef struct {
@@ -1080,6 +1107,25 @@ mesa_bool_t poll_cnt_us(uint32_t sleep_us, uint32_t *poll_cnt, uint32_t wait_use
     return 0;
 }
 
+/* Get the port ranges of the two SFP slots */
+static void spi_slot_ports_get(uint32_t *slot1_start, uint32_t *slot1_end, uint32_t *slot2_start, uint32_t *slot2_end)
+{
+    uint32_t port_cnt = MEBA_WRAP(meba_capability, appl_init.board_inst, MEBA_CAP_BOARD_PORT_MAP_COUNT);
+
+    *slot1_start = EDSX_25G_SLOT1_START;
+    *slot1_end = EDSX_25G_SLOT1_END;
+    *slot2_start = EDSX_25G_SLOT2_START;
+    *slot2_end = EDSX_25G_SLOT2_END;
+
+    /* SFP Slots Port Numbers when EDSX Port Count is 9 */
+    if(port_cnt == EDSX_PORT_CNT_9) {
+        *slot1_start = EDSX_SLOT1_START_PORT_CNT_9;
+        *slot1_end = EDSX_SLOT1_START_PORT_CNT_9 + 4;
+        *slot2_start =  EDSX_SLOT2_START_PORT_CNT_9;
+        *slot2_end = EDSX_SLOT2_START_PORT_CNT_9 + 4;
+    }
+}
+
 mesa_rc mepa_spi_reg_read_write (void *chip,
                                  mepa_port_no_t port_no,
                                  mepa_bool_t           read,
@@ -1088,20 +1134,9 @@ mesa_rc mepa_spi_reg_read_write (void *chip,
                                  uint32_t            *const data)
 {
     uint32_t addr = 0, ch_no = 0;
-    uint32_t slot1_start = EDSX_25G_SLOT1_START;
-    uint32_t slot1_end = EDSX_25G_SLOT1_END;
-    uint32_t slot2_start = EDSX_25G_SLOT2_START;
-    uint32_t slot2_end = EDSX_25G_SLOT2_END;
+    uint32_t slot1_start, slot1_end, slot2_start, slot2_end;
 
-    uint32_t port_cnt = MEBA_WRAP(meba_capability, appl_init.board_inst, MEBA_CAP_BOARD_PORT_MAP_COUNT);
-
-    /* SFP Slots Port Numbers when EDSX Port Count is 9 */
-    if(port_cnt == EDSX_PORT_CNT_9) {
-        slot1_start = EDSX_SLOT1_START_PORT_CNT_9;
-        slot1_end = EDSX_SLOT1_START_PORT_CNT_9 + 4;
-        slot2_start =  EDSX_SLOT2_START_PORT_CNT_9;
-        slot2_end = EDSX_SLOT2_START_PORT_CNT_9 + 4;
-    }
+    spi_slot_ports_get(&slot1_start, &slot1_end, &slot2_start, &slot2_end);
  
     if((port_no >= slot1_start && port_no <= slot1_end) ) {
         ch_no = (port_no == 0)?0:(slot1_end - port_no);
@@ -1148,6 +1183,58 @@ mesa_rc mepa_phy_spi_write (struct mepa_callout_ctx *ctx,
      return mepa_spi_reg_read_write(ctx, (port_no==0)?ctx->port_no:port_no, 0, dev, reg_num, data);
 }
 
+/* Execute several register accesses using queued SPI transfers.
+   As in mepa_spi_reg_read_write(), each read is done twice and the second value is used. */
+mesa_rc mepa_phy_spi_batch(struct mepa_callout_ctx *ctx,
+                           mepa_port_no_t          port_no,
+                           uint32_t                cnt,
+                           mepa_spi_op_t           *const ops)
+{
+    spi_op_t    spi_ops[2 * MEPA_SPI_BATCH_MAX], *op;
+    spi_user_t  user;
+    uint32_t    slot1_start, slot1_end, slot2_start, slot2_end, ch_no, i, n = 0;
+    mesa_bool_t slot1, slot2;
+
+    if (port_no == 0) {
+        port_no = ctx->port_no;
+    }
+    spi_slot_ports_get(&slot1_start, &slot1_end, &slot2_start, &slot2_end);
+    slot1 = (port_no >= slot1_start && port_no <= slot1_end);
+    slot2 = (port_no >= slot2_start && port_no <= slot2_end);
+    if (slot1 == slot2 || cnt > MEPA_SPI_BATCH_MAX) {
+        // Port in no slot or in both slots, use single accesses
+        for (i = 0; i < cnt; i++) {
+            (void)mepa_spi_reg_read_write(ctx, port_no, ops[i].read, ops[i].mmd, ops[i].addr, ops[i].value);
+        }
+        return MESA_RC_OK;
+    }
+
+    user = (slot1 ? SPI_USER_REG : SPI_USER_FPGA);
+    ch_no = (port_no == 0) ? 0 : ((slot1 ? slot1_end : slot2_end) - port_no);
+    memset(spi_ops, 0, sizeof(spi_ops));
+    for (i = 0; i < cnt; i++) {
+        op = &spi_ops[n++];
+        op->read = ops[i].read;
+        op->addr = (ops[i].read ? 0 : (1 << 23)) | ch_no << 21 | ops[i].mmd << 16 | ops[i].addr;
+        if (ops[i].read) {
+            spi_ops[n++] = *op;
+        } else {
+            op->value = *ops[i].value;
+        }
+    }
+    if (spi_batch(user, spi_ops, n) != MESA_RC_OK) {
+        return MESA_RC_ERROR;
+    }
+    for (i = 0, n = 0; i < cnt; i++) {
+        if (ops[i].read) {
+            n++;
+            *ops[i].value = spi_ops[n].value;
+        }
+        n++;
+    }
+    return MESA_RC_OK;
+}
+
 #if 0
 mesa_rc mepa_spi2_spi_read (struct mepa_callout_ctx *ctx,
                             mepa_port_no_t port_no,
@@ -1263,6 +1350,7 @@ int main(int argc, char **argv)
     if (SPI_REG_IO_SLOT1) {
         init->board_inst->iface.mepa_spi_slot1_reg_read = mepa_phy_spi_read;
         init->board_inst->iface.mepa_spi_slot1_reg_write = mepa_phy_spi_write;
+        init->board_inst->iface.mepa_spi_reg_batch = mepa_phy_spi_batch;
     }
     if (SPI_REG_IO_SLOT2) {
         init->board_inst->iface.mepa_spi_slot2_reg_read = mepa_phy_spi_read;
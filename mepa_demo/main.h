@@ -69,6 +69,24 @@ void mepa_demo_appl_macsec_demo(mscc_appl_init_t *init);
 void mepa_demo_appl_gpio_lp_demo(mscc_appl_init_t *init);
 void mscc_appl_phy_loopback_init(mscc_appl_init_t *init);
 void mscc_appl_phy_diagnostics_demo(mscc_appl_init_t *init);
+void mscc_appl_sched_init(mscc_appl_init_t *init);
+
+// Periodic per-port task, run once per second for each port.
+// The work of all ports is spread over the 10 msec ticks of the second.
+typedef struct mscc_appl_sched_task_t {
+    const char  *name;                               // Task name
+    void        (* func)(mesa_port_no_t port_no);    // Work function
+    mesa_bool_t (* enabled)(mesa_port_no_t port_no); // Optional, skip port if FALSE is returned
+
+    // Internal fields
+    uint32_t                      *cost; // Per-port cost estimate, register accesses
+    struct mscc_appl_sched_task_t *next; // Next in registration list
+} mscc_appl_sched_task_t;
+
+void mscc_appl_sched_task_reg(mscc_appl_sched_task_t *task);
+
+// Number of register accesses (SPI/UIO) done so far, used for cost estimates
+uint32_t mscc_appl_sched_ops(void);
 
 typedef enum {
     SPI_USER_REG,  // Switch register access
@@ -91,6 +109,18 @@ mesa_rc spi_read(spi_user_t     user,
 mesa_rc spi_write(spi_user_t     user,
                   const uint32_t addr,
                   const uint32_t value);
+
+// Queued SPI register access
+typedef struct {
+    mesa_bool_t read;  // Read or write
+    uint32_t    addr;  // Register address
+    uint32_t    value; // Write: Value to write, read: Value read
+} spi_op_t;
+
+mesa_rc spi_batch(spi_user_t user,
+                  spi_op_t   *ops,
+                  uint32_t   cnt);
+uint32_t spi_xfer_cnt_get(void);
 mesa_rc uio_reg_read(const mesa_chip_no_t chip_no,
                      const uint32_t       addr,
                      uint32_t             *const value);
@@ -98,6 +128,7 @@ mesa_rc uio_reg_write(const mesa_chip_no_t chip_no,
                       const uint32_t       addr,
                       const uint32_t       value);
 mesa_rc uio_reg_io_init(void);
+uint32_t uio_access_cnt_get(void);
 
 typedef mesa_rc (*reg_read_t)(const mesa_chip_no_t chip_no,
                               const uint32_t       addr,
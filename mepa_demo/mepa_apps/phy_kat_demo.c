@@ -6,6 +6,7 @@
 #include <stdio.h>
 #include <unistd.h>
 #include <ctype.h>
+#include <time.h>
 #include "microchip/ethernet/switch/api.h"
 #include "microchip/ethernet/board/api.h"
 #include <vtss_phy_api.h>
@@ -28,6 +29,7 @@
 #define PHY10G_PTP_ENCY_XPN_EXPECT 88    /* Expected xpn encrypted data for sequence id field */
 #define PTP_PKT_SEQ_ID_POSITION 45       /* Sequence id byte position in PTP raw packet */
 #define EDSX_NPI_PORT_NO        20       /* NPI Port Number in EDSx Board */
+#define BENCH_SA_CNT            2        /* SAs per SC provisioned by the benchmark */
 
 uint8_t macsec_ports[MAX_PORTS] = {0};   /* MACsec Capable ports connected to EDSx */
 uint8_t phy_connected[MAX_PORTS] = {0};  /* Type of PHY Connected to port */
@@ -731,6 +733,232 @@ macsec_port_cnt:
 }
 
 
+/* ================================================================= *
+ *  Provisioning benchmark
+ *  The KAT SecY is provisioned on all MACsec capable ports with
+ *  BENCH_SA_CNT Tx SAs and one Rx SC with BENCH_SA_CNT Rx SAs, first
+ *  with the individual MACsec calls and then as transactions.
+ * ================================================================= */
+
+static mepa_macsec_txn_secy_t bench_secy[MAX_PORTS];
+static mepa_macsec_txn_secy_t bench_txn[MAX_PORTS];
+
+static uint64_t kat_bench_time_us(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ((uint64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000);
+}
+
+static int kat_bench_port_init(int i)
+{
+    mepa_macsec_init_t init_data = { .enable = TRUE,
+                                     .dis_ing_nm_macsec_en = TRUE,
+                                     .mac_conf.lmac.dis_length_validate = FALSE,
+                                     .mac_conf.hmac.dis_length_validate = FALSE,
+                                     .bypass = MEPA_MACSEC_INIT_BYPASS_NONE };
+    mepa_macsec_default_action_policy_t default_action_policy = {
+        .ingress_non_control_and_non_macsec = MEPA_MACSEC_DEFAULT_ACTION_BYPASS,
+        .ingress_control_and_non_macsec     = MEPA_MACSEC_DEFAULT_ACTION_BYPASS,
+        .ingress_non_control_and_macsec     = MEPA_MACSEC_DEFAULT_ACTION_BYPASS,
+        .ingress_control_and_macsec         = MEPA_MACSEC_DEFAULT_ACTION_BYPASS,
+        .egress_control                     = MEPA_MACSEC_DEFAULT_ACTION_BYPASS,
+        .egress_non_control                 = MEPA_MACSEC_DEFAULT_ACTION_BYPASS,
+    };
+
+    if (mepa_macsec_init_set(meba_phy_instance->phy_devices[macsec_ports[i]], &init_data) != MEPA_RC_OK) {
+        T_E("\n Error in configuring MACsec init set on port : %d\n", macsec_ports[i]);
+        return MEPA_RC_ERROR;
+    }
+    if (mepa_macsec_default_action_set(meba_phy_instance->phy_devices[macsec_ports[i]], macsec_ports[i], &default_action_policy) != MEPA_RC_OK) {
+        T_E("\n Error in configuration Default action set on port :%d \n", macsec_ports[i]);
+        return MEPA_RC_ERROR;
+    }
+    return MEPA_RC_OK;
+}
+
+/* The KAT SecY of a port. AN 0 is active, the other SAs are standby */
+static void kat_bench_secy_get(int i, BOOL xpn, mepa_macsec_txn_secy_t *secy)
+{
+    mepa_macsec_match_pattern_t *pattern;
+    mepa_macsec_txn_sa_t        *sa;
+
+    memset(secy, 0, sizeof(*secy));
+    secy->port.port_no = macsec_ports[i];
+    secy->port.port_id = 1;
+    secy->port.service_id = 0;
+    secy->conf.validate_frames = MEPA_MACSEC_VALIDATE_FRAMES_STRICT;
+    secy->conf.protect_frames = TRUE;
+    secy->conf.always_include_sci = TRUE;
+    secy->conf.mac_addr = peer_macaddress;
+    secy->conf.current_cipher_suite = (xpn ? MEPA_MACSEC_CIPHER_SUITE_GCM_AES_XPN_256 : MEPA_MACSEC_CIPHER_SUITE_GCM_AES_256);
+
+    for (int p = 0; p < 2; p++) {
+        secy->pattern[p].direction = (p == 0 ? MEPA_MACSEC_DIRECTION_EGRESS : MEPA_MACSEC_DIRECTION_INGRESS);
+        secy->pattern[p].action = MEPA_MACSEC_MATCH_ACTION_CONTROLLED_PORT;
+        pattern = &secy->pattern[p].pattern;
+        pattern->priority = MEPA_MACSEC_MATCH_PRIORITY_HIGH;
+        pattern->match = MEPA_MACSEC_MATCH_ETYPE;
+        if (p == 0) {
+            pattern->is_control = TRUE;
+            pattern->etype = (phy_connected[i] == PHY_IS_1G ? IPV4_ETHERTYPE : PTP_ETHERTYPE);
+        } else {
+            pattern->etype = MACSEC_ETHERTYPE;
+        }
+        pattern->src_mac = port_macaddress;
+        pattern->dest_mac = peer_macaddress;
+    }
+    secy->pattern_cnt = 2;
+    secy->controlled = TRUE;
+    secy->tx_sc = TRUE;
+    secy->rx_sc_cnt = 1;
+    secy->rx_sc[0].sci.mac_addr = peer_macaddress;
+    secy->rx_sc[0].sci.port_id = 1;
+
+    for (int an = 0; an < BENCH_SA_CNT; an++) {
+        for (int rx = 0; rx < 2; rx++) {
+            sa = (rx ? &secy->rx_sc[0].sa[an] : &secy->tx_sa[an]);
+            sa->enable = TRUE;
+            sa->activate = (an == 0);
+            sa->pn.xpn = 1;
+            sa->confidentiality = !rx;
+            memcpy(sa->sak.buf, aes_key_256, sizeof(aes_key_256));
+            memcpy(sa->sak.h_buf, hash_key_256, sizeof(hash_key_256));
+            memcpy(sa->sak.salt.buf, salt_xpn, sizeof(salt_xpn));
+            sa->sak.len = SAK_KEY_LEN;
+            memcpy(sa->ssci.buf, short_sci, sizeof(short_sci));
+            sa->ssci.buf[3] += an; // The SSCI must be unique per SA for the same SAK
+        }
+    }
+}
+
+/* Provision a SecY with the individual MACsec calls, in the order used by the KAT */
+static int kat_bench_secy_add(const mepa_macsec_txn_secy_t *secy)
+{
+    mepa_device_t              *dev = meba_phy_instance->phy_devices[secy->port.port_no];
+    const mepa_macsec_txn_sa_t *sa;
+    const mepa_macsec_sci_t    *sci = &secy->rx_sc[0].sci;
+
+    if (mepa_macsec_secy_conf_add(dev, secy->port, &secy->conf) != MEPA_RC_OK) {
+        return MEPA_RC_ERROR;
+    }
+    for (int p = 0; p < secy->pattern_cnt; p++) {
+        if (mepa_macsec_pattern_set(dev, secy->port, secy->pattern[p].direction, secy->pattern[p].action,
+                                    &secy->pattern[p].pattern) != MEPA_RC_OK) {
+            return MEPA_RC_ERROR;
+        }
+    }
+    if (mepa_macsec_secy_controlled_set(dev, secy->port, TRUE) != MEPA_RC_OK ||
+        mepa_macsec_tx_sc_set(dev, secy->port) != MEPA_RC_OK ||
+        mepa_macsec_rx_sc_add(dev, secy->port, sci) != MEPA_RC_OK) {
+        return MEPA_RC_ERROR;
+    }
+    for (int an = 0; an < BENCH_SA_CNT; an++) {
+        sa = &secy->rx_sc[0].sa[an];
+        if (mepa_macsec_rx_seca_set(dev, secy->port, sci, an, sa->pn, &sa->sak, &sa->ssci) != MEPA_RC_OK) {
+            return MEPA_RC_ERROR;
+        }
+    }
+    if (mepa_macsec_rx_sa_activate(dev, secy->port, sci, 0) != MEPA_RC_OK) {
+        return MEPA_RC_ERROR;
+    }
+    for (int an = 0; an < BENCH_SA_CNT; an++) {
+        sa = &secy->tx_sa[an];
+        if (mepa_macsec_tx_seca_set(dev, secy->port, an, sa->pn, sa->confidentiality, &sa->sak, &sa->ssci) != MEPA_RC_OK) {
+            return MEPA_RC_ERROR;
+        }
+    }
+    return mepa_macsec_tx_sa_activate(dev, secy->port, 0);
+}
+
+static int kat_bench_secy_del(void)
+{
+    for (int i = 0; i < num_macsec_ports; i++) {
+        if (mepa_macsec_secy_conf_del(meba_phy_instance->phy_devices[macsec_ports[i]], bench_secy[i].port) != MEPA_RC_OK) {
+            T_E("\n Error in Deleting the SecY on port : %d\n", macsec_ports[i]);
+            return MEPA_RC_ERROR;
+        }
+    }
+    return MEPA_RC_OK;
+}
+
+static void cli_cmd_kat_bench(cli_req_t *req)
+{
+    macsec_kat *mreq = req->module_req;
+    uint64_t   start, call_us, txn_us;
+    uint32_t   ops, call_ops, txn_ops, cnt, failed = 0;
+    mepa_rc    rc;
+    int        i, j;
+
+    if(!mreq->set) {
+         printf("\n Syntax : mepa-cmd kat bench <xpn|non-xpn> \n");
+         T_E("\n Provide Paramter xpn or non-xpn \n");
+         return;
+    }
+
+    if(port_phy_scan() != MEPA_RC_OK) {
+        goto macsec_port_cnt;
+    }
+    for (i = 0; i < num_macsec_ports; i++) {
+        if (kat_bench_port_init(i) != MEPA_RC_OK) {
+            goto dis_macsec;
+        }
+        kat_bench_secy_get(i, mreq->xpn, &bench_secy[i]);
+    }
+
+    /* Individual calls */
+    start = kat_bench_time_us();
+    ops = mscc_appl_sched_ops();
+    for (i = 0; i < num_macsec_ports; i++) {
+        if (kat_bench_secy_add(&bench_secy[i]) != MEPA_RC_OK) {
+            T_E("\n Error in provisioning the SecY on port : %d\n", macsec_ports[i]);
+            goto dis_macsec;
+        }
+    }
+    call_us = kat_bench_time_us() - start;
+    call_ops = mscc_appl_sched_ops() - ops;
+    if (kat_bench_secy_del() != MEPA_RC_OK) {
+        goto dis_macsec;
+    }
+
+    /* Transactions. The PHY types are handled by different drivers, so there is one transaction per PHY type */
+    start = kat_bench_time_us();
+    ops = mscc_appl_sched_ops();
+    for (i = 0; i < num_macsec_ports; i++) {
+        for (j = 0; j < i && phy_connected[j] != phy_connected[i]; j++) {
+        }
+        if (j != i) {
+            continue; // Committed with the first port of this PHY type
+        }
+        for (j = i, cnt = 0; j < num_macsec_ports; j++) {
+            if (phy_connected[j] == phy_connected[i]) {
+                bench_txn[cnt++] = bench_secy[j];
+            }
+        }
+        if ((rc = mepa_macsec_txn_commit(meba_phy_instance->phy_devices[macsec_ports[i]], cnt, bench_txn, &failed)) != MEPA_RC_OK) {
+            T_E("\n Transaction failed on port : %d, rc : %d\n", failed < cnt ? bench_txn[failed].port.port_no : macsec_ports[i], rc);
+            goto dis_macsec;
+        }
+    }
+    txn_us = kat_bench_time_us() - start;
+    txn_ops = mscc_appl_sched_ops() - ops;
+
+    cli_printf("\n %s provisioning of %d ports, %d SAs per SC\n\n", mreq->xpn ? "XPN" : "NON-XPN", num_macsec_ports, BENCH_SA_CNT);
+    cli_printf(" Method         Time [usec]  Register accesses\n");
+    cli_printf(" -------------  -----------  -----------------\n");
+    cli_printf(" Calls          %-11llu  %u\n", (unsigned long long)call_us, call_ops);
+    cli_printf(" Transactions   %-11llu  %u\n", (unsigned long long)txn_us, txn_ops);
+
+dis_macsec:
+    if(port_secy_del_macsec_dis() != MEPA_RC_OK) {
+        T_E("\n Error in Disabling the MACsec \n");
+    }
+
+macsec_port_cnt:
+    num_macsec_ports = 0;
+}
+
 static int cli_param_parse(cli_req_t *req)
 {
     macsec_kat *mreq = req->module_req;
@@ -756,6 +984,11 @@ static cli_cmd_t cli_cmd_table[] = {
         "Known answer test for MACsec",
         cli_cmd_kat_demo,
     },
+    {
+        "kat bench [xpn|non-xpn]",
+        "Compare MACsec provisioning with individual calls and transactions",
+        cli_cmd_kat_bench,
+    },
 };
 
 static cli_parm_t cli_parm_table[] = {
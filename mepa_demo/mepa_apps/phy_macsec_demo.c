@@ -4,6 +4,7 @@
 #include <stdio.h>
 #include <unistd.h>
 #include <ctype.h>
+#include <time.h>
 #include "microchip/ethernet/switch/api.h"
 #include "microchip/ethernet/board/api.h"
 #include "main.h"
@@ -1472,6 +1473,74 @@ static void cli_cmd_macsec_frame_get(cli_req_t *req)
     return;
 }
 
+#define FRAME_RING_SIZE    64      // Frames kept for display
+#define FRAME_RING_TIME_US 1000000 // Drain time
+
+static mepa_macsec_capture_frame_t frame_ring_buf[FRAME_RING_SIZE];
+
+static uint64_t frame_ring_time_us(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ((uint64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000);
+}
+
+static void cli_cmd_macsec_frame_ring(cli_req_t *req)
+{
+    mepa_rc rc;
+    mepa_macsec_capture_ring_t ring;
+    mepa_macsec_capture_frame_t *frm;
+    mepa_port_no_t  port_no;
+    uint32_t cnt, total, polls, i;
+    uint64_t start, us;
+
+    for(int iport = 0; iport < MAX_PORTS; iport++) {
+        port_no = iport2uport(iport);
+        if (req->port_list[port_no] == 0) {
+            continue;
+        }
+        if ((rc = mepa_dev_check(meba_macsec_instance, iport)) != MEPA_RC_OK) {
+            cli_printf(" Dev is Not Created for the port : %d\n", iport);
+            return;
+        }
+        memset(&ring, 0, sizeof(ring));
+        ring.frame = frame_ring_buf;
+        ring.size = FRAME_RING_SIZE;
+        total = 0;
+        polls = 0;
+        start = frame_ring_time_us();
+        do {
+            if ((rc = mepa_macsec_frame_ring_get(meba_macsec_instance->phy_devices[iport], iport, &ring, &cnt)) != MEPA_RC_OK) {
+                T_E("\n Error in Reading the Frames from MACsec FIFO on port : %d \n", iport);
+                return;
+            }
+            total += cnt;
+            polls++;
+            // Keep the last frames, older ones are consumed
+            if (ring.head - ring.tail > FRAME_RING_SIZE / 2) {
+                ring.tail = ring.head - FRAME_RING_SIZE / 2;
+            }
+            us = frame_ring_time_us() - start;
+        } while (us < FRAME_RING_TIME_US);
+
+        cli_printf("\n Frames Captured on Port %d", iport);
+        cli_printf("\n===============================================\n");
+        cli_printf(" %-12s: %u\n", "Frames", total);
+        cli_printf(" %-12s: %u\n", "Dropped", ring.dropped);
+        cli_printf(" %-12s: %u\n", "Polls", polls);
+        cli_printf(" %-12s: %llu\n\n", "Frames/sec", (unsigned long long)total * 1000000 / (us ? us : 1));
+        cli_printf(" %-8s%-10s%-10s%-11s%s\n", "Frame", "Length", "Dir", "Truncated", "Debug Code");
+        for (i = ring.tail; i != ring.head; i++) {
+            frm = &ring.frame[i % ring.size];
+            cli_printf(" %-8u%-10u%-10s%-11s0x%08x\n", i, frm->length,
+                       frm->direction == MEPA_MACSEC_FRAME_CAPTURE_INGRESS ? "ingress" : "egress",
+                       frm->truncated ? "yes" : "no", frm->debug_code);
+        }
+    }
+    return;
+}
+
 static void macsec_poll(meba_inst_t inst)
 {
     mepa_port_no_t port_no;
@@ -2064,6 +2133,7 @@ static void cli_cmd_macsec_cmds()
     cli_printf("\n %-20s| %-80s| %s", "vlan_bypass", "<port_no> port-id <port_id> [zero|one|two|three|four]", "Vlan Tag Bypass Configuration");
     cli_printf("\n %-20s| %-80s| %s", "frame capture", "<port_list> [egress|ingress]", "MACsec FIFO Frame Capture Configuration");
     cli_printf("\n %-20s| %-80s| %s", "frame get", "<port_list>", "MACsec FIFO Captured Frame Get");
+    cli_printf("\n %-20s| %-80s| %s", "frame ring", "<port_list>", "MACsec FIFO Continuous Capture for 1 sec");
     cli_printf("\n %-20s| %-80s| %s", "macsec event set", "<port_list> [rollover|seq_threshold] [evt_enable|evt_disable]", "MACsec Event Enable or Disable");
     cli_printf("\n %-20s| %-80s| %s", "macsec event get", "", "MACsec Event Status of all Ports");
     cli_printf("\n %-20s| %-80s| %s", "macsec seq_threshold", "[get|set] <port_list> [<threshold_val>]", "MACsec Sequence Thresold Val Set or Get");
@@ -2543,6 +2613,12 @@ static cli_cmd_t cli_cmd_macsec_table[] = {
         cli_cmd_macsec_frame_get,
     },
 
+    {
+        "frame ring <port_list>",
+        "Drain the frames captured in MACsec FIFO for 1 sec, re-arming the capture",
+        cli_cmd_macsec_frame_ring,
+    },
+
     {
         "macsec event set <port_list> [rollover|seq_threshold] [evt_enable|evt_disable]",
         "MACsec Event Configuration",
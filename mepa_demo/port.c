@@ -310,6 +310,8 @@ static void port_setup(mesa_port_no_t port_no, mesa_bool_t aneg, mesa_bool_t ini
     mepa_conf_t             phy;
     meba_port_cap_t         cap = entry->meba.cap;
 
+    // Configuration changes may change the link state
+    port_poll_hint(port_no);
     if (mesa_port_conf_get(NULL, port_no, &conf) != MESA_RC_OK) {
         T_E("mesa_port_conf_get(%u) failed", port_no);
         return;
@@ -427,6 +429,82 @@ static mesa_rc port_status_poll(mesa_port_no_t port_no)
     return rc;
 }
 
+/* ================================================================= *
+ *  Poll rate control
+ *  Ports without recent changes are polled less often. Link changes,
+ *  SFP presence changes, configuration and interrupts (port_poll_hint)
+ *  move a port back to the fast class.
+ * ================================================================= */
+
+#define PORT_POLL_STABLE_CNT 10 // Full polls without change before slowing down
+
+static const uint32_t port_poll_interval[PORT_POLL_CLASS_CNT] = {
+    [PORT_POLL_CLASS_FAST]   = 1,
+    [PORT_POLL_CLASS_DOWN]   = 2,
+    [PORT_POLL_CLASS_STABLE] = 4,
+    [PORT_POLL_CLASS_EMPTY]  = 1, // Presence only
+};
+
+static const char *port_poll_class_txt(port_poll_class_t cls)
+{
+    switch (cls) {
+    case PORT_POLL_CLASS_FAST:   return "Fast";
+    case PORT_POLL_CLASS_DOWN:   return "Down";
+    case PORT_POLL_CLASS_STABLE: return "Stable";
+    case PORT_POLL_CLASS_EMPTY:  return "Empty";
+    default:                     return "?";
+    }
+}
+
+static uint64_t port_poll_saved; // Register accesses saved by skipped polls
+static uint32_t port_poll_secs;  // Seconds of rate controlled polling
+
+void port_poll_hint(mesa_port_no_t port_no)
+{
+    port_poll_rate_t *poll;
+
+    if (port_table == NULL || port_no >= mesa_port_cnt(NULL)) {
+        return;
+    }
+    poll = &port_table[port_no].poll;
+    T_D("port_no: %u, class: %s", port_no, port_poll_class_txt(poll->cls));
+    poll->cls = PORT_POLL_CLASS_FAST;
+    poll->stable = 0;
+    poll->wait = 0;
+}
+
+static void port_poll_rate_update(port_entry_t *entry, mesa_bool_t changed)
+{
+    port_poll_rate_t *poll = &entry->poll;
+
+    if (changed) {
+        poll->cls = PORT_POLL_CLASS_FAST;
+        poll->stable = 0;
+    } else if (++poll->stable >= PORT_POLL_STABLE_CNT) {
+        poll->cls = (entry->status.link ? PORT_POLL_CLASS_STABLE : PORT_POLL_CLASS_DOWN);
+    }
+    poll->wait = port_poll_interval[poll->cls];
+}
+
+static mesa_bool_t port_poll_enabled(mesa_port_no_t port_no)
+{
+    port_entry_t *entry = &port_table[port_no];
+
+    if (port_no == 0 && port_polling) {
+        port_poll_secs++;
+    }
+    if (!port_polling || port_no == loop_port || !entry->valid) {
+        return FALSE;
+    }
+    if (entry->poll.wait > 1) {
+        entry->poll.wait--;
+        entry->poll.skip_cnt++;
+        port_poll_saved += entry->poll.cost;
+        return FALSE;
+    }
+    return TRUE;
+}
+
 /* ================================================================= *
  *  CLI
  * ================================================================= */
@@ -676,6 +754,48 @@ static void cli_cmd_port_polling(cli_req_t *req)
     }
 }
 
+static void cli_cmd_port_poll_rate(cli_req_t *req)
+{
+    mesa_port_no_t    uport, iport;
+    port_entry_t      *entry;
+    port_poll_rate_t  *poll;
+    port_poll_class_t cls;
+    uint32_t          cnt[PORT_POLL_CLASS_CNT] = {}, full = 0, now = 0;
+    mesa_bool_t       first = 1;
+
+    for (iport = 0; iport < mesa_port_cnt(NULL); iport++) {
+        entry = &port_table[iport];
+        poll = &entry->poll;
+        if (!entry->valid) {
+            continue;
+        }
+        cnt[poll->cls]++;
+        full += poll->cost;
+        // Register accesses per second saved by the current class
+        now += (poll->cls == PORT_POLL_CLASS_EMPTY ? poll->cost :
+                poll->cost - poll->cost / port_poll_interval[poll->cls]);
+        uport = iport2uport(iport);
+        if (req->port_list[uport] == 0) {
+            continue;
+        }
+        if (first) {
+            cli_table_header("Port  Class   Interval  Stable  Cost  Polls       Skipped");
+            first = 0;
+        }
+        cli_printf("%-6u%-8s%-10u%-8u%-6u%-12u%u\n",
+                   uport, port_poll_class_txt(poll->cls), port_poll_interval[poll->cls],
+                   poll->stable, poll->cost, poll->poll_cnt, poll->skip_cnt);
+    }
+    cli_printf("\n");
+    for (cls = 0; cls < PORT_POLL_CLASS_CNT; cls++) {
+        cli_printf("%-8s: %u ports\n", port_poll_class_txt(cls), cnt[cls]);
+    }
+    cli_printf("Ops/sec without rate control: %u\n", full);
+    cli_printf("Ops/sec saved now           : %u\n", now);
+    cli_printf("Ops/sec saved average       : %llu\n",
+               (unsigned long long)(port_poll_secs ? port_poll_saved / port_poll_secs : 0));
+}
+
 static void cli_cmd_port_loopback(cli_req_t *req)
 {
     mesa_port_no_t        uport, iport;
@@ -1465,6 +1585,11 @@ static cli_cmd_t cli_cmd_table[] = {
         "Set or show the port polling mode",
         cli_cmd_port_polling
     },
+    {
+        "Debug Port Poll Rate [<port_list>]",
+        "Show the port poll rate classes and the register accesses saved",
+        cli_cmd_port_poll_rate
+    },
     {
         "Debug Port dynamic [<port_list>] [1000fdx|2500|5g|10g] [force]",
         "Dynamic port mode setting",
@@ -2069,90 +2194,103 @@ void port_kr_status(mesa_port_no_t  port_no, mesa_bool_t *link)
 }
 
 
-void port_poll(meba_inst_t inst)
+// Per-port status poll, spread over the second by the scheduler
+static void port_poll_port(mesa_port_no_t port_no)
 {
-    uint32_t              port_cnt = mesa_capability(NULL, MESA_CAP_PORT_CNT);
-    mesa_port_no_t        port_no;
-    port_entry_t          *entry;
-    mesa_port_status_t    *ps;
-    mesa_bool_t           link_old;
-    mscc_appl_port_conf_t *pc;
+    meba_inst_t           inst = meba_global_inst;
+    port_entry_t          *entry = &port_table[port_no];
+    mesa_port_status_t    *ps = &entry->status;
+    mscc_appl_port_conf_t *pc = &entry->conf;
+    mesa_bool_t           link_old = ps->link, changed = FALSE;
     mesa_port_counters_t  counters;
+    uint32_t              ops;
+
+    T_N("enter, port_no: %u", port_no);
+    memset(&counters, 0, sizeof(counters));
+    if (entry->media_type == MSCC_PORT_TYPE_SFP && (entry->meba.cap & MEBA_PORT_CAP_SFP_DETECT)) {
+        meba_sfp_status_t old_sfp_status = entry->sfp_status;
+        /* Fetch SFP port status (presence, Tx fault and LoS) using MEBA */
+        if (MEBA_WRAP(meba_sfp_status_get, inst, port_no, &entry->sfp_status) != MESA_RC_OK) {
+            printf("Failed to read SFP port %u status through MEBA.\n", port_no);
+        } else if (old_sfp_status.present == entry->sfp_status.present) {
+            if (!entry->sfp_status.present && !link_old && entry->poll.cls != PORT_POLL_CLASS_FAST) {
+                /* Empty cage, nothing more to poll until an SFP is inserted */
+                entry->poll.cls = PORT_POLL_CLASS_EMPTY;
+                entry->poll.wait = port_poll_interval[PORT_POLL_CLASS_EMPTY];
+                entry->poll.skip_cnt++;
+                port_poll_saved += entry->poll.cost;
+                return;
+            }
+        } else {
+            changed = TRUE;
+            printf("SFP was %s port %d\n", entry->sfp_status.present ? "inserted in" : "removed from", port_no);
+            check_sfp_drv_status(inst, port_no, entry->sfp_status.present);
+            if (entry->sfp_status.present) {
+                port_setup(port_no, FALSE, FALSE);
+                ps->link = FALSE;
+            } else {
+                MEBA_WRAP(meba_port_entry_get, inst, port_no, &entry->meba);
+            }
+        }
+    }
+    /* Poll port status and update the status data structure */
+    ops = mscc_appl_sched_ops();
+    if (port_status_poll(port_no) != MESA_RC_OK) {
+        entry->valid = FALSE;
+        return;
+    }
+    if (mesa_capability(NULL, MESA_CAP_PORT_KR_IRQ)) {
+        /* Verify KR aneg complete */
+        port_kr_status(port_no, &ps->link);
+    }
 
-    // Poll port status
-    T_N("enter");
-
-    // One sec poll of the MESA API
-    if (mesa_poll_1sec(NULL) != MESA_RC_OK) {
-        T_E("mesa_poll_1sec() failed");
+    /* Detect link down and disable forwarding on port */
+    if ((!ps->link || ps->link_down) && link_old) {
+        T_I("link down event on port_no: %u", port_no);
+        link_old = 0;
+        changed = TRUE;
+        mesa_port_state_set(NULL, port_no, FALSE);
+        mesa_mac_table_port_flush(NULL, port_no);
     }
 
-    // Poll port status
-    for (port_no = 0; port_no < port_cnt; port_no++) {
-        if (port_no == loop_port) {
-            continue;
-        }
-        entry = &port_table[port_no];
-        if (!entry->valid) {
-            continue;
+    /* Detect link up and setup port */
+    if (ps->link && !link_old) {
+        T_I("link up event on port_no: %u spd:%s fdx:%d", port_no, mesa_port_spd2txt(ps->speed), ps->fdx);
+        changed = TRUE;
+        mesa_port_state_set(NULL, port_no, TRUE);
+        if (port_is_aneg_mode(entry)) {
+            port_setup(port_no, TRUE, FALSE);
         }
+        mesa_ts_status_change(NULL, port_no);
+    }
 
-        ps = &entry->status;
-        pc = &entry->conf;
-        link_old = ps->link;
-        memset(&counters, 0, sizeof(counters));       
-        if (entry->media_type == MSCC_PORT_TYPE_SFP && (entry->meba.cap & MEBA_PORT_CAP_SFP_DETECT)) {
-            meba_sfp_status_t old_sfp_status = entry->sfp_status;
-            /* Fetch SFP port status (presence, Tx fault and LoS) using MEBA */
-            if (MEBA_WRAP(meba_sfp_status_get, inst, port_no, &entry->sfp_status) != MESA_RC_OK) {
-                printf("Failed to read SFP port %u status through MEBA.\n", port_no);
-            } else if (old_sfp_status.present != entry->sfp_status.present) {
-                printf("SFP was %s port %d\n", entry->sfp_status.present ? "inserted in" : "removed from", port_no);
-                check_sfp_drv_status(inst, port_no, entry->sfp_status.present);
-                if (entry->sfp_status.present) {
-                    port_setup(port_no, FALSE, FALSE);
-                    ps->link = FALSE;
-                } else {
-                    MEBA_WRAP(meba_port_entry_get, inst, port_no, &entry->meba);
-                }
-            }
-        } 
-        /* Poll port status and update the status data structure */
-        if (port_status_poll(port_no) != MESA_RC_OK) {
-            entry->valid = FALSE;
-            continue;
-        }
-      //  if(port_no > 11 && port_no < 16) {
-      //     printf("Link %d\n", ps->link);
-       // }
-        if (mesa_capability(NULL, MESA_CAP_PORT_KR_IRQ)) {
-            /* Verify KR aneg complete */
-            port_kr_status(port_no, &ps->link);
-        }
+    /* Get port counters from the API */
+    mesa_port_counters_get(NULL, port_no, &counters);
+    /* Update port LED  through MEBA */
+    MEBA_WRAP(meba_port_led_update, inst, port_no, ps, &counters, &pc->admin);
 
-        /* Detect link down and disable forwarding on port */
-        if ((!ps->link || ps->link_down) && link_old) {
-            T_I("link down event on port_no: %u", port_no);
-            link_old = 0;
-            mesa_port_state_set(NULL, port_no, FALSE);
-            mesa_mac_table_port_flush(NULL, port_no);
-        }
+    entry->poll.cost = (mscc_appl_sched_ops() - ops);
+    entry->poll.poll_cnt++;
+    port_poll_rate_update(entry, changed);
+    T_N("exit, port_no: %u", port_no);
+}
 
-        /* Detect link up and setup port */
-        if (ps->link && !link_old) {
-            T_I("link up event on port_no: %u spd:%s fdx:%d", port_no, mesa_port_spd2txt(ps->speed), ps->fdx);
-            mesa_port_state_set(NULL, port_no, TRUE);
-            if (port_is_aneg_mode(entry)) {
-                port_setup(port_no, TRUE, FALSE);
-            }
-            mesa_ts_status_change(NULL, port_no);
-        }
+static mscc_appl_sched_task_t port_poll_task = {
+    "port_poll",
+    port_poll_port,
+    port_poll_enabled
+};
+
+void port_poll(meba_inst_t inst)
+{
+    T_N("enter");
 
-        /* Get port counters from the API */
-        mesa_port_counters_get(NULL, port_no, &counters);
-        /* Update port LED  through MEBA */
-        MEBA_WRAP(meba_port_led_update, inst, port_no, ps, &counters, &pc->admin);
+    // One sec poll of the MESA API
+    if (mesa_poll_1sec(NULL) != MESA_RC_OK) {
+        T_E("mesa_poll_1sec() failed");
     }
+
+    // The port status is polled by port_poll_task
     port_poll_cnt++;
     if (port_poll_cnt == 5) {
         // Assume warm start ready
@@ -2183,6 +2321,7 @@ void mscc_appl_port_init(mscc_appl_init_t *init)
 
         port_init(init->board_inst);
         port_cli_init();
+        mscc_appl_sched_task_reg(&port_poll_task);
         break;
 
     case MSCC_INIT_CMD_INIT_WARM:
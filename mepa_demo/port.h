@@ -38,6 +38,25 @@ typedef struct {
     uint32_t                adv_dis;      /* Advertisement disable flags */
 } mscc_appl_port_conf_t;
 
+// Port poll rate class
+typedef enum {
+    PORT_POLL_CLASS_FAST,   /** Recent change, poll every second */
+    PORT_POLL_CLASS_DOWN,   /** Link down without recent change */
+    PORT_POLL_CLASS_STABLE, /** Link up without recent change */
+    PORT_POLL_CLASS_EMPTY,  /** Empty SFP cage, only presence is polled */
+    PORT_POLL_CLASS_CNT
+} port_poll_class_t;
+
+// Port poll rate state
+typedef struct {
+    port_poll_class_t cls;       /* Current class */
+    uint32_t          wait;      /* Seconds until next full poll */
+    uint32_t          stable;    /* Full polls without change */
+    uint32_t          cost;      /* Register accesses of last full poll */
+    uint32_t          poll_cnt;  /* Number of full polls */
+    uint32_t          skip_cnt;  /* Number of skipped full polls */
+} port_poll_rate_t;
+
 // Port entry
 typedef struct {
     mesa_bool_t           valid;
@@ -51,8 +70,12 @@ typedef struct {
     meba_sfp_driver_t     sfp_driver;
     mesa_bool_t           in_bound_status; /* TRUE:  get status from switch.
                                               FALSE: get status from phy */
+    port_poll_rate_t      poll;            /* Poll rate controller */
 } port_entry_t;
 
 mesa_rc mscc_appl_port_status_get(const mesa_port_no_t  port_no,
                                   mesa_port_status_t    *const status);
+
+// Hint that the port may have changed state, e.g. from an interrupt
+void port_poll_hint(mesa_port_no_t port_no);
 #endif /* _MSCC_APPL_PORT_H_ */
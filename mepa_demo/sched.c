@@ -0,0 +1,316 @@
+// Copyright (c) 2004-2020 Microchip Technology Inc. and its subsidiaries.
+// SPDX-License-Identifier: MIT
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "microchip/ethernet/switch/api.h"
+#include "microchip/ethernet/board/api.h"
+#include "vtss_phy_api.h"
+#include "main.h"
+#include "trace.h"
+#include "cli.h"
+
+#ifndef TRUE
+#define TRUE 1
+#endif
+
+#ifndef FALSE
+#define FALSE 0
+#endif
+
+static mscc_appl_trace_module_t trace_module = {
+    .name = "sched"
+};
+
+enum {
+    TRACE_GROUP_DEFAULT,
+    TRACE_GROUP_CNT
+};
+
+static mscc_appl_trace_group_t trace_groups[TRACE_GROUP_CNT] = {
+    // TRACE_GROUP_DEFAULT
+    {
+        .name = "default",
+        .level = MESA_TRACE_LEVEL_ERROR
+    },
+};
+
+/* ================================================================= *
+ *  Periodic per-port work
+ *  The 1 second work of all registered tasks is split into
+ *  (task, port) items, which are spread over the 10 msec ticks of the
+ *  period. Each item has a cost estimate, measured as the number of
+ *  register accesses (MDIO/SPI/UIO) done by the previous runs.
+ * ================================================================= */
+
+#define SCHED_PERIOD_US    1000000 // Period of all tasks
+#define SCHED_TICK_US      10000   // Tick interval
+#define SCHED_COST_DEFAULT 16      // Cost estimate before the first run
+
+static mscc_appl_sched_task_t *sched_task_list;
+static uint32_t               sched_port_cnt;
+static uint32_t               sched_budget;   // Maximum cost per tick, zero means no limit
+
+// Current period
+static struct {
+    uint64_t               start_us; // Start time
+    mscc_appl_sched_task_t *task;    // Next task to run
+    mesa_port_no_t         port_no;  // Next port to run
+    uint32_t               cost;     // Estimated remaining cost
+    mesa_bool_t            late;     // Period not completed in time
+} sched_cur;
+
+// Statistics
+static struct {
+    uint32_t periods;     // Number of periods
+    uint32_t ticks;       // Number of ticks doing work
+    uint32_t items;       // Number of items run
+    uint32_t late;        // Number of periods not completed in time
+    uint64_t tick_us_max; // Worst case tick duration
+    uint64_t tick_us_sum; // Total tick duration
+    uint32_t tick_ops_max; // Worst case register accesses in one tick
+} sched_stats;
+
+static uint64_t sched_time_us(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ((uint64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000);
+}
+
+uint32_t mscc_appl_sched_ops(void)
+{
+    return (spi_xfer_cnt_get() + uio_access_cnt_get());
+}
+
+void mscc_appl_sched_task_reg(mscc_appl_sched_task_t *task)
+{
+    mscc_appl_sched_task_t *cur;
+    mesa_port_no_t         port_no;
+
+    if (sched_port_cnt == 0) {
+        sched_port_cnt = mesa_port_cnt(NULL);
+    }
+    if ((task->cost = calloc(sched_port_cnt, sizeof(uint32_t))) == NULL) {
+        T_E("task %s: calloc() failed", task->name);
+        return;
+    }
+    for (port_no = 0; port_no < sched_port_cnt; port_no++) {
+        task->cost[port_no] = SCHED_COST_DEFAULT;
+    }
+
+    // Add to the end of the list
+    task->next = NULL;
+    if (sched_task_list == NULL) {
+        sched_task_list = task;
+    } else {
+        for (cur = sched_task_list; cur->next != NULL; cur = cur->next) {
+        }
+        cur->next = task;
+    }
+}
+
+static void sched_period_start(uint64_t now)
+{
+    mscc_appl_sched_task_t *task;
+    mesa_port_no_t         port_no;
+
+    sched_stats.periods++;
+    sched_cur.start_us = now;
+    sched_cur.task = sched_task_list;
+    sched_cur.port_no = 0;
+    sched_cur.cost = 0;
+    sched_cur.late = FALSE;
+    for (task = sched_task_list; task != NULL; task = task->next) {
+        for (port_no = 0; port_no < sched_port_cnt; port_no++) {
+            sched_cur.cost += task->cost[port_no];
+        }
+    }
+}
+
+// Run the next item, returns its measured cost
+static uint32_t sched_item_run(void)
+{
+    mscc_appl_sched_task_t *task = sched_cur.task;
+    mesa_port_no_t         port_no = sched_cur.port_no;
+    uint32_t               ops = mscc_appl_sched_ops(), est = task->cost[port_no];
+
+    if (task->enabled == NULL || task->enabled(port_no)) {
+        task->func(port_no);
+        ops = (mscc_appl_sched_ops() - ops);
+        // Smooth the estimate, but follow increases immediately
+        task->cost[port_no] = (ops > est ? ops : (3 * est + ops + 3) / 4);
+        sched_stats.items++;
+    } else {
+        ops = 0;
+    }
+    sched_cur.cost = (sched_cur.cost > est ? sched_cur.cost - est : 0);
+
+    if (++sched_cur.port_no >= sched_port_cnt) {
+        sched_cur.port_no = 0;
+        sched_cur.task = task->next;
+    }
+    return ops;
+}
+
+static void sched_tick(void)
+{
+    uint64_t start = sched_time_us(), elapsed, us;
+    uint32_t ticks_left, target, spent = 0, ops = 0;
+
+    if (sched_task_list == NULL) {
+        return;
+    }
+    elapsed = (start - sched_cur.start_us);
+    if (sched_cur.task == NULL) {
+        if (sched_cur.start_us != 0 && elapsed < SCHED_PERIOD_US) {
+            return; // All work done for this period
+        }
+        sched_period_start(start);
+        elapsed = 0;
+    } else if (elapsed >= SCHED_PERIOD_US && !sched_cur.late) {
+        // The budget did not allow the period to complete in time. Continue
+        // within the budget, the next period starts when this one is done.
+        sched_cur.late = TRUE;
+        sched_stats.late++;
+    }
+
+    // Spread the remaining cost evenly over the remaining ticks
+    ticks_left = (elapsed >= SCHED_PERIOD_US ? 1 : (SCHED_PERIOD_US - elapsed + SCHED_TICK_US - 1) / SCHED_TICK_US);
+    target = (sched_cur.cost + ticks_left - 1) / ticks_left;
+    if (sched_budget && target > sched_budget) {
+        target = sched_budget;
+    }
+    while (sched_cur.task != NULL) {
+        if (spent && spent + sched_cur.task->cost[sched_cur.port_no] > target) {
+            break;
+        }
+        spent += sched_cur.task->cost[sched_cur.port_no];
+        ops += sched_item_run();
+    }
+
+    if (spent || ops) {
+        us = (sched_time_us() - start);
+        sched_stats.ticks++;
+        sched_stats.tick_us_sum += us;
+        if (us > sched_stats.tick_us_max) {
+            sched_stats.tick_us_max = us;
+        }
+        if (ops > sched_stats.tick_ops_max) {
+            sched_stats.tick_ops_max = ops;
+        }
+    }
+}
+
+static int cli_cmd_sched(int argc, const char **argv)
+{
+    mscc_appl_sched_task_t *task;
+    mesa_port_no_t         port_no;
+    uint32_t               cost;
+    char                   *end;
+
+    if (argc == 3 && !strcmp(argv[2], "clear")) {
+        memset(&sched_stats, 0, sizeof(sched_stats));
+        return 0;
+    }
+    if (argc == 4 && !strcmp(argv[2], "budget")) {
+        sched_budget = strtoul(argv[3], &end, 0);
+        if (*end != '\0') {
+            cli_printf("Illegal budget\n");
+            return -1;
+        }
+        return 0;
+    }
+    if (argc != 2) {
+        cli_printf("Usage: debug sched [clear | budget <ops>]\n");
+        return -1;
+    }
+
+    cli_printf("Budget      : %u%s\n", sched_budget, sched_budget ? " ops/tick" : " (no limit)");
+    cli_printf("Periods     : %u\n", sched_stats.periods);
+    cli_printf("Late        : %u\n", sched_stats.late);
+    cli_printf("Work ticks  : %u\n", sched_stats.ticks);
+    cli_printf("Items       : %u\n", sched_stats.items);
+    cli_printf("Tick max    : %llu usec\n", (unsigned long long)sched_stats.tick_us_max);
+    cli_printf("Tick avg    : %llu usec\n",
+               (unsigned long long)(sched_stats.ticks ? sched_stats.tick_us_sum / sched_stats.ticks : 0));
+    cli_printf("Tick ops max: %u\n\n", sched_stats.tick_ops_max);
+
+    cli_table_header("Task              Cost/Period  Max Port Cost");
+    for (task = sched_task_list; task != NULL; task = task->next) {
+        for (port_no = 0, cost = 0; port_no < sched_port_cnt; port_no++) {
+            cost += task->cost[port_no];
+        }
+        cli_printf("%-18s%-13u", task->name, cost);
+        for (port_no = 0, cost = 0; port_no < sched_port_cnt; port_no++) {
+            if (task->cost[port_no] > cost) {
+                cost = task->cost[port_no];
+            }
+        }
+        cli_printf("%u\n", cost);
+    }
+    return 0;
+}
+
+/* ================================================================= *
+ *  10G PHY one second work, done per port instead of one
+ *  vtss_phy_10g_poll_1sec() call for all ports.
+ * ================================================================= */
+
+static void sched_phy_10g_poll(mesa_port_no_t port_no)
+{
+    if (vtss_phy_10g_poll_1sec_port(NULL, port_no) != VTSS_RC_OK) {
+        T_E("vtss_phy_10g_poll_1sec_port() failed, port_no: %u", port_no);
+    }
+}
+
+static mesa_bool_t sched_phy_10g_enabled(mesa_port_no_t port_no)
+{
+    return vtss_phy_10G_is_valid(NULL, port_no);
+}
+
+static mscc_appl_sched_task_t sched_phy_10g_task = {
+    "phy_10g_poll",
+    sched_phy_10g_poll,
+    sched_phy_10g_enabled
+};
+
+static cli_cmd_t cli_cmd_table[] = {
+    {
+        "Debug Sched [clear | budget <ops>]",
+        "Show periodic work statistics, clear them or set the maximum register accesses per tick",
+        0,
+        0,
+        cli_cmd_sched,
+    },
+};
+
+void mscc_appl_sched_init(mscc_appl_init_t *init)
+{
+    int i;
+
+    switch (init->cmd) {
+    case MSCC_INIT_CMD_REG:
+        mscc_appl_trace_register(&trace_module, trace_groups, TRACE_GROUP_CNT);
+        break;
+
+    case MSCC_INIT_CMD_INIT:
+        for (i = 0; i < sizeof(cli_cmd_table)/sizeof(cli_cmd_t); i++) {
+            mscc_appl_cli_cmd_reg(&cli_cmd_table[i]);
+        }
+        mscc_appl_sched_task_reg(&sched_phy_10g_task);
+        break;
+
+    case MSCC_INIT_CMD_POLL_FAST:
+        sched_tick();
+        break;
+
+    default:
+        break;
+    }
+}
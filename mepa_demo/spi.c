@@ -7,6 +7,7 @@
 #include <fcntl.h>
 #include <unistd.h>
 #include <sys/ioctl.h>
+#include <sys/time.h>
 #include <linux/types.h>
 #include <linux/spi/spidev.h>
 
@@ -14,6 +15,7 @@
 #include "microchip/ethernet/board/api.h"
 #include "main.h"
 #include "trace.h"
+#include "cli.h"
 
 typedef struct {
     int fd;
@@ -23,6 +25,12 @@ typedef struct {
 
 static spi_conf_t spi_conf[SPI_USER_CNT];
 
+// Access counters, used for benchmarking
+static struct {
+    uint32_t ioctl_cnt; // Number of SPI_IOC_MESSAGE calls
+    uint32_t xfer_cnt;  // Number of register transfers
+} spi_cnt;
+
 static mscc_appl_trace_module_t trace_module = {
     .name = "spi"
 };
@@ -71,6 +79,8 @@ mesa_rc spi_read(spi_user_t     user,
     };
 
     ret = ioctl(conf->fd, SPI_IOC_MESSAGE(1), &tr);
+    spi_cnt.ioctl_cnt++;
+    spi_cnt.xfer_cnt++;
     if (ret < 1) {
         T_E("spi_read: %s", strerror(errno));
         return MESA_RC_ERROR;
@@ -125,6 +135,8 @@ mesa_rc spi_write(spi_user_t     user,
     };
 
     ret = ioctl(conf->fd, SPI_IOC_MESSAGE(1), &tr);
+    spi_cnt.ioctl_cnt++;
+    spi_cnt.xfer_cnt++;
     if (ret < 1) {
         T_E("spi_write: %s", strerror(errno));
         return MESA_RC_ERROR;
@@ -133,6 +145,70 @@ mesa_rc spi_write(spi_user_t     user,
     return MESA_RC_OK;
 }
 
+#define SPI_BATCH_MAX 64 /* Maximum number of transfers in one SPI_IOC_MESSAGE */
+
+mesa_rc spi_batch(spi_user_t user,
+                  spi_op_t   *ops,
+                  uint32_t   cnt)
+{
+    static uint8_t          tx[SPI_BATCH_MAX][SPI_NR_BYTES + SPI_PADDING_MAX];
+    static uint8_t          rx[SPI_BATCH_MAX][SPI_NR_BYTES + SPI_PADDING_MAX];
+    struct spi_ioc_transfer tr[SPI_BATCH_MAX];
+    spi_conf_t              *conf = &spi_conf[user];
+    int                     spi_padding = conf->padding;
+    uint32_t                i, n, siaddr;
+    uint8_t                 *t, *r;
+    spi_op_t                *op;
+
+    for (; cnt > 0; cnt -= n, ops += n) {
+        n = (cnt < SPI_BATCH_MAX ? cnt : SPI_BATCH_MAX);
+        memset(tr, 0, n * sizeof(tr[0]));
+        for (i = 0; i < n; i++) {
+            op = &ops[i];
+            t = tx[i];
+            siaddr = TO_SPI(op->addr);
+            if (op->read) {
+                t[0] = (uint8_t)(siaddr >> 16);
+                memset(&t[3], 0xff, SPI_NR_BYTES - 3 + spi_padding);
+                tr[i].len = SPI_NR_BYTES + spi_padding;
+            } else {
+                t[0] = (uint8_t)(0x80 | (siaddr >> 16));
+                t[3] = (uint8_t)(op->value >> 24);
+                t[4] = (uint8_t)(op->value >> 16);
+                t[5] = (uint8_t)(op->value >> 8);
+                t[6] = (uint8_t)(op->value >> 0);
+                tr[i].len = SPI_NR_BYTES;
+            }
+            t[1] = (uint8_t)(siaddr >> 8);
+            t[2] = (uint8_t)(siaddr >> 0);
+            tr[i].tx_buf = (unsigned long)t;
+            tr[i].rx_buf = (unsigned long)rx[i];
+            tr[i].speed_hz = conf->freq;
+            tr[i].bits_per_word = 8;
+            // Each register access is a separate chip select cycle
+            tr[i].cs_change = (i < (n - 1));
+        }
+
+        if (ioctl(conf->fd, SPI_IOC_MESSAGE(n), tr) < 1) {
+            T_E("spi_batch: %s", strerror(errno));
+            return MESA_RC_ERROR;
+        }
+        spi_cnt.ioctl_cnt++;
+        spi_cnt.xfer_cnt += n;
+
+        for (i = 0; i < n; i++) {
+            op = &ops[i];
+            if (op->read) {
+                r = &rx[i][spi_padding];
+                op->value = ((r[3] << 24) | (r[4] << 16) | (r[5] << 8) | r[6]);
+            }
+        }
+        T_D("%u transfers", n);
+    }
+
+    return MESA_RC_OK;
+}
+
 mesa_rc spi_reg_read(const mesa_chip_no_t chip_no,
                      const uint32_t       addr,
                      uint32_t             *const value)
@@ -193,9 +269,105 @@ mesa_rc spi_io_init(spi_user_t user, const char *device, int freq, int padding)
     return MESA_RC_OK;
 }
 
+uint32_t spi_xfer_cnt_get(void)
+{
+    return spi_cnt.xfer_cnt;
+}
+
+static uint64_t spi_time_us(void)
+{
+    struct timeval tv;
+
+    gettimeofday(&tv, NULL);
+    return ((uint64_t)tv.tv_sec * 1000000 + tv.tv_usec);
+}
+
+static void spi_benchmark_print(const char *name, uint32_t cnt, uint32_t ioctl_cnt, uint64_t usec)
+{
+    cli_printf("%-8s%-12u%-12u%-16llu%llu\n", name, cnt, ioctl_cnt,
+               (unsigned long long)ioctl_cnt * 1000 / cnt, (unsigned long long)usec * 1000 / cnt);
+}
+
+static int cli_cmd_spi_benchmark(int argc, const char **argv)
+{
+    spi_user_t user = SPI_USER_REG;
+    spi_op_t   ops[SPI_BATCH_MAX];
+    uint32_t   addr, cnt = 1000, i, n, value, ioctl_cnt;
+    uint64_t   start;
+    char       *end;
+
+    if (argc < 4 || argc > 5) {
+        cli_printf("Usage: debug spi benchmark <addr> [<count>]\n");
+        return -1;
+    }
+    addr = strtoul(argv[3], &end, 0);
+    if (*end != '\0' || (argc == 5 && ((cnt = strtoul(argv[4], &end, 0)) == 0 || *end != '\0'))) {
+        cli_printf("Illegal parameter\n");
+        return -1;
+    }
+    if (spi_conf[user].fd <= 0) {
+        cli_printf("SPI register access not enabled\n");
+        return -1;
+    }
+
+    cli_printf("Reading 0x%06x\n\n", TO_SPI(addr));
+    cli_table_header("Mode    Accesses    Syscalls    Syscalls/1000   usec/1000");
+
+    // One ioctl per register
+    ioctl_cnt = spi_cnt.ioctl_cnt;
+    start = spi_time_us();
+    for (i = 0; i < cnt; i++) {
+        if (spi_read(user, addr, &value) != MESA_RC_OK) {
+            return -1;
+        }
+    }
+    spi_benchmark_print("single", cnt, spi_cnt.ioctl_cnt - ioctl_cnt, spi_time_us() - start);
+
+    // Queued transfers
+    ioctl_cnt = spi_cnt.ioctl_cnt;
+    start = spi_time_us();
+    for (i = 0; i < cnt; i += n) {
+        n = ((cnt - i) < SPI_BATCH_MAX ? (cnt - i) : SPI_BATCH_MAX);
+        memset(ops, 0, sizeof(ops));
+        for (value = 0; value < n; value++) {
+            ops[value].read = 1;
+            ops[value].addr = addr;
+        }
+        if (spi_batch(user, ops, n) != MESA_RC_OK) {
+            return -1;
+        }
+    }
+    spi_benchmark_print("batch", cnt, spi_cnt.ioctl_cnt - ioctl_cnt, spi_time_us() - start);
+
+    return 0;
+}
+
+static cli_cmd_t cli_cmd_table[] = {
+    {
+        "Debug SPI Benchmark <addr> [<count>]",
+        "Compare single and batched SPI register reads (default count 1000)",
+        0,
+        0,
+        cli_cmd_spi_benchmark,
+    },
+};
+
 void mscc_appl_spi_init(mscc_appl_init_t *init)
 {
-    if (init->cmd == MSCC_INIT_CMD_REG) {
+    int i;
+
+    switch (init->cmd) {
+    case MSCC_INIT_CMD_REG:
         mscc_appl_trace_register(&trace_module, trace_groups, TRACE_GROUP_CNT);
+        break;
+
+    case MSCC_INIT_CMD_INIT:
+        for (i = 0; i < sizeof(cli_cmd_table)/sizeof(cli_cmd_t); i++) {
+            mscc_appl_cli_cmd_reg(&cli_cmd_table[i]);
+        }
+        break;
+
+    default:
+        break;
     }
 }
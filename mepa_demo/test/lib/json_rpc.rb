@@ -38,6 +38,36 @@ def send_req(method, *params)
     return resp["result"]
 end
 
+# Send a JSON-RPC batch. Each call is [method, *params].
+# Returns the list of results (nil for failed calls) and the batch time in usec.
+# Multi-port methods return a hash keyed by port number, each value an array of the port's outputs.
+def send_batch(calls)
+    batch = calls.each_with_index.map {|c, i| {'method' => c[0], 'params' => c[1..-1], 'id' => i}}
+    req = batch.to_json
+    Log.info "Batch request: #{calls.length} calls"
+
+    resp_txt = nil
+    $s_mutex.synchronize {
+        $s.write([req.length].pack('N'))
+        $s.write(req)
+        hdr = $s.read(4)
+        len = hdr.unpack('N')[0]
+        resp_txt = $s.read(len)
+    }
+    resp = JSON.parse(resp_txt)
+    results = Array.new(calls.length)
+    batch_us = 0
+    resp.each do |r|
+        error = r["error"]
+        Log.msg("#{error}", !$json_error_disable) unless error.nil?
+        # Invalid requests are answered with a null id
+        results[r["id"]] = r["result"] unless r["id"].nil?
+        batch_us = r["batch_us"]
+    end
+    Log.info("Batch response: #{resp.length} replies, #{batch_us} usec")
+    return results, batch_us
+end
+
 def get_req(method, *params)
     result = send_req(method, *params)
     return result if result.nil?
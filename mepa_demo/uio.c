@@ -44,6 +44,7 @@ static mscc_appl_trace_group_t trace_groups[TRACE_GROUP_CNT] = {
 #endif
 
 static volatile uint32_t *base_mem;
+static uint32_t          access_cnt; // Number of register accesses
 
 /* MEBA callouts */
 mesa_rc uio_reg_read(const mesa_chip_no_t chip_no,
@@ -51,6 +52,7 @@ mesa_rc uio_reg_read(const mesa_chip_no_t chip_no,
                  uint32_t             *const value)
 {
     *value = PCIE_HOST_CVT(base_mem[addr]);
+    access_cnt++;
     return MESA_RC_OK;
 }
 
@@ -59,9 +61,15 @@ mesa_rc uio_reg_write(const mesa_chip_no_t chip_no,
                   const uint32_t       value)
 {
     base_mem[addr] = PCIE_HOST_CVT(value);
+    access_cnt++;
     return MESA_RC_OK;
 }
 
+uint32_t uio_access_cnt_get(void)
+{
+    return access_cnt;
+}
+
 int uio_fd = -1;
 char uio_path[PATH_MAX];
 